@@ -0,0 +1,317 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines and implements an object for compile-time
+ *      constant CoreFoundation string literals.
+ */
+
+#ifndef CFUTILITIES_CFSTATICSTRING_HPP
+#define CFUTILITIES_CFSTATICSTRING_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include "CFUtilities.hpp"
+
+#ifdef __cplusplus
+
+/**
+ *  A compile-time constant string literal, validated as UTF-8 and
+ *  hashed at compile time, from which the canonical, interned
+ *  CoreFoundation string for the literal is obtained at run time.
+ *
+ *  Unlike @a CFSTR, which may register the string on first use, and
+ *  @a CFStringCreateWithCString, which allocates, obtaining the
+ *  string neither allocates, after first use, nor hashes the
+ *  literal. As the string is interned, it may also be compared by
+ *  pointer against other interned strings.
+ *
+ *  Declare instances @a constexpr, such that an invalid literal is
+ *  a compile-time error:
+ *
+ *  @code
+ *    static constexpr CFStaticString kNameKey("Name");
+ *
+ *    CFUDictionaryGetNumber(lDictionary, kNameKey, lValue);
+ *  @endcode
+ *
+ *  @note
+ *    The literal is validated and hashed by recursion, as C++11
+ *    constant expressions require, which consumes eight (8) ASCII
+ *    bytes or one non-ASCII UTF-8 sequence per level. With the
+ *    default compiler constant-expression nesting limit of 512,
+ *    literals are therefore limited to roughly 4 KiB of ASCII or
+ *    1 KiB of non-ASCII text; longer literals fail compilation
+ *    unless the limit is raised, for example with
+ *    -fconstexpr-depth.
+ *
+ *  @ingroup string
+ */
+class CFStaticString
+{
+public:
+    /**
+     *  This routine is an object constructor. It instantiates an
+     *  object with the specified string literal.
+     *
+     *  When evaluated at compile time, a literal that is not valid
+     *  UTF-8 is a compile-time error, reported as a call to the
+     *  non-constant InvalidUTF8. When evaluated at run time, such a
+     *  literal yields a NULL CoreFoundation string.
+     *
+     *  @tparam     N          The size, in bytes, of the string
+     *                         literal, including its null
+     *                         terminator.
+     *
+     *  @param[in]  inString   The string literal with which to
+     *                         construct the object.
+     *
+     */
+    template <size_t N>
+    constexpr CFStaticString(const char (&inString)[N]) :
+        mString(inString),
+        mLength(N - 1),
+        mHash(IsValidUTF8(inString, N - 1, 0) ?
+              Hash(inString, N - 1) :
+              InvalidUTF8())
+    {
+    }
+
+    /**
+     *  This routine returns the string literal with which the
+     *  object was instantiated.
+     *
+     *  @returns
+     *    A pointer to the null-terminated string literal.
+     *
+     */
+    constexpr const char * GetCString(void) const
+    {
+        return (mString);
+    }
+
+    /**
+     *  This routine returns the length, in bytes, of the string
+     *  literal, excluding its null terminator.
+     *
+     *  @returns
+     *    The length, in bytes, of the string literal.
+     *
+     */
+    constexpr size_t GetLength(void) const
+    {
+        return (mLength);
+    }
+
+    /**
+     *  This routine returns the precomputed hash of the string
+     *  literal.
+     *
+     *  @returns
+     *    The 64-bit FNV-1a hash of the string literal.
+     *
+     */
+    constexpr size_t GetHash(void) const
+    {
+        return (mHash);
+    }
+
+    /**
+     *  This routine returns the canonical, interned CoreFoundation
+     *  string for the string literal.
+     *
+     *  @returns
+     *    The interned string, which the caller must not release, if
+     *    the literal is valid UTF-8; otherwise, NULL.
+     *
+     */
+    CFStringRef GetString(void) const
+    {
+        return (GetInterned(mString, mLength, mHash));
+    }
+
+    /**
+     *  This routine converts the object to its canonical, interned
+     *  CoreFoundation string, such that it may be passed wherever a
+     *  CoreFoundation string or dictionary key is expected.
+     *
+     */
+    operator CFStringRef(void) const
+    {
+        return (GetString());
+    }
+
+    /**
+     *  This routine returns the 64-bit FNV-1a hash of the specified
+     *  bytes, as used by #CFUStringGetInterned.
+     *
+     *  @param[in]  inString  A pointer to the bytes to hash.
+     *  @param[in]  inLength  The length, in bytes, of @a inString.
+     *
+     *  @returns
+     *    The hash of the bytes.
+     *
+     */
+    static constexpr size_t Hash(const char * inString, size_t inLength)
+    {
+        return (static_cast<size_t>(Hash(inString, inLength, 0, kHashBasis)));
+    }
+
+private:
+    static constexpr uint64_t kHashBasis = 14695981039346656037ULL;
+    static constexpr uint64_t kHashPrime = 1099511628211ULL;
+    static constexpr size_t   kStride    = 8;
+
+    static CFStringRef GetInterned(const char * inUTF8String,
+                                   size_t       inLength,
+                                   size_t       inHash);
+
+    /*
+     *  These are written recursively, with a single return
+     *  statement, as required of C++11 constant expressions. To
+     *  bound the recursion depth, each level consumes up to kStride
+     *  bytes; the per-byte steps within a level are nested calls,
+     *  which do not accumulate depth.
+     */
+
+    static constexpr uint64_t Hash(const char * inString,
+                                   size_t       inLength,
+                                   size_t       inIndex,
+                                   uint64_t     inHash)
+    {
+        return ((inIndex == inLength) ?
+                inHash :
+                (inLength - inIndex >= kStride) ?
+                Hash(inString,
+                     inLength,
+                     inIndex + kStride,
+                     HashStride(inString, inIndex, inHash, kStride)) :
+                Hash(inString,
+                     inLength,
+                     inIndex + 1,
+                     HashByte(inString, inIndex, inHash)));
+    }
+
+    static constexpr uint64_t HashStride(const char * inString,
+                                         size_t       inIndex,
+                                         uint64_t     inHash,
+                                         size_t       inCount)
+    {
+        return ((inCount == 0) ?
+                inHash :
+                HashStride(inString,
+                           inIndex + 1,
+                           HashByte(inString, inIndex, inHash),
+                           inCount - 1));
+    }
+
+    static constexpr uint64_t HashByte(const char * inString,
+                                       size_t       inIndex,
+                                       uint64_t     inHash)
+    {
+        return ((inHash ^ Byte(inString, inIndex)) * kHashPrime);
+    }
+
+    static constexpr unsigned Byte(const char * inString, size_t inIndex)
+    {
+        return (static_cast<unsigned char>(inString[inIndex]));
+    }
+
+    static constexpr bool IsASCIIStride(const char * inString,
+                                        size_t       inLength,
+                                        size_t       inIndex)
+    {
+        return ((inLength - inIndex >= kStride) &&
+                ((Byte(inString, inIndex + 0) | Byte(inString, inIndex + 1) |
+                  Byte(inString, inIndex + 2) | Byte(inString, inIndex + 3) |
+                  Byte(inString, inIndex + 4) | Byte(inString, inIndex + 5) |
+                  Byte(inString, inIndex + 6) | Byte(inString, inIndex + 7)) <= 0x7F));
+    }
+
+    static constexpr bool IsInRange(const char * inString,
+                                    size_t       inLength,
+                                    size_t       inIndex,
+                                    unsigned     inMinimum,
+                                    unsigned     inMaximum)
+    {
+        return ((inIndex < inLength) &&
+                (Byte(inString, inIndex) >= inMinimum) &&
+                (Byte(inString, inIndex) <= inMaximum));
+    }
+
+    /*
+     *  Return the length of the well-formed UTF-8 sequence at the
+     *  specified index, per Table 3-7 of the Unicode Standard, or
+     *  zero (0) if the sequence is ill-formed.
+     */
+    static constexpr size_t SequenceLength(const char * inString,
+                                           size_t       inLength,
+                                           size_t       inIndex)
+    {
+        return ((Byte(inString, inIndex) <= 0x7F) ? 1 :
+                (Byte(inString, inIndex) >= 0xC2 && Byte(inString, inIndex) <= 0xDF) ?
+                    (IsInRange(inString, inLength, inIndex + 1, 0x80, 0xBF) ? 2 : 0) :
+                (Byte(inString, inIndex) >= 0xE0 && Byte(inString, inIndex) <= 0xEF) ?
+                    ((IsInRange(inString, inLength, inIndex + 1,
+                                (Byte(inString, inIndex) == 0xE0) ? 0xA0 : 0x80,
+                                (Byte(inString, inIndex) == 0xED) ? 0x9F : 0xBF) &&
+                      IsInRange(inString, inLength, inIndex + 2, 0x80, 0xBF)) ? 3 : 0) :
+                (Byte(inString, inIndex) >= 0xF0 && Byte(inString, inIndex) <= 0xF4) ?
+                    ((IsInRange(inString, inLength, inIndex + 1,
+                                (Byte(inString, inIndex) == 0xF0) ? 0x90 : 0x80,
+                                (Byte(inString, inIndex) == 0xF4) ? 0x8F : 0xBF) &&
+                      IsInRange(inString, inLength, inIndex + 2, 0x80, 0xBF) &&
+                      IsInRange(inString, inLength, inIndex + 3, 0x80, 0xBF)) ? 4 : 0) :
+                0);
+    }
+
+    static constexpr bool IsValidUTF8(const char * inString,
+                                      size_t       inLength,
+                                      size_t       inIndex)
+    {
+        return ((inIndex == inLength) ||
+                (IsASCIIStride(inString, inLength, inIndex) ?
+                 IsValidUTF8(inString,
+                             inLength,
+                             inIndex + kStride) :
+                 ((SequenceLength(inString, inLength, inIndex) != 0) &&
+                  IsValidUTF8(inString,
+                              inLength,
+                              inIndex + SequenceLength(inString, inLength, inIndex)))));
+    }
+
+    /*
+     *  Deliberately not a constant expression, such that reaching it
+     *  while evaluating a constexpr constructor fails compilation.
+     */
+    static size_t InvalidUTF8(void)
+    {
+        return (0);
+    }
+
+    const char * const mString;
+    const size_t       mLength;
+    const size_t       mHash;
+};
+
+#endif // __cplusplus
+
+#endif // CFUTILITIES_CFSTATICSTRING_HPP
@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2008-2021 Nuovation System Designs, LLC
+ *    Copyright (c) 2008-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -25,6 +25,9 @@
 #ifndef CFUTILITIES_CFSTRING_HPP
 #define CFUTILITIES_CFSTRING_HPP
 
+#include "CFStaticString.hpp"
+#include "CFStringBuilder.hpp"
+#include "CFStringSplitter.hpp"
 #include "CFStringTemplate.hpp"
 
 #endif // CFUTILITIES_CFSTRING_HPP
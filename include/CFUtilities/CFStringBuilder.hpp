@@ -0,0 +1,608 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines and implements an object for efficiently
+ *      building CoreFoundation strings from pieces.
+ */
+
+#ifndef CFUTILITIES_CFSTRINGBUILDER_HPP
+#define CFUTILITIES_CFSTRINGBUILDER_HPP
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+#include <limits>
+#include <type_traits>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include "CFUtilities.hpp"
+
+#ifdef __cplusplus
+
+/**
+ *  An object for building a CoreFoundation string from UTF-8 and
+ *  UTF-16 pieces, strings, and numbers with few allocations.
+ *
+ *  Pieces are accumulated as UTF-8 in a buffer that starts within
+ *  the object itself, typically on the stack, and grows
+ *  geometrically on the heap only when outgrown. The string is then
+ *  created exactly once. A heap buffer is handed to CoreFoundation
+ *  without copying, along with a deallocator matching how it was
+ *  allocated.
+ *
+ *  @code
+ *    CFStringBuilder lBuilder;
+ *
+ *    lBuilder.Append("Received ");
+ *    lBuilder.AppendInteger(lCount);
+ *    lBuilder.Append(" packets from ");
+ *    lBuilder.Append(lHostName);
+ *
+ *    lString = lBuilder.CreateString();
+ *  @endcode
+ *
+ *  If an allocation fails, subsequent appends have no effect and
+ *  #CreateString returns NULL.
+ *
+ *  @ingroup string
+ */
+class CFStringBuilder
+{
+public:
+    /**
+     *  This routine is the default object constructor. It
+     *  instantiates an object with an empty string.
+     *
+     */
+    CFStringBuilder(void) :
+        mBytes(mInline),
+        mLength(0),
+        mCapacity(kInlineSize),
+        mFailed(false)
+    {
+        return;
+    }
+
+    /**
+     *  This routine is the class destructor. It frees the heap
+     *  buffer, if any, not yet handed to a created string.
+     *
+     */
+    ~CFStringBuilder(void)
+    {
+        if (mBytes != mInline)
+        {
+            free(mBytes);
+        }
+    }
+
+    CFStringBuilder(const CFStringBuilder & inBuilder) = delete;
+    CFStringBuilder & operator =(const CFStringBuilder & inBuilder) = delete;
+
+    /**
+     *  This routine returns the length, in UTF-8 bytes, of the string
+     *  built thus far.
+     *
+     *  @returns
+     *    The length, in bytes, of the string.
+     *
+     */
+    size_t GetLength(void) const
+    {
+        return (mLength);
+    }
+
+    /**
+     *  This routine returns the UTF-8 bytes of the string built thus
+     *  far, which are not null-terminated.
+     *
+     *  @note
+     *    The bytes are only valid until the next non-const call on
+     *    the object.
+     *
+     *  @returns
+     *    A pointer to the bytes of the string.
+     *
+     */
+    const char * GetBytes(void) const
+    {
+        return (mBytes);
+    }
+
+    /**
+     *  This routine empties the string built thus far, retaining any
+     *  heap buffer for reuse and clearing any allocation failure.
+     *
+     */
+    void Clear(void)
+    {
+        mLength = 0;
+        mFailed = false;
+    }
+
+    /**
+     *  This routine ensures that the specified number of further
+     *  bytes may be appended without reallocation.
+     *
+     *  @param[in]  inLength  The number of further bytes to reserve.
+     *
+     *  @returns
+     *    True if OK; otherwise, false if an allocation failed.
+     *
+     */
+    bool Reserve(size_t inLength)
+    {
+        return (Grow(inLength) != NULL);
+    }
+
+    /**
+     *  This routine appends the specified UTF-8 bytes.
+     *
+     *  @param[in]  inBytes   A pointer to the UTF-8 bytes to append,
+     *                        which need not be null-terminated.
+     *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+     *
+     *  @returns
+     *    A reference to the object.
+     *
+     */
+    CFStringBuilder & Append(const char * inBytes, size_t inLength)
+    {
+        char * const lBytes = Grow(inLength);
+
+        if ((lBytes != NULL) && (inLength > 0))
+        {
+            memcpy(lBytes, inBytes, inLength);
+
+            mLength += inLength;
+        }
+
+        return (*this);
+    }
+
+    /**
+     *  This routine appends the specified null-terminated UTF-8 C
+     *  string.
+     *
+     *  @param[in]  inString  A pointer to the null-terminated UTF-8
+     *                        C string to append.
+     *
+     *  @returns
+     *    A reference to the object.
+     *
+     */
+    CFStringBuilder & Append(const char * inString)
+    {
+        return (Append(inString, strlen(inString)));
+    }
+
+    /**
+     *  This routine appends the specified character.
+     *
+     *  @param[in]  inCharacter  The ASCII character to append.
+     *
+     *  @returns
+     *    A reference to the object.
+     *
+     */
+    CFStringBuilder & Append(char inCharacter)
+    {
+        return (Append(&inCharacter, 1));
+    }
+
+    /**
+     *  This routine appends the specified UTF-16 code units,
+     *  transcoding them to UTF-8. An unpaired surrogate is replaced
+     *  with U+FFFD.
+     *
+     *  @param[in]  inCharacters  A pointer to the UTF-16 code units
+     *                            to append.
+     *  @param[in]  inLength      The length, in code units, of @a
+     *                            inCharacters.
+     *
+     *  @returns
+     *    A reference to the object.
+     *
+     */
+    CFStringBuilder & Append(const UniChar * inCharacters, size_t inLength)
+    {
+        // Each code unit transcodes to at most three (3) bytes; a
+        // surrogate pair, to four (4).
+
+        char * const lStart = Grow(inLength * 3);
+        char *       lBytes = lStart;
+        uint32_t     lCodePoint;
+
+        if (lStart != NULL)
+        {
+            for (size_t i = 0; i < inLength; i++)
+            {
+                lCodePoint = inCharacters[i];
+
+                if (lCodePoint < 0x80)
+                {
+                    *lBytes++ = static_cast<char>(lCodePoint);
+                    continue;
+                }
+
+                if ((lCodePoint >= 0xD800) && (lCodePoint <= 0xDFFF))
+                {
+                    if ((lCodePoint <= 0xDBFF) &&
+                        ((i + 1) < inLength) &&
+                        (inCharacters[i + 1] >= 0xDC00) &&
+                        (inCharacters[i + 1] <= 0xDFFF))
+                    {
+                        lCodePoint = (0x10000 +
+                                      ((lCodePoint - 0xD800) << 10) +
+                                      (inCharacters[++i] - 0xDC00));
+                    }
+                    else
+                    {
+                        lCodePoint = 0xFFFD;
+                    }
+                }
+
+                lBytes = Encode(lCodePoint, lBytes);
+            }
+
+            mLength += static_cast<size_t>(lBytes - lStart);
+        }
+
+        return (*this);
+    }
+
+    /**
+     *  This routine appends the specified CoreFoundation string,
+     *  directly from its backing store where one is available.
+     *
+     *  @param[in]  inString  The CoreFoundation string to append. A
+     *                        NULL string appends nothing.
+     *
+     *  @returns
+     *    A reference to the object.
+     *
+     */
+    CFStringBuilder & Append(CFStringRef inString)
+    {
+        CFIndex         lLength;
+        const char *    lCString;
+        const UniChar * lCharacters;
+        char *          lBytes;
+        CFIndex         lConverted;
+
+        if (inString != NULL)
+        {
+            lLength  = CFStringGetLength(inString);
+            lCString = CFStringGetCStringPtr(inString, kCFStringEncodingASCII);
+
+            if (lCString != NULL)
+            {
+                Append(lCString, static_cast<size_t>(lLength));
+            }
+            else if ((lCharacters = CFStringGetCharactersPtr(inString)) != NULL)
+            {
+                Append(lCharacters, static_cast<size_t>(lLength));
+            }
+            else
+            {
+                const CFIndex lMaximum = CFStringGetMaximumSizeForEncoding(lLength,
+                                                                           kCFStringEncodingUTF8);
+
+                lBytes = Grow(static_cast<size_t>(lMaximum));
+
+                if (lBytes != NULL)
+                {
+                    CFStringGetBytes(inString,
+                                     CFRangeMake(0, lLength),
+                                     kCFStringEncodingUTF8,
+                                     0,
+                                     false,
+                                     reinterpret_cast<UInt8 *>(lBytes),
+                                     lMaximum,
+                                     &lConverted);
+
+                    mLength += static_cast<size_t>(lConverted);
+                }
+            }
+        }
+
+        return (*this);
+    }
+
+    /**
+     *  This routine appends the decimal representation of the
+     *  specified integer.
+     *
+     *  @tparam     T          The integral type of the integer.
+     *
+     *  @param[in]  inInteger  The integer to append.
+     *
+     *  @returns
+     *    A reference to the object.
+     *
+     */
+    template <typename T>
+    CFStringBuilder & AppendInteger(T inInteger)
+    {
+        static_assert(std::is_integral<T>::value, "T must be integral");
+
+        // Enough for every decimal digit of the type, plus a sign.
+
+        static const size_t kMaximum = std::numeric_limits<T>::digits10 + 2;
+        char * const        lBytes   = Grow(kMaximum);
+
+        if (lBytes != NULL)
+        {
+#if __cplusplus >= 201703L
+            const std::to_chars_result lResult = std::to_chars(lBytes,
+                                                               lBytes + kMaximum,
+                                                               inInteger);
+
+            mLength += static_cast<size_t>(lResult.ptr - lBytes);
+#else
+            mLength += FormatInteger(inInteger, lBytes);
+#endif
+        }
+
+        return (*this);
+    }
+
+    /**
+     *  This routine appends the shortest decimal representation of
+     *  the specified floating point number that reads back as the
+     *  same number.
+     *
+     *  @param[in]  inNumber  The number to append.
+     *
+     *  @returns
+     *    A reference to the object.
+     *
+     */
+    CFStringBuilder & AppendFloat(double inNumber)
+    {
+        // Enough for a sign, seventeen (17) significant digits, a
+        // decimal point, and an exponent.
+
+        static const size_t kMaximum = 32;
+        char * const        lBytes   = Grow(kMaximum);
+
+        if (lBytes != NULL)
+        {
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+            const std::to_chars_result lResult = std::to_chars(lBytes,
+                                                               lBytes + kMaximum,
+                                                               inNumber);
+
+            mLength += static_cast<size_t>(lResult.ptr - lBytes);
+#else
+            int lWritten = 0;
+
+            for (int lPrecision = 15; lPrecision <= 17; lPrecision++)
+            {
+                lWritten = snprintf(lBytes, kMaximum, "%.*g", lPrecision, inNumber);
+
+                if (strtod(lBytes, NULL) == inNumber)
+                {
+                    break;
+                }
+            }
+
+            mLength += static_cast<size_t>(lWritten);
+#endif
+        }
+
+        return (*this);
+    }
+
+    /**
+     *  This routine creates a CoreFoundation string from the string
+     *  built thus far and empties the object for reuse.
+     *
+     *  A string still held within the object is copied; a heap
+     *  buffer is handed to CoreFoundation without copying, along
+     *  with @a kCFAllocatorMalloc to eventually free it.
+     *
+     *  @param[in]  inAllocator  The allocator to use to allocate
+     *                           memory for the string.
+     *
+     *  @returns
+     *    A reference to the string if OK; otherwise, NULL if an
+     *    allocation failed or an appended piece was not valid UTF-8.
+     *    The caller owns the reference and is responsible for
+     *    releasing the object.
+     *
+     */
+    CFStringRef CreateString(CFAllocatorRef inAllocator = kCFAllocatorDefault)
+    {
+        CFStringRef lString = NULL;
+
+        if (!mFailed)
+        {
+            if (mBytes == mInline)
+            {
+                lString = CFStringCreateWithBytes(inAllocator,
+                                                  reinterpret_cast<const UInt8 *>(mBytes),
+                                                  static_cast<CFIndex>(mLength),
+                                                  kCFStringEncodingUTF8,
+                                                  false);
+            }
+            else
+            {
+                // On failure, CoreFoundation does not free the
+                // buffer, which then remains ours.
+
+                lString = CFStringCreateWithBytesNoCopy(inAllocator,
+                                                        reinterpret_cast<const UInt8 *>(mBytes),
+                                                        static_cast<CFIndex>(mLength),
+                                                        kCFStringEncodingUTF8,
+                                                        false,
+                                                        kCFAllocatorMalloc);
+
+                if (lString != NULL)
+                {
+                    mBytes    = mInline;
+                    mCapacity = kInlineSize;
+                }
+            }
+        }
+
+        Clear();
+
+        return (lString);
+    }
+
+private:
+    static const size_t kInlineSize = 256;
+
+    /*
+     *  Ensure room for the specified number of further bytes,
+     *  returning a pointer to where they are to be written, or NULL
+     *  if an allocation failed, now or previously.
+     */
+    char * Grow(size_t inLength)
+    {
+        size_t lCapacity;
+        char * lBytes = NULL;
+
+        if (!mFailed)
+        {
+            if (inLength > (mCapacity - mLength))
+            {
+                lCapacity = mCapacity * 2;
+
+                if (lCapacity < (mLength + inLength))
+                {
+                    lCapacity = mLength + inLength;
+                }
+
+                if (mBytes == mInline)
+                {
+                    lBytes = static_cast<char *>(malloc(lCapacity));
+
+                    if (lBytes != NULL)
+                    {
+                        memcpy(lBytes, mInline, mLength);
+                    }
+                }
+                else
+                {
+                    lBytes = static_cast<char *>(realloc(mBytes, lCapacity));
+                }
+
+                if (lBytes == NULL)
+                {
+                    mFailed = true;
+                    goto done;
+                }
+
+                mBytes    = lBytes;
+                mCapacity = lCapacity;
+            }
+
+            lBytes = mBytes + mLength;
+        }
+
+    done:
+        return (lBytes);
+    }
+
+    /*
+     *  Encode the specified non-ASCII code point as UTF-8, returning
+     *  a pointer past the last byte written.
+     */
+    static char * Encode(uint32_t inCodePoint, char * outBytes)
+    {
+        if (inCodePoint < 0x800)
+        {
+            *outBytes++ = static_cast<char>(0xC0 | (inCodePoint >> 6));
+        }
+        else
+        {
+            if (inCodePoint < 0x10000)
+            {
+                *outBytes++ = static_cast<char>(0xE0 | (inCodePoint >> 12));
+            }
+            else
+            {
+                *outBytes++ = static_cast<char>(0xF0 | (inCodePoint >> 18));
+                *outBytes++ = static_cast<char>(0x80 | ((inCodePoint >> 12) & 0x3F));
+            }
+
+            *outBytes++ = static_cast<char>(0x80 | ((inCodePoint >> 6) & 0x3F));
+        }
+
+        *outBytes++ = static_cast<char>(0x80 | (inCodePoint & 0x3F));
+
+        return (outBytes);
+    }
+
+#if __cplusplus < 201703L
+    /*
+     *  Format the specified integer in decimal, returning the number
+     *  of bytes written.
+     */
+    template <typename T>
+    static size_t FormatInteger(T inInteger, char * outBytes)
+    {
+        typedef typename std::make_unsigned<T>::type Unsigned;
+
+        char     lDigits[std::numeric_limits<T>::digits10 + 1];
+        size_t   lCount     = 0;
+        size_t   lLength    = 0;
+        Unsigned lMagnitude = static_cast<Unsigned>(inInteger);
+
+        if (inInteger < 0)
+        {
+            outBytes[lLength++] = '-';
+
+            lMagnitude = static_cast<Unsigned>(0 - lMagnitude);
+        }
+
+        do {
+            lDigits[lCount++] = static_cast<char>('0' + (lMagnitude % 10));
+
+            lMagnitude /= 10;
+        } while (lMagnitude != 0);
+
+        while (lCount > 0)
+        {
+            outBytes[lLength++] = lDigits[--lCount];
+        }
+
+        return (lLength);
+    }
+#endif
+
+    char * mBytes;
+    size_t mLength;
+    size_t mCapacity;
+    bool   mFailed;
+    char   mInline[kInlineSize];
+};
+
+#endif // __cplusplus
+
+#endif // CFUTILITIES_CFSTRINGBUILDER_HPP
@@ -0,0 +1,422 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines and implements an object for splitting
+ *      CoreFoundation strings into pieces without creating a string
+ *      per piece.
+ */
+
+#ifndef CFUTILITIES_CFSTRINGSPLITTER_HPP
+#define CFUTILITIES_CFSTRINGSPLITTER_HPP
+
+#include <iterator>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+#include <stddef.h>
+#include <string.h>
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include "CFStringTemplate.hpp"
+#include "CFUtilities.hpp"
+
+#ifdef __cplusplus
+
+/**
+ *  An object for splitting a CoreFoundation string on a separator
+ *  character, such as the components of a path, the fields of a
+ *  comma-separated record or the keys of a dotted key path.
+ *
+ *  Unlike @a CFStringCreateArrayBySeparatingStrings, which creates a
+ *  string per piece, each piece is yielded as the range, in UTF-16
+ *  code units, it occupies in the string. A piece may then be
+ *  viewed in place, where the string's backing store allows, and is
+ *  only created as a string on request.
+ *
+ *  The separator is found with @a memchr when the string is stored
+ *  with eight bits per character, directly in its characters when
+ *  they are stored as UTF-16 and, otherwise, through a
+ *  CoreFoundation inline buffer. None of these allocate.
+ *
+ *  @code
+ *    CFStringSplitter lSplitter(lPath, '/');
+ *
+ *    for (const CFRange & lRange : lSplitter)
+ *    {
+ *        if (lRange.length == 0)
+ *            continue;
+ *
+ *        lComponent = lSplitter.CreateString(lRange);
+ *        ...
+ *    }
+ *  @endcode
+ *
+ *  As with @a CFStringCreateArrayBySeparatingStrings, a string with
+ *  N separators yields N + 1 pieces, some of which may be empty,
+ *  unless empty pieces are skipped.
+ *
+ *  @note
+ *    The string is borrowed, rather than retained, and must outlive
+ *    the object. It must not be mutated while it is being split.
+ *
+ *  @ingroup string
+ */
+class CFStringSplitter
+{
+public:
+    /**
+     *  An input iterator over the ranges of the pieces of a string.
+     *
+     */
+    class Iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef CFRange                 value_type;
+        typedef ptrdiff_t               difference_type;
+        typedef const CFRange *         pointer;
+        typedef const CFRange &         reference;
+
+        Iterator(void) :
+            mSplitter(NULL),
+            mRange(CFRangeMake(kCFNotFound, 0))
+        {
+            return;
+        }
+
+        explicit Iterator(CFStringSplitter & inSplitter) :
+            mSplitter(&inSplitter),
+            mRange(CFRangeMake(kCFNotFound, 0))
+        {
+            operator ++();
+        }
+
+        reference operator *(void) const
+        {
+            return (mRange);
+        }
+
+        pointer operator ->(void) const
+        {
+            return (&mRange);
+        }
+
+        Iterator & operator ++(void)
+        {
+            if ((mSplitter != NULL) && !mSplitter->Next(mRange))
+            {
+                mSplitter = NULL;
+            }
+
+            return (*this);
+        }
+
+        bool operator ==(const Iterator & inIterator) const
+        {
+            return (mSplitter == inIterator.mSplitter);
+        }
+
+        bool operator !=(const Iterator & inIterator) const
+        {
+            return (!operator ==(inIterator));
+        }
+
+    private:
+        CFStringSplitter * mSplitter;
+        CFRange            mRange;
+    };
+
+    /**
+     *  This routine is an object constructor. It instantiates an
+     *  object to split the specified string.
+     *
+     *  @param[in]  inString     The CoreFoundation string to split.
+     *  @param[in]  inSeparator  The UTF-16 code unit on which to split
+     *                           @a inString.
+     *  @param[in]  inSkipEmpty  Whether empty pieces are to be
+     *                           skipped, as when tokenizing, rather
+     *                           than yielded, as when splitting.
+     *
+     */
+    CFStringSplitter(CFStringRef inString, UniChar inSeparator, bool inSkipEmpty = false) :
+        mString(inString),
+        mLength((inString == NULL) ? 0 : CFStringGetLength(inString)),
+        mCharacters(NULL),
+        mBytes(NULL),
+        mIsASCII(false),
+        mSeparator(inSeparator),
+        mSkipEmpty(inSkipEmpty),
+        mPosition(0),
+        mAtEnd(inString == NULL)
+    {
+        if (mString != NULL)
+        {
+            mCharacters = CFStringGetCharactersPtr(mString);
+
+            if (mCharacters == NULL)
+            {
+                // An eight-bit store whose bytes are ISO Latin-1, of
+                // which ASCII is a subset, has bytes equal to its
+                // UTF-16 code units.
+
+                mBytes = CFStringGetCStringPtr(mString, kCFStringEncodingISOLatin1);
+
+                if (mBytes != NULL)
+                {
+                    mIsASCII = (CFStringGetCStringPtr(mString, kCFStringEncodingASCII) != NULL);
+                }
+                else
+                {
+                    CFStringInitInlineBuffer(mString, &mBuffer, CFRangeMake(0, mLength));
+                }
+            }
+        }
+    }
+
+    /**
+     *  This routine is an object constructor. It instantiates an
+     *  object to split the string of the specified string object.
+     *
+     *  @param[in]  inString     The string object whose string to
+     *                           split.
+     *  @param[in]  inSeparator  The UTF-16 code unit on which to split
+     *                           @a inString.
+     *  @param[in]  inSkipEmpty  Whether empty pieces are to be
+     *                           skipped, as when tokenizing, rather
+     *                           than yielded, as when splitting.
+     *
+     */
+    template <typename CFStringType>
+    CFStringSplitter(const CFStringTemplate<CFStringType> & inString,
+                     UniChar                                inSeparator,
+                     bool                                   inSkipEmpty = false) :
+        CFStringSplitter(inString.GetString(), inSeparator, inSkipEmpty)
+    {
+        return;
+    }
+
+    CFStringSplitter(const CFStringSplitter & inSplitter) = delete;
+    CFStringSplitter & operator =(const CFStringSplitter & inSplitter) = delete;
+
+    /**
+     *  This routine returns the range of the next piece of the
+     *  string, if any.
+     *
+     *  @param[out]  outRange  The range, in UTF-16 code units, of the
+     *                         next piece of the string.
+     *
+     *  @returns
+     *    True if there was a next piece; otherwise, false.
+     *
+     */
+    bool Next(CFRange & outRange)
+    {
+        CFIndex lStart;
+        CFIndex lEnd;
+        bool    lRetval = false;
+
+        while (!lRetval && !mAtEnd)
+        {
+            lStart = mPosition;
+            lEnd   = Find(lStart);
+
+            if (lEnd == mLength)
+            {
+                mAtEnd = true;
+            }
+            else
+            {
+                mPosition = lEnd + 1;
+            }
+
+            if (!mSkipEmpty || (lEnd > lStart))
+            {
+                outRange = CFRangeMake(lStart, lEnd - lStart);
+                lRetval  = true;
+            }
+        }
+
+        return (lRetval);
+    }
+
+    /**
+     *  This routine restarts splitting from the start of the string.
+     *
+     */
+    void Reset(void)
+    {
+        mPosition = 0;
+        mAtEnd    = (mString == NULL);
+    }
+
+    /**
+     *  This routine restarts splitting from the start of the string
+     *  and returns an iterator to its first piece.
+     *
+     *  @returns
+     *    An iterator to the first piece of the string.
+     *
+     */
+    Iterator begin(void)
+    {
+        Reset();
+
+        return (Iterator(*this));
+    }
+
+    /**
+     *  This routine returns an iterator past the last piece of the
+     *  string.
+     *
+     *  @returns
+     *    An iterator past the last piece of the string.
+     *
+     */
+    Iterator end(void)
+    {
+        return (Iterator());
+    }
+
+    /**
+     *  This routine creates a CoreFoundation string with the
+     *  specified piece of the string.
+     *
+     *  @param[in]  inRange      The range, in UTF-16 code units, of
+     *                           the piece.
+     *  @param[in]  inAllocator  The allocator with which to create
+     *                           the string.
+     *
+     *  @returns
+     *    The string, which the caller must release, on success;
+     *    otherwise, NULL.
+     *
+     */
+    CFStringRef CreateString(CFRange        inRange,
+                             CFAllocatorRef inAllocator = kCFAllocatorDefault) const
+    {
+        return ((mString == NULL) ?
+                NULL :
+                CFStringCreateWithSubstring(inAllocator, mString, inRange));
+    }
+
+#if __cplusplus >= 201703L
+    /**
+     *  This routine returns, in O(1) time, a view of the specified
+     *  piece of the string, which is also valid UTF-8, if the
+     *  string is stored as ASCII.
+     *
+     *  @param[in]  inRange  The range, in UTF-16 code units, of the
+     *                       piece.
+     *
+     *  @returns
+     *    A view of the piece if available; otherwise, a view whose
+     *    data is NULL.
+     *
+     */
+    std::string_view GetStringView(CFRange inRange) const
+    {
+        return (mIsASCII ?
+                std::string_view(mBytes + inRange.location,
+                                 static_cast<size_t>(inRange.length)) :
+                std::string_view());
+    }
+
+    /**
+     *  This routine returns, in O(1) time, a view of the UTF-16 code
+     *  units of the specified piece of the string, if the string is
+     *  stored as UTF-16.
+     *
+     *  @param[in]  inRange  The range, in UTF-16 code units, of the
+     *                       piece.
+     *
+     *  @returns
+     *    A view of the piece if available; otherwise, a view whose
+     *    data is NULL.
+     *
+     */
+    std::u16string_view GetCharactersView(CFRange inRange) const
+    {
+        return ((mCharacters != NULL) ?
+                std::u16string_view(reinterpret_cast<const char16_t *>(mCharacters) + inRange.location,
+                                    static_cast<size_t>(inRange.length)) :
+                std::u16string_view());
+    }
+#endif // __cplusplus >= 201703L
+
+private:
+    /*
+     *  Return the index of the next separator at or after the
+     *  specified index or, if there is none, the length of the
+     *  string.
+     */
+    CFIndex Find(CFIndex inStart)
+    {
+        CFIndex lRetval = inStart;
+
+        if (mCharacters != NULL)
+        {
+            while ((lRetval < mLength) && (mCharacters[lRetval] != mSeparator))
+            {
+                lRetval++;
+            }
+        }
+        else if (mBytes != NULL)
+        {
+            const void * lFound = NULL;
+
+            if (mSeparator <= 0xFF)
+            {
+                lFound = memchr(mBytes + inStart,
+                                mSeparator,
+                                static_cast<size_t>(mLength - inStart));
+            }
+
+            lRetval = ((lFound == NULL) ?
+                       mLength :
+                       static_cast<const char *>(lFound) - mBytes);
+        }
+        else
+        {
+            while ((lRetval < mLength) &&
+                   (CFStringGetCharacterFromInlineBuffer(&mBuffer, lRetval) != mSeparator))
+            {
+                lRetval++;
+            }
+        }
+
+        return (lRetval);
+    }
+
+    CFStringRef          mString;
+    CFIndex              mLength;
+    const UniChar *      mCharacters;
+    const char *         mBytes;
+    bool                 mIsASCII;
+    UniChar              mSeparator;
+    bool                 mSkipEmpty;
+    CFIndex              mPosition;
+    bool                 mAtEnd;
+    CFStringInlineBuffer mBuffer;
+};
+
+#endif // __cplusplus
+
+#endif // CFUTILITIES_CFSTRINGSPLITTER_HPP
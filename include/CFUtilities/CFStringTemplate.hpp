@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2008-2021 Nuovation System Designs, LLC
+ *    Copyright (c) 2008-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -25,8 +25,17 @@
 #define CFUTILITIES_CFSTRING_TEMPLATE_HPP
 
 #include <algorithm>
-#include <map>
+#include <atomic>
+#include <functional>
 #include <memory>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+#include <thread>
+#include <utility>
+
+#include <stdint.h>
+#include <string.h>
 
 #include <CoreFoundation/CoreFoundation.h>
 
@@ -38,6 +47,11 @@
  *  A template to simplify interwork between CoreFoundation strings
  *  and C/C++ standard library string types and code.
  *
+ *  Const member functions, including those that populate the
+ *  encoding buffer cache, may be called concurrently on a shared
+ *  object from any number of threads. Non-const member functions
+ *  require exclusive access.
+ *
  *  @tparam  CFStringType  The CoreFoundation string type, either
  *                         @a CFStringRef or @a CFMutableStringRef.
  *
@@ -55,6 +69,7 @@ public:
      */
     CFStringTemplate(void) :
         mString(NULL),
+        mHash(kHashUnset),
         mCache()
     {
         return;
@@ -70,28 +85,59 @@ public:
      */
     CFStringTemplate(CFStringType inString) :
         mString(NULL),
+        mHash(kHashUnset),
         mCache()
     {
         CFUReferenceSet(mString, inString);
 
-        mCache.clear();
+        mCache.Clear();
     }
 
     /**
      *  This routine is a class copy constructor. It instantiates an
      *  object with the specified object.
      *
+     *  The copy retains, rather than copies, the string, such that,
+     *  for mutable strings, mutation through either object is not
+     *  reflected in the cached encodings or hash of the other.
+     *
      *  @param[in]  inString  A reference to the object with which to
      *                        construct the object.
      *
      */
     CFStringTemplate(const CFStringTemplate & inString) :
         mString(NULL),
+        mHash(inString.mHash.load(std::memory_order_relaxed)),
         mCache()
     {
         CFUReferenceSet(mString, inString.mString);
 
-        mCache.clear();
+        mCache.Clear();
+    }
+
+    /**
+     *  This routine is a class move constructor. It instantiates an
+     *  object by taking over the string reference and encoding
+     *  buffer cache of the specified object, without retaining or
+     *  releasing the string, leaving the specified object with a
+     *  NULL string reference.
+     *
+     *  Pointers previously returned by the specified object for
+     *  encodings held in its heap-backed cache remain valid for the
+     *  lifetime of this object.
+     *
+     *  @param[in,out]  inString  A reference to the object from which
+     *                            to move construct the object.
+     *
+     */
+    CFStringTemplate(CFStringTemplate && inString) noexcept :
+        mString(inString.mString),
+        mHash(inString.mHash.exchange(kHashUnset, std::memory_order_relaxed)),
+        mCache()
+    {
+        inString.mString = NULL;
+
+        mCache.Swap(inString.mCache);
     }
 
     /**
@@ -119,7 +165,8 @@ public:
     {
         CFUReferenceSet(mString, inString);
 
-        mCache.clear();
+        mHash.store(kHashUnset, std::memory_order_relaxed);
+        mCache.Clear();
 
         return (*this);
     }
@@ -129,6 +176,9 @@ public:
      *  the copy operator. It assigns/copies another like object to
      *  the current object.
      *
+     *  As with the copy constructor, the string is retained rather
+     *  than copied.
+     *
      *  @param[in]  inString  A reference to the object to assign/copy
      *                        to the object.
      *
@@ -140,7 +190,43 @@ public:
     {
         CFUReferenceSet(mString, inString.mString);
 
-        mCache.clear();
+        mHash.store(inString.mHash.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+        mCache.Clear();
+
+        return (*this);
+    }
+
+    /**
+     *  This routine is a class assignment operator, specifically,
+     *  the move operator. It releases the current string and takes
+     *  over the string reference and encoding buffer cache of the
+     *  specified object, without retaining or releasing the latter
+     *  string, leaving the specified object with a NULL string
+     *  reference.
+     *
+     *  @param[in,out]  inString  A reference to the object to move
+     *                            to the object.
+     *
+     *  @returns
+     *    A reference to the assigned to (lvalue) object.
+     *
+     */
+    CFStringTemplate & operator =(CFStringTemplate && inString) noexcept
+    {
+        if (this != &inString)
+        {
+            CFURelease(mString);
+
+            mString          = inString.mString;
+            inString.mString = NULL;
+
+            mHash.store(inString.mHash.exchange(kHashUnset, std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+
+            mCache.Clear();
+            mCache.Swap(inString.mCache);
+        }
 
         return (*this);
     }
@@ -244,10 +330,44 @@ public:
      *
      */
     const char * GetCString(CFStringEncoding inEncoding) const
+    {
+        CFIndex lLength;
+
+        return (GetCString(inEncoding, lLength));
+    }
+
+    /**
+     *  This routine attempts to return in O(1) time, the C string
+     *  associated with the object using the specified encoding,
+     *  along with its length, such that callers need not scan the
+     *  string for its null terminator.
+     *
+     *  The length is cached alongside the encoding buffer, so this
+     *  is no more expensive than the overload without it.
+     *
+     *  @note
+     *    VERY careful attention to scoping must be paid attention to
+     *    because the storage backed by the returned pointer is not
+     *    guaranteed beyond the lifetime of the object.
+     *
+     *  @param[in]   inEncoding  The string encoding with which the
+     *                           C string is to be returned.
+     *  @param[out]  outLength   The length, in bytes, of the
+     *                           returned C string, excluding the
+     *                           null terminator, if the string is
+     *                           decodable; otherwise, zero (0).
+     *
+     *  @returns
+     *    A pointer to the string using the specified encoding if
+     *    the string is decodable; otherwise, NULL.
+     *
+     */
+    const char * GetCString(CFStringEncoding inEncoding, CFIndex & outLength) const
     {
         static const char * const kEmptyString = "";
         const char *              lRetval      = NULL;
 
+        outLength = 0;
 
         if (mString == NULL)
         {
@@ -264,53 +384,31 @@ public:
             else
             {
                 // Attempt to get an O(1) representation supported by
-                // CoreFoundation itself, if any.
+                // CoreFoundation itself, if any. Such a
+                // representation is only ever available for strings
+                // stored internally with one byte per character, so
+                // its length is that of the string.
 
                 lRetval = CFStringGetCStringPtr(mString, inEncoding);
 
-                if (lRetval == NULL)
+                if (lRetval != NULL)
+                {
+                    outLength = lLength;
+                }
+                else
                 {
                     // Per the CoreFoundation documentation, there is
                     // no O(1) representation of the string in the
                     // requested encoding available. Consequently, we
-                    // ahve to check the encoding buffer cache local
+                    // have to check the encoding buffer cache local
                     // to this implementation and return the
-                    // representation, if present, or create one and
-                    // return it, if one is not present.
-
-                    EncodingBufferCache::const_iterator lLast   = mCache.end();
-                    EncodingBufferCache::const_iterator lResult = mCache.find(inEncoding);
+                    // representation, if present, or create one,
+                    // add it to the cache, and return it, if one is
+                    // not present. If another thread published the
+                    // same encoding first, its buffer is returned
+                    // instead.
 
-                    if (lResult != lLast)
-                    {
-                        // The encoding was in the cache, return it.
-
-                        lRetval = &lResult->second[0];
-                    }
-                    else
-                    {
-                        // There was no encoding in the cache, create
-                        // one, add it to the cache, and return it.
-
-                        const CFIndex  lSize = CFStringGetMaximumSizeForEncoding(lLength, inEncoding) + static_cast<CFIndex>(sizeof('\0'));
-                        EncodingBuffer lEncodingBuffer(new char[static_cast<size_t>(lSize)]);
-
-                        if (lEncodingBuffer.get() != NULL)
-                        {
-                            const bool lStatus =
-                                CFStringGetCString(mString,
-                                                   &lEncodingBuffer[0],
-                                                   lSize,
-                                                   inEncoding);
-
-                            if (lStatus)
-                            {
-                                mCache[inEncoding] = std::move(lEncodingBuffer);
-
-                                lRetval = mCache[inEncoding].get();
-                            }
-                        }
-                    }
+                    lRetval = mCache.Get(mString, lLength, inEncoding, outLength);
                 }
             }
         }
@@ -318,6 +416,106 @@ public:
         return (lRetval);
     }
 
+#if __cplusplus >= 201703L
+    /**
+     *  This routine attempts to return in O(1) time, a view of the
+     *  string associated with the object using the system encoding.
+     *
+     *  @note
+     *    The storage backed by the returned view is not guaranteed
+     *    beyond the lifetime of the object.
+     *
+     *  @returns
+     *    A view of the string using the system encoding if the
+     *    string is decodable; otherwise, a view whose data is NULL.
+     *
+     */
+    std::string_view GetStringView(void) const
+    {
+        return (GetStringView(CFStringGetSystemEncoding()));
+    }
+
+    /**
+     *  This routine attempts to return in O(1) time, a view of the
+     *  string associated with the object using UTF-8 encoding.
+     *
+     *  @note
+     *    The storage backed by the returned view is not guaranteed
+     *    beyond the lifetime of the object.
+     *
+     *  @returns
+     *    A view of the string using UTF-8 encoding if the string is
+     *    decodable; otherwise, a view whose data is NULL.
+     *
+     */
+    std::string_view GetUTF8StringView(void) const
+    {
+        return (GetStringView(kCFStringEncodingUTF8));
+    }
+
+    /**
+     *  This routine attempts to return in O(1) time, a view of the
+     *  string associated with the object using the specified
+     *  encoding, without scanning for its null terminator.
+     *
+     *  @note
+     *    The storage backed by the returned view is not guaranteed
+     *    beyond the lifetime of the object.
+     *
+     *  @param[in]  inEncoding  The string encoding with which the
+     *                          view is to be returned.
+     *
+     *  @returns
+     *    A view of the string using the specified encoding if the
+     *    string is decodable; otherwise, a view whose data is NULL.
+     *
+     */
+    std::string_view GetStringView(CFStringEncoding inEncoding) const
+    {
+        CFIndex            lLength;
+        const char * const lCString = GetCString(inEncoding, lLength);
+
+        return (std::string_view(lCString, static_cast<size_t>(lLength)));
+    }
+
+    /**
+     *  This routine attempts to return in O(1) time, a view of the
+     *  UTF-16 code units of the string associated with the object.
+     *
+     *  Such a view is only available when CoreFoundation stores the
+     *  string internally as UTF-16, as reported by
+     *  @a CFStringGetCharactersPtr. When it is not, callers may fall
+     *  back to @a CFStringGetCharacters or to an 8-bit view.
+     *
+     *  @note
+     *    The storage backed by the returned view is not guaranteed
+     *    beyond the lifetime of the object.
+     *
+     *  @returns
+     *    A view of the UTF-16 code units of the string if available;
+     *    otherwise, a view whose data is NULL.
+     *
+     */
+    std::u16string_view GetCharactersView(void) const
+    {
+        const UniChar * lCharacters = NULL;
+        CFIndex         lLength     = 0;
+
+        if (mString != NULL)
+        {
+            lCharacters = CFStringGetCharactersPtr(mString);
+
+            if (lCharacters != NULL)
+            {
+                lLength = GetLength();
+            }
+        }
+
+        return (std::u16string_view(reinterpret_cast<const char16_t *>(lCharacters),
+                                    static_cast<size_t>(lLength)));
+    }
+#endif // __cplusplus >= 201703L
+
     /**
      *  This routine returns the CoreFoundation string with which
      *  the object was instantiated.
@@ -332,19 +530,177 @@ public:
     }
 
     /**
-     *  This routine swaps, in O(1) time, the internal data member
-     *  associated with this object with that of the specified
+     *  This routine returns a hash of the UTF-16 code units of the
+     *  string, consistent with #CFUStringGetHash and with equality,
+     *  computing it on first use and returning the memoized value
+     *  thereafter, until the string is next assigned or mutated
+     *  through this object.
+     *
+     *  @returns
+     *    The hash of the string.
+     *
+     */
+    size_t GetHash(void) const
+    {
+        size_t lRetval = mHash.load(std::memory_order_relaxed);
+
+        if (lRetval == kHashUnset)
+        {
+            // Racing threads compute and store the same value, so no
+            // stronger ordering is needed. The rare string that
+            // hashes to the sentinel is simply never memoized.
+
+            lRetval = CFUStringGetHash(mString);
+
+            mHash.store(lRetval, std::memory_order_relaxed);
+        }
+
+        return (lRetval);
+    }
+
+    /**
+     *  This routine appends the specified string to this mutable
+     *  string object.
+     *
+     *  Rather than discarding the encoding buffer cache, the
+     *  appended string alone is encoded and added to each cached
+     *  encoding, where possible.
+     *
+     *  @note
+     *    This routine is only available for mutable strings (that
+     *    is, @a CFMutableString).
+     *
+     *  @note
+     *    Copies of this object share its string and are not
+     *    updated; their cached encodings and hash continue to
+     *    describe the string before it was appended to.
+     *
+     *  @param[in]  inString  The string to append.
+     *
+     */
+    void Append(CFStringRef inString)
+    {
+        if ((mString != NULL) && (inString != NULL))
+        {
+            const CFIndex lLength = CFStringGetLength(mString);
+
+            mCache.Replace(mString, lLength, CFRangeMake(lLength, 0), inString);
+
+            CFStringAppend(mString, inString);
+
+            mHash.store(kHashUnset, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  This routine replaces the specified range of this mutable
+     *  string object with the specified string.
+     *
+     *  Rather than discarding the encoding buffer cache, the
+     *  replacement alone is encoded and spliced into each cached
+     *  encoding, where possible.
+     *
+     *  @note
+     *    This routine is only available for mutable strings (that
+     *    is, @a CFMutableString).
+     *
+     *  @note
+     *    Copies of this object share its string and are not
+     *    updated; their cached encodings and hash continue to
+     *    describe the string before it was modified.
+     *
+     *  @param[in]  inRange        The range, in UTF-16 code units,
+     *                             of the string to replace.
+     *  @param[in]  inReplacement  The string with which to replace
+     *                             @a inRange.
+     *
+     */
+    void Replace(CFRange inRange, CFStringRef inReplacement)
+    {
+        if ((mString != NULL) && (inReplacement != NULL))
+        {
+            const CFIndex lLength = CFStringGetLength(mString);
+
+            mCache.Replace(mString, lLength, inRange, inReplacement);
+
+            CFStringReplace(mString, inRange, inReplacement);
+
+            mHash.store(kHashUnset, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  This routine removes a trailing line feed or carriage return
+     *  and line feed pair, if present, from this mutable string
      *  object.
      *
+     *  Rather than discarding the encoding buffer cache, the
+     *  terminator is trimmed from each cached encoding, where
+     *  possible.
+     *
+     *  @note
+     *    This routine is only available for mutable strings (that
+     *    is, @a CFMutableString).
+     *
+     *  @note
+     *    Copies of this object share its string and are not
+     *    updated; their cached encodings and hash continue to
+     *    describe the string before it was chomped.
+     *
+     *  @returns
+     *    True if a trailing terminator was found and removed;
+     *    otherwise, false.
+     *
+     */
+    bool Chomp(void)
+    {
+        const CFIndex lLength = GetLength();
+        CFIndex       lStart;
+        CFRange       lRange;
+        bool          lRetval = false;
+
+        if ((lLength > 0) && (CFStringGetCharacterAtIndex(mString, lLength - 1) == '\n'))
+        {
+            lStart = lLength - 1;
+
+            if ((lStart > 0) && (CFStringGetCharacterAtIndex(mString, lStart - 1) == '\r'))
+            {
+                lStart--;
+            }
+
+            lRange = CFRangeMake(lStart, lLength - lStart);
+
+            mCache.Replace(mString, lLength, lRange, NULL);
+
+            CFStringDelete(mString, lRange);
+
+            mHash.store(kHashUnset, std::memory_order_relaxed);
+
+            lRetval = true;
+        }
+
+        return (lRetval);
+    }
+
+    /**
+     *  This routine swaps, in O(1) time, the internal data members,
+     *  the string reference and the encoding buffer cache,
+     *  associated with this object with those of the specified
+     *  object, without retaining or releasing either string.
+     *
      *  @param[in]  inString  The string object with which the data
-     *                        member is to be swapped.
+     *                        members are to be swapped.
      *
      */
-    void Swap(CFStringTemplate & inString)
+    void Swap(CFStringTemplate & inString) noexcept
     {
         std::swap(mString, inString.mString);
 
-        mCache.clear();
+        mHash.store(inString.mHash.exchange(mHash.load(std::memory_order_relaxed),
+                                            std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+
+        mCache.Swap(inString.mCache);
     }
 
     /**
@@ -399,25 +755,696 @@ private:
      *  n+1th call to CFStringGetCStringPtr, an O(1) representation in
      *  a given encoding is always available.
      *
-     *  Why an {auto,unique}_ptr and not a vector of characters?  Size
-     *  and speed. A vector carries additional implementation overhead
+     *  Why a unique_ptr and not a vector of characters?  Size and
+     *  speed. A vector carries additional implementation overhead
      *  relative to a "smart" pointer and, additionally, always
      *  initializes every element of the vector. Neither the
      *  implementation overhead nor the superfluous initialization are
      *  needed.
      *
+     *  The cache is an append-only, lock-free list of buffers, one
+     *  per encoding, each published exactly once with a single
+     *  compare-and-swap of the list head. Readers never block or
+     *  contend on a lock, and a buffer, once published, is immutable
+     *  and lives until the cache is cleared by a non-const member
+     *  function. Few strings are ever requested in more than one or
+     *  two encodings, so a linear search is cheaper than any
+     *  associative container.
+     *
+     *  Most strings are short and are only ever requested in a
+     *  single encoding. So, ahead of the list, the cache also has an
+     *  inline buffer that holds the first encoding requested that
+     *  fits within it, such that the common case requires no heap
+     *  allocation at all. Strings that do not fit are sized exactly,
+     *  rather than to the worst-case expansion for the encoding.
+     *
      */
-#if __cplusplus >= 201103L
-    typedef std::unique_ptr<char []>                   EncodingBuffer;
-#else
-    typedef std::auto_ptr<char []>                     EncodingBuffer;
-#endif
-    typedef std::map<CFStringEncoding, EncodingBuffer> EncodingBufferCache;
+    typedef std::unique_ptr<char []> EncodingBuffer;
+
+    class EncodingBufferCache
+    {
+    public:
+        EncodingBufferCache(void) :
+            mInlineState(kInlineEmpty),
+            mInlineLength(0),
+            mHead(NULL)
+        {
+            return;
+        }
+
+        ~EncodingBufferCache(void)
+        {
+            Clear();
+        }
+
+        /**
+         *  This routine returns the published buffer for the
+         *  specified string in the specified encoding, converting
+         *  and publishing it first if it is not yet present.
+         *
+         *  @param[in]   inString    The string to convert.
+         *  @param[in]   inLength    The length, in UTF-16 code units,
+         *                           of @a inString.
+         *  @param[in]   inEncoding  The encoding to convert to.
+         *  @param[out]  outLength   The length, in bytes, of the
+         *                           returned buffer, excluding the
+         *                           null terminator.
+         *
+         *  @returns
+         *    A pointer to the published, null-terminated buffer on
+         *    success; otherwise, NULL if the string cannot be
+         *    represented in the encoding.
+         *
+         */
+        const char * Get(CFStringRef      inString,
+                         CFIndex          inLength,
+                         CFStringEncoding inEncoding,
+                         CFIndex &        outLength)
+        {
+            const uint64_t lPublished = InlineState(inEncoding, kInlinePublished);
+            uint64_t       lState     = mInlineState.load(std::memory_order_acquire);
+            char           lBuffer[kInlineSize];
+            CFIndex        lUsed;
+            CFIndex        lConverted;
+            EncodingBuffer lEncodingBuffer;
+            const char *   lRetval;
+
+            if (lState == lPublished)
+            {
+                outLength = mInlineLength;
+
+                return (&mInline[0]);
+            }
+
+            lRetval = Find(inEncoding, outLength);
+
+            if (lRetval != NULL)
+            {
+                return (lRetval);
+            }
+
+            // Optimistically convert into a stack buffer the size of
+            // the inline one. This succeeds for any string short
+            // enough to be held inline.
+
+            lConverted = CFStringGetBytes(inString,
+                                          CFRangeMake(0, inLength),
+                                          inEncoding,
+                                          0,
+                                          false,
+                                          reinterpret_cast<UInt8 *>(&lBuffer[0]),
+                                          kInlineSize - 1,
+                                          &lUsed);
+
+            if (lConverted == inLength)
+            {
+                lBuffer[lUsed] = '\0';
+
+                // Attempt to claim the inline buffer for this
+                // encoding. At most one encoding ever wins it.
+
+                lState = kInlineEmpty;
+
+                if (mInlineState.compare_exchange_strong(lState,
+                                                         InlineState(inEncoding, kInlineWriting),
+                                                         std::memory_order_acquire,
+                                                         std::memory_order_acquire))
+                {
+                    memcpy(&mInline[0], &lBuffer[0], static_cast<size_t>(lUsed) + 1);
+
+                    mInlineLength = lUsed;
+
+                    mInlineState.store(lPublished, std::memory_order_release);
+
+                    outLength = lUsed;
+
+                    return (&mInline[0]);
+                }
+
+                // If another thread is concurrently publishing this
+                // very encoding inline, wait for it to finish, which
+                // takes no longer than a short copy, such that every
+                // caller sees the same buffer.
+
+                if ((lState >> kInlineStateShift) == inEncoding)
+                {
+                    while (lState != lPublished)
+                    {
+                        std::this_thread::yield();
+
+                        lState = mInlineState.load(std::memory_order_acquire);
+                    }
+
+                    outLength = mInlineLength;
+
+                    return (&mInline[0]);
+                }
+
+                // Otherwise, another encoding holds the inline
+                // buffer and the stack buffer is already the exact
+                // size required.
+
+                lEncodingBuffer.reset(new char[static_cast<size_t>(lUsed) + 1]);
+
+                memcpy(&lEncodingBuffer[0], &lBuffer[0], static_cast<size_t>(lUsed) + 1);
+            }
+            else
+            {
+                // The string is either too long for the inline buffer
+                // or cannot be represented in the encoding. Measure
+                // the exact size required, which also determines
+                // which it is.
+
+                lConverted = CFStringGetBytes(inString,
+                                              CFRangeMake(0, inLength),
+                                              inEncoding,
+                                              0,
+                                              false,
+                                              NULL,
+                                              0,
+                                              &lUsed);
+
+                if (lConverted != inLength)
+                {
+                    return (NULL);
+                }
+
+                lEncodingBuffer.reset(new char[static_cast<size_t>(lUsed) + 1]);
+
+                CFStringGetBytes(inString,
+                                 CFRangeMake(0, inLength),
+                                 inEncoding,
+                                 0,
+                                 false,
+                                 reinterpret_cast<UInt8 *>(&lEncodingBuffer[0]),
+                                 lUsed,
+                                 &lUsed);
+
+                lEncodingBuffer[static_cast<size_t>(lUsed)] = '\0';
+            }
+
+            return (Insert(inEncoding, std::move(lEncodingBuffer), lUsed, outLength));
+        }
+
+        /**
+         *  This routine returns the published heap buffer for the
+         *  specified encoding, if any.
+         *
+         *  @param[in]   inEncoding  The encoding to find.
+         *  @param[out]  outLength   The length, in bytes, of the
+         *                           buffer, excluding the null
+         *                           terminator, if found.
+         *
+         *  @returns
+         *    A pointer to the buffer if found; otherwise, NULL.
+         *
+         */
+        const char * Find(CFStringEncoding inEncoding, CFIndex & outLength) const
+        {
+            return (Find(mHead.load(std::memory_order_acquire), NULL, inEncoding, outLength));
+        }
+
+        /**
+         *  This routine publishes the specified buffer for the
+         *  specified encoding unless another thread has already
+         *  published one for it, in which case the specified buffer
+         *  is discarded.
+         *
+         *  @param[in]   inEncoding  The encoding of the buffer.
+         *  @param[in]   inBuffer    The buffer to publish.
+         *  @param[in]   inLength    The length, in bytes, of the
+         *                           null-terminated buffer, excluding
+         *                           the terminator.
+         *  @param[out]  outLength   The length, in bytes, of the
+         *                           published buffer, excluding the
+         *                           null terminator.
+         *
+         *  @returns
+         *    A pointer to the published buffer for the encoding.
+         *
+         */
+        const char * Insert(CFStringEncoding inEncoding,
+                            EncodingBuffer && inBuffer,
+                            CFIndex          inLength,
+                            CFIndex &        outLength)
+        {
+            Entry *      lHead   = mHead.load(std::memory_order_acquire);
+            Entry *      lEntry;
+            const char * lRetval;
+
+            // Another thread may have published the encoding since
+            // the caller last looked for it.
+
+            lRetval = Find(lHead, NULL, inEncoding, outLength);
+
+            if (lRetval != NULL)
+            {
+                return (lRetval);
+            }
+
+            lEntry        = new Entry(inEncoding, std::move(inBuffer), inLength);
+            lEntry->mNext = lHead;
+
+            while (!mHead.compare_exchange_weak(lEntry->mNext,
+                                                lEntry,
+                                                std::memory_order_release,
+                                                std::memory_order_acquire))
+            {
+                // The head moved. Only the entries published since
+                // the last attempt need be searched for a racing
+                // publication of the same encoding.
+
+                lRetval = Find(lEntry->mNext, lHead, inEncoding, outLength);
+
+                if (lRetval != NULL)
+                {
+                    delete lEntry;
+
+                    return (lRetval);
+                }
+
+                lHead = lEntry->mNext;
+            }
+
+            outLength = inLength;
+
+            return (lEntry->mBuffer.get());
+        }
+
+        /**
+         *  This routine exchanges every published buffer with those
+         *  of the specified cache. Buffers in the heap-backed list
+         *  keep their addresses; those held inline do not. It must
+         *  not be called concurrently with any other operation on
+         *  either cache.
+         *
+         *  @param[in,out]  inCache  The cache with which to exchange
+         *                           buffers.
+         *
+         */
+        void Swap(EncodingBufferCache & inCache) noexcept
+        {
+            const uint64_t lState  = mInlineState.load(std::memory_order_relaxed);
+            Entry * const  lHead   = mHead.load(std::memory_order_relaxed);
+            char           lInline[kInlineSize];
+
+            std::swap(mInlineLength, inCache.mInlineLength);
+
+            mInlineState.store(inCache.mInlineState.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+            inCache.mInlineState.store(lState, std::memory_order_relaxed);
+
+            memcpy(&lInline[0], &mInline[0], sizeof (lInline));
+            memcpy(&mInline[0], &inCache.mInline[0], sizeof (mInline));
+            memcpy(&inCache.mInline[0], &lInline[0], sizeof (lInline));
+
+            mHead.store(inCache.mHead.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+            inCache.mHead.store(lHead, std::memory_order_relaxed);
+        }
+
+        /**
+         *  This routine updates every published buffer to reflect
+         *  the replacement of the specified range of the specified
+         *  string, which must be the string the buffers represent,
+         *  by the specified replacement, before the string itself is
+         *  modified. Rather than re-encoding the entire string, only
+         *  the replacement is encoded and spliced into each buffer.
+         *
+         *  Buffers for encodings in which a string cannot be spliced
+         *  bytewise, that is, encodings other than UTF-8 and those
+         *  with a single byte per character, or in which the
+         *  replacement cannot be represented are discarded and are
+         *  re-created on demand.
+         *
+         *  It must not be called concurrently with any other cache
+         *  operation, and buffers previously returned no longer
+         *  represent the string.
+         *
+         *  @param[in]  inString       The string to be modified.
+         *  @param[in]  inLength       The length, in UTF-16 code
+         *                             units, of @a inString.
+         *  @param[in]  inRange        The range of @a inString to be
+         *                             replaced.
+         *  @param[in]  inReplacement  An optional replacement for
+         *                             @a inRange. If NULL, the range
+         *                             is deleted.
+         *
+         */
+        void Replace(CFStringRef inString,
+                     CFIndex     inLength,
+                     CFRange     inRange,
+                     CFStringRef inReplacement)
+        {
+            const uint64_t lState    = mInlineState.load(std::memory_order_relaxed);
+            Entry *        lPrevious = NULL;
+            Entry *        lEntry    = mHead.load(std::memory_order_relaxed);
+            Splice         lSplice;
+
+            while (lEntry != NULL)
+            {
+                Entry * const lNext = lEntry->mNext;
+
+                if (!lSplice.Measure(inString,
+                                     inLength,
+                                     inRange,
+                                     inReplacement,
+                                     lEntry->mEncoding,
+                                     lEntry->mLength))
+                {
+                    // Unlink and discard the buffer.
+
+                    if (lPrevious == NULL)
+                    {
+                        mHead.store(lNext, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        lPrevious->mNext = lNext;
+                    }
+
+                    delete lEntry;
+                }
+                else
+                {
+                    if (lSplice.mLength < lEntry->mCapacity)
+                    {
+                        lSplice.Apply(&lEntry->mBuffer[0], &lEntry->mBuffer[0]);
+                    }
+                    else
+                    {
+                        const CFIndex  lCapacity = std::max(lSplice.mLength + 1,
+                                                            lEntry->mCapacity * 2);
+                        EncodingBuffer lBuffer(new char[static_cast<size_t>(lCapacity)]);
+
+                        lSplice.Apply(&lEntry->mBuffer[0], &lBuffer[0]);
+
+                        lEntry->mBuffer   = std::move(lBuffer);
+                        lEntry->mCapacity = lCapacity;
+                    }
+
+                    lEntry->mLength = lSplice.mLength;
+
+                    lPrevious = lEntry;
+                }
+
+                lEntry = lNext;
+            }
+
+            if (lState != kInlineEmpty)
+            {
+                const CFStringEncoding lEncoding =
+                    static_cast<CFStringEncoding>(lState >> kInlineStateShift);
+
+                mInlineState.store(kInlineEmpty, std::memory_order_relaxed);
+
+                if (lSplice.Measure(inString,
+                                    inLength,
+                                    inRange,
+                                    inReplacement,
+                                    lEncoding,
+                                    mInlineLength))
+                {
+                    if (lSplice.mLength < kInlineSize)
+                    {
+                        lSplice.Apply(&mInline[0], &mInline[0]);
+
+                        mInlineLength = lSplice.mLength;
+
+                        mInlineState.store(lState, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        // The buffer has outgrown the inline one;
+                        // move it to the heap-backed list.
+
+                        EncodingBuffer lBuffer(new char[static_cast<size_t>(lSplice.mLength) + 1]);
+
+                        lSplice.Apply(&mInline[0], &lBuffer[0]);
+
+                        lEntry        = new Entry(lEncoding, std::move(lBuffer), lSplice.mLength);
+                        lEntry->mNext = mHead.load(std::memory_order_relaxed);
+
+                        mHead.store(lEntry, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+        /**
+         *  This routine discards every published buffer. It must not
+         *  be called concurrently with any other cache operation.
+         *
+         */
+        void Clear(void)
+        {
+            Entry * lEntry = mHead.exchange(NULL, std::memory_order_relaxed);
+
+            mInlineState.store(kInlineEmpty, std::memory_order_relaxed);
+
+            while (lEntry != NULL)
+            {
+                Entry * const lNext = lEntry->mNext;
+
+                delete lEntry;
+
+                lEntry = lNext;
+            }
+        }
+
+    private:
+        /*
+         *  The inline buffer size, in bytes, including the null
+         *  terminator.
+         */
+        static const CFIndex  kInlineSize       = 48;
+
+        /*
+         *  The inline buffer state word holds the encoding, shifted
+         *  left by kInlineStateShift, and one of the phases below.
+         */
+        static const unsigned kInlineStateShift = 2;
+        static const uint64_t kInlineEmpty      = 0;
+        static const uint64_t kInlineWriting    = 1;
+        static const uint64_t kInlinePublished  = 2;
+
+        static uint64_t InlineState(CFStringEncoding inEncoding, uint64_t inPhase)
+        {
+            return ((static_cast<uint64_t>(inEncoding) << kInlineStateShift) | inPhase);
+        }
+
+        struct Entry
+        {
+            Entry(CFStringEncoding inEncoding,
+                  EncodingBuffer && inBuffer,
+                  CFIndex          inLength) :
+                mEncoding(inEncoding),
+                mNext(NULL),
+                mBuffer(std::move(inBuffer)),
+                mLength(inLength),
+                mCapacity(inLength + 1)
+            {
+                return;
+            }
+
+            const CFStringEncoding mEncoding;
+            Entry *                mNext;
+            EncodingBuffer         mBuffer;
+            CFIndex                mLength;
+            CFIndex                mCapacity;
+        };
+
+        /*
+         *  The byte-level description of replacing a range of a
+         *  string within an encoded buffer for that string.
+         */
+        struct Splice
+        {
+            /*
+             *  Measure the splice for the specified encoding and the
+             *  specified buffer length, returning false if the
+             *  buffer cannot be spliced.
+             */
+            bool Measure(CFStringRef      inString,
+                         CFIndex          inLength,
+                         CFRange          inRange,
+                         CFStringRef      inReplacement,
+                         CFStringEncoding inEncoding,
+                         CFIndex          inBufferLength)
+            {
+                const bool lIsSingleByte = (CFStringGetMaximumSizeForEncoding(1, inEncoding) == 1);
+
+                mEncoding    = inEncoding;
+                mReplacement = inReplacement;
+                mSuffix      = inBufferLength;
+
+                if (!lIsSingleByte && (inEncoding != kCFStringEncodingUTF8))
+                {
+                    return (false);
+                }
+
+                if (!Bytes(inReplacement,
+                           CFRangeMake(0, (inReplacement == NULL) ? 0 : CFStringGetLength(inReplacement)),
+                           inEncoding,
+                           mInserted))
+                {
+                    return (false);
+                }
+
+                if (lIsSingleByte)
+                {
+                    mOffset  = inRange.location;
+                    mRemoved = inRange.length;
+                }
+                else
+                {
+                    if (!Bytes(inString, inRange, inEncoding, mRemoved))
+                    {
+                        return (false);
+                    }
+
+                    // For the common case of modifying the end of the
+                    // string, the offset follows from the buffer
+                    // length, avoiding a measurement of everything
+                    // before the range.
+
+                    if ((inRange.location + inRange.length) == inLength)
+                    {
+                        mOffset = inBufferLength - mRemoved;
+                    }
+                    else if (!Bytes(inString,
+                                    CFRangeMake(0, inRange.location),
+                                    inEncoding,
+                                    mOffset))
+                    {
+                        return (false);
+                    }
+                }
+
+                mSuffix = inBufferLength - mOffset - mRemoved;
+                mLength = inBufferLength - mRemoved + mInserted;
+
+                return (true);
+            }
+
+            /*
+             *  Apply the measured splice from the specified source
+             *  buffer to the specified destination buffer, which may
+             *  be the same buffer if it has sufficient capacity.
+             */
+            void Apply(const char * inSource, char * outDestination) const
+            {
+                CFIndex lUsed;
+
+                if (outDestination != inSource)
+                {
+                    memcpy(outDestination, inSource, static_cast<size_t>(mOffset));
+                }
+
+                // Move the suffix, including the null terminator,
+                // before writing the replacement over its old
+                // location.
+
+                memmove(outDestination + mOffset + mInserted,
+                        inSource + mOffset + mRemoved,
+                        static_cast<size_t>(mSuffix) + 1);
+
+                if (mInserted > 0)
+                {
+                    CFStringGetBytes(mReplacement,
+                                     CFRangeMake(0, CFStringGetLength(mReplacement)),
+                                     mEncoding,
+                                     0,
+                                     false,
+                                     reinterpret_cast<UInt8 *>(outDestination + mOffset),
+                                     mInserted,
+                                     &lUsed);
+                }
+            }
+
+            static bool Bytes(CFStringRef      inString,
+                              CFRange          inRange,
+                              CFStringEncoding inEncoding,
+                              CFIndex &        outBytes)
+            {
+                outBytes = 0;
+
+                if (inRange.length == 0)
+                {
+                    return (true);
+                }
+
+                return (CFStringGetBytes(inString,
+                                         inRange,
+                                         inEncoding,
+                                         0,
+                                         false,
+                                         NULL,
+                                         0,
+                                         &outBytes) == inRange.length);
+            }
+
+            CFStringEncoding mEncoding;
+            CFStringRef      mReplacement;
+            CFIndex          mOffset;
+            CFIndex          mRemoved;
+            CFIndex          mInserted;
+            CFIndex          mSuffix;
+            CFIndex          mLength;
+        };
+
+        static const char * Find(const Entry *    inFirst,
+                                 const Entry *    inLast,
+                                 CFStringEncoding inEncoding,
+                                 CFIndex &        outLength)
+        {
+            for (const Entry * lEntry = inFirst; lEntry != inLast; lEntry = lEntry->mNext)
+            {
+                if (lEntry->mEncoding == inEncoding)
+                {
+                    outLength = lEntry->mLength;
+
+                    return (lEntry->mBuffer.get());
+                }
+            }
+
+            return (NULL);
+        }
+
+        EncodingBufferCache(const EncodingBufferCache &);
+        EncodingBufferCache & operator =(const EncodingBufferCache &);
+
+        std::atomic<uint64_t> mInlineState;
+        CFIndex               mInlineLength;
+        char                  mInline[kInlineSize];
+        std::atomic<Entry *>  mHead;
+    };
+
+    static constexpr size_t kHashUnset = 0;
 
     CFStringType                mString;
+    mutable std::atomic<size_t> mHash;
     mutable EncodingBufferCache mCache;
 };
 
+/**
+ *  This routine swaps, in O(1) time, the specified string objects,
+ *  such that standard library algorithms and containers find it
+ *  through argument-dependent lookup.
+ *
+ *  @param[in,out]  inFirst   The first string object to swap.
+ *  @param[in,out]  inSecond  The second string object to swap.
+ *
+ *  @ingroup string
+ */
+template <typename CFStringType>
+inline void
+swap(CFStringTemplate<CFStringType> & inFirst,
+     CFStringTemplate<CFStringType> & inSecond) noexcept
+{
+    inFirst.Swap(inSecond);
+}
+
 // Predefined specializations for the CFStringTemplate template
 
 /**
@@ -436,6 +1463,74 @@ typedef CFStringTemplate<CFStringRef> CFString;
  */
 typedef CFStringTemplate<CFMutableStringRef> CFMutableString;
 
+/**
+ *  A hash function object for CoreFoundation strings, consistent
+ *  with #CFUStringsMatch, such that raw string references may be
+ *  used as keys in standard library hashed containers by content
+ *  rather than by pointer identity:
+ *
+ *  @code
+ *    std::unordered_map<CFStringRef, int, CFUStringHash, CFUStringEqual> lIndex;
+ *  @endcode
+ *
+ *  String objects are hashed with their memoized hash.
+ *
+ *  @ingroup string
+ */
+struct CFUStringHash
+{
+    size_t operator ()(CFStringRef inString) const
+    {
+        return (CFUStringGetHash(inString));
+    }
+
+    template <typename CFStringType>
+    size_t operator ()(const CFStringTemplate<CFStringType> & inString) const
+    {
+        return (inString.GetHash());
+    }
+};
+
+/**
+ *  An equality function object for CoreFoundation strings, for use
+ *  with #CFUStringHash.
+ *
+ *  @note
+ *    As with #CFUStringsMatch, a NULL string matches nothing, not
+ *    even itself, and so must not be used as a key.
+ *
+ *  @ingroup string
+ */
+struct CFUStringEqual
+{
+    bool operator ()(CFStringRef inFirst, CFStringRef inSecond) const
+    {
+        return (CFUStringsMatch(inFirst, inSecond));
+    }
+};
+
+namespace std
+{
+
+/**
+ *  Specialization of the standard hash for immutable and mutable
+ *  string objects, such that they may be used directly as keys in
+ *  standard library hashed containers, with equality provided by
+ *  their equality operator.
+ *
+ *  @ingroup string
+ */
+template <typename CFStringType>
+struct hash<CFStringTemplate<CFStringType> >
+{
+    size_t operator ()(const CFStringTemplate<CFStringType> & inString) const
+    {
+        return (inString.GetHash());
+    }
+};
+
+} // namespace std
+
 #endif // __cplusplus
 
 #endif // CFUTILITIES_CFSTRING_TEMPLATE_HPP
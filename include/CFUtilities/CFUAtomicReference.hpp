@@ -0,0 +1,412 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines and implements an object for publishing a
+ *      reference to an immutable CoreFoundation object to many
+ *      reader threads.
+ */
+
+#ifndef CFUTILITIES_CFUATOMICREFERENCE_HPP
+#define CFUTILITIES_CFUATOMICREFERENCE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <stddef.h>
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include "CFURef.hpp"
+#include "CFUtilities.hpp"
+
+#ifdef __cplusplus
+
+/**
+ *  An object that publishes a reference to an immutable
+ *  CoreFoundation object, such as a configuration dictionary, to
+ *  any number of reader threads, and allows a writer to replace it
+ *  at any time, in the manner of read-copy-update.
+ *
+ *  Readers take a #Snapshot, which neither locks nor retains the
+ *  object. Instead, the reader announces the reference it is using
+ *  in a hazard slot of its own, on its own cache line, so readers
+ *  on different threads do not contend with one another or with the
+ *  object's reference count.
+ *
+ *  A writer replaces the reference with #Set, which, as with
+ *  @a CFUReferenceSet, retains the new reference. The old reference
+ *  is retired rather than released, and released only once no
+ *  snapshot still announces it, whether immediately or on a later
+ *  #Set or #Reclaim.
+ *
+ *  @code
+ *    static CFUAtomicReference<CFDictionaryRef> sConfiguration;
+ *
+ *    // Reader
+ *
+ *    {
+ *        CFUAtomicReference<CFDictionaryRef>::Snapshot lConfiguration(sConfiguration);
+ *
+ *        CFUDictionaryGetNumber(lConfiguration, kTimeoutKey, lTimeout);
+ *    }
+ *
+ *    // Writer
+ *
+ *    sConfiguration.Set(lNewConfiguration);
+ *  @endcode
+ *
+ *  @note
+ *    Snapshots are meant to be short-lived. A reader that needs the
+ *    object beyond the scope of a snapshot should #Copy it.
+ *
+ *  @note
+ *    At most @a kReaders snapshots, 128 by default, may be held at
+ *    once across all threads. Past that, a reader taking another
+ *    snapshot spins, yielding the processor, until one is
+ *    destroyed; a thread that already holds every slot never
+ *    proceeds. Size @a kReaders for the greatest number of reader
+ *    threads, times any nesting of snapshots on one thread.
+ *
+ *  @tparam  T         The CoreFoundation reference type of an
+ *                     immutable object, for example,
+ *                     @a CFDictionaryRef.
+ *  @tparam  kReaders  The number of hazard slots and, so, of
+ *                     snapshots that may be held at once, across
+ *                     all threads, without waiting.
+ *
+ *  @ingroup base
+ */
+template <typename T, size_t kReaders = 128>
+class CFUAtomicReference
+{
+private:
+    /*
+     *  A hazard slot, aligned to, and so sized as a multiple of, its
+     *  own cache line, such that readers on different threads never
+     *  share one.
+     */
+    static const size_t kCacheLineSize = 64;
+
+    struct alignas(kCacheLineSize) Slot
+    {
+        Slot(void) :
+            mHazard(NULL),
+            mInUse(false)
+        {
+            return;
+        }
+
+        std::atomic<const void *> mHazard;
+        std::atomic<bool>         mInUse;
+    };
+
+public:
+    /**
+     *  An object that holds, without retaining, the reference
+     *  published at the time it was taken, for as long as it
+     *  exists.
+     *
+     */
+    class Snapshot
+    {
+    public:
+        /**
+         *  This routine is an object constructor. It instantiates a
+         *  snapshot of the reference published by the specified
+         *  object.
+         *
+         *  @param[in]  inReference  The object whose reference to
+         *                           snapshot.
+         *
+         */
+        explicit Snapshot(const CFUAtomicReference & inReference) :
+            mSlot(inReference.Acquire()),
+            mReference(inReference.Protect(*mSlot))
+        {
+            return;
+        }
+
+        /**
+         *  This routine is the class destructor. It withdraws the
+         *  announcement of the reference, such that a writer may
+         *  release it if it has been replaced.
+         *
+         */
+        ~Snapshot(void)
+        {
+            mSlot->mHazard.store(NULL, std::memory_order_release);
+            mSlot->mInUse.store(false, std::memory_order_release);
+        }
+
+        Snapshot(const Snapshot & inSnapshot) = delete;
+        Snapshot & operator =(const Snapshot & inSnapshot) = delete;
+
+        /**
+         *  This routine returns the reference, valid for the
+         *  lifetime of the snapshot.
+         *
+         *  @returns
+         *    The reference, which the caller must not release.
+         *
+         */
+        T get(void) const
+        {
+            return (mReference);
+        }
+
+        /**
+         *  This routine converts the snapshot to its reference, such
+         *  that it may be passed wherever the reference type is
+         *  expected.
+         *
+         */
+        operator T(void) const
+        {
+            return (mReference);
+        }
+
+    private:
+        Slot * const mSlot;
+        const T      mReference;
+    };
+
+    /**
+     *  This routine is the default object constructor. It
+     *  instantiates an object with a NULL reference.
+     *
+     */
+    CFUAtomicReference(void) :
+        mCurrent(NULL)
+    {
+        return;
+    }
+
+    /**
+     *  This routine is an object constructor. It instantiates an
+     *  object with, and retains, the specified reference.
+     *
+     *  @param[in]  inReference  The reference, which may be NULL,
+     *                           with which to construct the object.
+     *
+     */
+    explicit CFUAtomicReference(T inReference) :
+        mCurrent(NULL)
+    {
+        T lReference = NULL;
+
+        CFUReferenceSet(lReference, inReference);
+
+        mCurrent.store(lReference, std::memory_order_release);
+    }
+
+    /**
+     *  This routine is the class destructor. It releases the current
+     *  and all retired references.
+     *
+     *  @note
+     *    No snapshot of the object may outlive it.
+     *
+     */
+    ~CFUAtomicReference(void)
+    {
+        CFURelease(mCurrent.load(std::memory_order_acquire));
+
+        for (size_t i = 0; i < mRetired.size(); i++)
+        {
+            CFURelease(mRetired[i]);
+        }
+    }
+
+    CFUAtomicReference(const CFUAtomicReference & inReference) = delete;
+    CFUAtomicReference & operator =(const CFUAtomicReference & inReference) = delete;
+
+    /**
+     *  This routine publishes, and retains, the specified reference,
+     *  retiring the previous one, which is released as soon as no
+     *  snapshot holds it.
+     *
+     *  Concurrent writers are serialized with one another, but never
+     *  block readers.
+     *
+     *  @param[in]  inReference  The reference, which may be NULL, to
+     *                           publish.
+     *
+     */
+    void Set(T inReference)
+    {
+        std::lock_guard<std::mutex> lLock(mWriterMutex);
+        T                           lReference = NULL;
+        T                           lPrevious;
+
+        CFUReferenceSet(lReference, inReference);
+
+        lPrevious = mCurrent.exchange(lReference, std::memory_order_seq_cst);
+
+        if (lPrevious != NULL)
+        {
+            mRetired.push_back(lPrevious);
+        }
+
+        ReclaimLocked();
+    }
+
+    /**
+     *  This routine returns a retained reference to the currently
+     *  published object, for use beyond the scope of a snapshot.
+     *
+     *  @returns
+     *    An object owning a reference to the currently published
+     *    object.
+     *
+     */
+    CFURef<T> Copy(void) const
+    {
+        const Snapshot lSnapshot(*this);
+
+        return (CFURef<T>(lSnapshot.get()));
+    }
+
+    /**
+     *  This routine releases those retired references that no
+     *  snapshot holds any longer.
+     *
+     *  @returns
+     *    The number of retired references still held by snapshots.
+     *
+     */
+    size_t Reclaim(void)
+    {
+        std::lock_guard<std::mutex> lLock(mWriterMutex);
+
+        return (ReclaimLocked());
+    }
+
+private:
+    /*
+     *  Each thread starts its search for a free slot at its own
+     *  index, such that, with no more threads than slots, it nearly
+     *  always finds the slot it last used free and uncontended.
+     */
+    static size_t GetThreadIndex(void)
+    {
+        static std::atomic<size_t> sNextIndex(0);
+        static thread_local size_t sIndex =
+            sNextIndex.fetch_add(1, std::memory_order_relaxed);
+
+        return (sIndex);
+    }
+
+    Slot * Acquire(void) const
+    {
+        const size_t lStart = GetThreadIndex();
+        Slot *       lRetval = NULL;
+
+        while (lRetval == NULL)
+        {
+            for (size_t i = 0; (lRetval == NULL) && (i < kReaders); i++)
+            {
+                Slot & lSlot = mSlots[(lStart + i) % kReaders];
+
+                if (!lSlot.mInUse.load(std::memory_order_relaxed) &&
+                    !lSlot.mInUse.exchange(true, std::memory_order_acquire))
+                {
+                    lRetval = &lSlot;
+                }
+            }
+
+            if (lRetval == NULL)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        return (lRetval);
+    }
+
+    /*
+     *  Announce the current reference in the specified slot, and
+     *  confirm it is still current, such that a writer that
+     *  replaces it thereafter is certain to see the announcement.
+     */
+    T Protect(Slot & inSlot) const
+    {
+        T lRetval = mCurrent.load(std::memory_order_acquire);
+        T lCurrent;
+
+        while (true)
+        {
+            inSlot.mHazard.store(lRetval, std::memory_order_seq_cst);
+
+            lCurrent = mCurrent.load(std::memory_order_seq_cst);
+
+            if (lCurrent == lRetval)
+            {
+                break;
+            }
+
+            lRetval = lCurrent;
+        }
+
+        return (lRetval);
+    }
+
+    size_t ReclaimLocked(void)
+    {
+        size_t lKept = 0;
+
+        for (size_t i = 0; i < mRetired.size(); i++)
+        {
+            bool lHeld = false;
+
+            for (size_t j = 0; !lHeld && (j < kReaders); j++)
+            {
+                lHeld = (mSlots[j].mHazard.load(std::memory_order_seq_cst) == mRetired[i]);
+            }
+
+            if (lHeld)
+            {
+                mRetired[lKept++] = mRetired[i];
+            }
+            else
+            {
+                CFRelease(mRetired[i]);
+            }
+        }
+
+        mRetired.resize(lKept);
+
+        return (lKept);
+    }
+
+    // Before C++17, an object allocated with new is only guaranteed
+    // the alignment of std::max_align_t, so the slots are only
+    // certain to be cache-line aligned in static or automatic
+    // storage.
+
+    std::atomic<T>                       mCurrent;
+    alignas(kCacheLineSize) mutable Slot mSlots[kReaders];
+    std::mutex                           mWriterMutex;
+    std::vector<T>                       mRetired;
+};
+
+#endif // __cplusplus
+
+#endif // CFUTILITIES_CFUATOMICREFERENCE_HPP
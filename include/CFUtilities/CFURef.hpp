@@ -0,0 +1,348 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines and implements an object for owning a
+ *      reference to a CoreFoundation object of any type.
+ */
+
+#ifndef CFUTILITIES_CFUREF_HPP
+#define CFUTILITIES_CFUREF_HPP
+
+#include <utility>
+
+#include <stddef.h>
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include "CFUtilities.hpp"
+
+#ifdef __cplusplus
+
+/**
+ *  An object that owns a single reference to a CoreFoundation object
+ *  of any type, releasing it when the object is destroyed.
+ *
+ *  Constructing from a reference retains it, following the same
+ *  convention as @a CFStringTemplate, though explicitly, such that
+ *  the result of a "Create" function is never retained in error
+ *  by assignment. References returned by
+ *  CoreFoundation "Create" and "Copy" functions, which the caller
+ *  already owns, are instead adopted with #Adopt or #CFURefAdopt.
+ *
+ *  Ownership moves between objects, and into and out of them with
+ *  #release, without any reference count traffic. Only copies
+ *  retain.
+ *
+ *  The object converts implicitly to its reference type, such that
+ *  it may be passed directly to existing CoreFoundation and
+ *  CFUtilities functions:
+ *
+ *  @code
+ *    CFURef<CFMutableDictionaryRef> lDictionary =
+ *        CFURefAdopt(CFDictionaryCreateMutable(kCFAllocatorDefault,
+ *                                              0,
+ *                                              &kCFTypeDictionaryKeyCallBacks,
+ *                                              &kCFTypeDictionaryValueCallBacks));
+ *
+ *    __Require(lDictionary != NULL, done);
+ *
+ *    CFUDictionarySetNumber(lDictionary, CFSTR("Number"), 42);
+ *
+ *    return (lDictionary.release());
+ *  @endcode
+ *
+ *  @tparam  T  The CoreFoundation reference type, for example,
+ *              @a CFDictionaryRef or @a CFMutableArrayRef.
+ *
+ *  @ingroup base
+ */
+template <typename T>
+class CFURef
+{
+public:
+    /**
+     *  This routine is the default object constructor. It
+     *  instantiates an object with a NULL reference.
+     *
+     */
+    CFURef(void) noexcept :
+        mReference(NULL)
+    {
+        return;
+    }
+
+    /**
+     *  This routine is an object constructor. It instantiates an
+     *  object with, and retains, the specified reference.
+     *
+     *  @param[in]  inReference  The reference, which may be NULL,
+     *                           with which to construct the object.
+     *
+     */
+    explicit CFURef(T inReference) :
+        mReference(NULL)
+    {
+        CFUReferenceSet(mReference, inReference);
+    }
+
+    /**
+     *  This routine is a class copy constructor. It instantiates an
+     *  object with, and retains, the reference of the specified
+     *  object.
+     *
+     *  @param[in]  inReference  A reference to the object with which
+     *                           to construct the object.
+     *
+     */
+    CFURef(const CFURef & inReference) :
+        mReference(NULL)
+    {
+        CFUReferenceSet(mReference, inReference.mReference);
+    }
+
+    /**
+     *  This routine is a class move constructor. It instantiates an
+     *  object by taking over the reference of the specified object,
+     *  without retaining or releasing it, leaving the specified
+     *  object with a NULL reference.
+     *
+     *  @param[in,out]  inReference  A reference to the object from
+     *                               which to move construct the
+     *                               object.
+     *
+     */
+    CFURef(CFURef && inReference) noexcept :
+        mReference(inReference.release())
+    {
+        return;
+    }
+
+    /**
+     *  This routine is a converting move constructor. It
+     *  instantiates an object by taking over the reference of an
+     *  object of a convertible reference type, for example, from a
+     *  mutable to an immutable type, without retaining or releasing
+     *  it.
+     *
+     *  @tparam         U            The CoreFoundation reference type
+     *                               of the object to move from.
+     *
+     *  @param[in,out]  inReference  A reference to the object from
+     *                               which to move construct the
+     *                               object.
+     *
+     */
+    template <typename U>
+    CFURef(CFURef<U> && inReference) noexcept :
+        mReference(inReference.release())
+    {
+        return;
+    }
+
+    /**
+     *  This routine is the class destructor. It releases the
+     *  reference, if any.
+     *
+     */
+    ~CFURef(void)
+    {
+        CFURelease(mReference);
+    }
+
+    /**
+     *  This routine is a class assignment operator, specifically,
+     *  the copy operator. It releases the current reference and
+     *  retains that of the specified object.
+     *
+     *  @param[in]  inReference  A reference to the object to assign.
+     *
+     *  @returns
+     *    A reference to the assigned to (lvalue) object.
+     *
+     */
+    CFURef & operator =(const CFURef & inReference)
+    {
+        if (this != &inReference)
+        {
+            CFUReferenceSet(mReference, inReference.mReference);
+        }
+
+        return (*this);
+    }
+
+    /**
+     *  This routine is a class assignment operator, specifically,
+     *  the move operator. It releases the current reference and
+     *  takes over that of the specified object, without retaining
+     *  or releasing the latter.
+     *
+     *  @param[in,out]  inReference  A reference to the object to move.
+     *
+     *  @returns
+     *    A reference to the assigned to (lvalue) object.
+     *
+     */
+    CFURef & operator =(CFURef && inReference) noexcept
+    {
+        if (this != &inReference)
+        {
+            reset(inReference.release());
+        }
+
+        return (*this);
+    }
+
+    /**
+     *  This routine returns the reference, which remains owned by
+     *  the object.
+     *
+     *  @returns
+     *    The reference, which the caller must not release.
+     *
+     */
+    T get(void) const noexcept
+    {
+        return (mReference);
+    }
+
+    /**
+     *  This routine relinquishes ownership of the reference, without
+     *  releasing it, leaving the object with a NULL reference.
+     *
+     *  @returns
+     *    The reference, which the caller must release.
+     *
+     */
+    T release(void) noexcept
+    {
+        T lRetval = mReference;
+
+        mReference = NULL;
+
+        return (lRetval);
+    }
+
+    /**
+     *  This routine releases the current reference and adopts,
+     *  without retaining, the specified one.
+     *
+     *  @param[in]  inReference  The reference, which may be NULL, to
+     *                           adopt.
+     *
+     */
+    void reset(T inReference = NULL) noexcept
+    {
+        T lPrevious = mReference;
+
+        mReference = inReference;
+
+        CFURelease(lPrevious);
+    }
+
+    /**
+     *  This routine swaps the references of this object and the
+     *  specified object, without retaining or releasing either.
+     *
+     *  @param[in,out]  inReference  The object with which to swap.
+     *
+     */
+    void swap(CFURef & inReference) noexcept
+    {
+        std::swap(mReference, inReference.mReference);
+    }
+
+    /**
+     *  This routine converts the object to its reference, which
+     *  remains owned by the object, such that it may be passed
+     *  wherever the reference type is expected.
+     *
+     */
+    operator T(void) const noexcept
+    {
+        return (mReference);
+    }
+
+    /**
+     *  This routine returns an object that adopts, without
+     *  retaining, the specified reference, as returned by a
+     *  CoreFoundation "Create" or "Copy" function.
+     *
+     *  @param[in]  inReference  The reference, which may be NULL, to
+     *                           adopt.
+     *
+     *  @returns
+     *    The object owning @a inReference.
+     *
+     */
+    static CFURef Adopt(T inReference) noexcept
+    {
+        CFURef lRetval;
+
+        lRetval.mReference = inReference;
+
+        return (lRetval);
+    }
+
+private:
+    T mReference;
+};
+
+/**
+ *  This routine returns an object that adopts, without retaining,
+ *  the specified reference, as returned by a CoreFoundation "Create"
+ *  or "Copy" function, deducing its type.
+ *
+ *  @tparam     T            The CoreFoundation reference type.
+ *
+ *  @param[in]  inReference  The reference, which may be NULL, to
+ *                           adopt.
+ *
+ *  @returns
+ *    The object owning @a inReference.
+ *
+ *  @ingroup base
+ */
+template <typename T>
+inline CFURef<T>
+CFURefAdopt(T inReference) noexcept
+{
+    return (CFURef<T>::Adopt(inReference));
+}
+
+/**
+ *  This routine swaps the specified objects, without retaining or
+ *  releasing either reference, such that standard library
+ *  algorithms and containers find it through argument-dependent
+ *  lookup.
+ *
+ *  @param[in,out]  inFirst   The first object to swap.
+ *  @param[in,out]  inSecond  The second object to swap.
+ *
+ *  @ingroup base
+ */
+template <typename T>
+inline void
+swap(CFURef<T> & inFirst, CFURef<T> & inSecond) noexcept
+{
+    inFirst.swap(inSecond);
+}
+
+#endif // __cplusplus
+
+#endif // CFUTILITIES_CFUREF_HPP
@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2008-2023 Nuovation System Designs, LLC
+ *    Copyright (c) 2008-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -25,6 +25,7 @@
 #define CFUTILITIES_CFUTILITIES_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <CoreFoundation/CoreFoundation.h>
 
@@ -32,11 +33,210 @@
 extern "C" {
 #endif
 
+// Type Definitions
+
+/**
+ *  Allocation statistics gathered by an accounting allocator, either
+ *  for a single allocator or for the calling thread across all
+ *  accounting allocators.
+ *
+ *  @ingroup allocator
+ *
+ */
+typedef struct CFUAllocatorStatistics {
+    uint64_t mAllocations;     //!< The count of allocations.
+    uint64_t mDeallocations;   //!< The count of deallocations.
+    uint64_t mReallocations;   //!< The count of reallocations.
+    uint64_t mBytesAllocated;  //!< The total bytes allocated,
+                               //!< including growth by
+                               //!< reallocation.
+    int64_t  mBytesLive;       //!< The bytes currently allocated
+                               //!< and not yet deallocated.
+    int64_t  mBytesPeak;       //!< The greatest value of
+                               //!< mBytesLive observed.
+} CFUAllocatorStatistics;
+
+/**
+ *  An opaque reference to a copy-on-write working copy of a
+ *  dictionary.
+ *
+ *  @ingroup dictionary
+ *
+ */
+typedef struct __CFUDictionaryCopyOnWrite * CFUDictionaryCopyOnWriteRef;
+
+/**
+ *  An opaque reference to a property list file watcher.
+ *
+ *  @ingroup plist
+ *
+ */
+typedef struct __CFUPropertyListWatcher * CFUPropertyListWatcherRef;
+
+/**
+ *  A property list file watcher callback, invoked when the watched
+ *  property list file changes.
+ *
+ *  @param[in]  inWatcher  A reference to the watcher on which the
+ *                         change was observed.
+ *  @param[in]  inAdded    A reference to a dictionary containing the
+ *                         key/value pairs unique to the new property
+ *                         list.
+ *  @param[in]  inChanged  A reference to a dictionary containing the
+ *                         key/value pairs, with their new values,
+ *                         common to both the old and new property
+ *                         lists but whose values differ.
+ *  @param[in]  inRemoved  A reference to a dictionary containing the
+ *                         key/value pairs, with their old values,
+ *                         unique to the old property list.
+ *  @param[in]  inContext  The context pointer provided when the
+ *                         watcher was created.
+ *
+ *  @ingroup plist
+ *
+ */
+typedef void (*CFUPropertyListWatcherCallBack)(CFUPropertyListWatcherRef inWatcher,
+                                               CFDictionaryRef           inAdded,
+                                               CFDictionaryRef           inChanged,
+                                               CFDictionaryRef           inRemoved,
+                                               void *                    inContext);
+
+/**
+ *  An opaque reference to a buffered, line-oriented reader.
+ *
+ *  @ingroup string
+ *
+ */
+typedef struct __CFUStringLineReader * CFUStringLineReaderRef;
+
+/**
+ *  An opaque reference to a compiled property list schema.
+ *
+ *  @ingroup plist
+ *
+ */
+typedef struct __CFUPropertyListSchema * CFUPropertyListSchemaRef;
+
+/**
+ *  The expected type of a property list schema entry.
+ *
+ *  @ingroup plist
+ *
+ */
+typedef enum CFUPropertyListSchemaType {
+    kCFUPropertyListSchemaTypeAny,         //!< Any property list type.
+    kCFUPropertyListSchemaTypeArray,       //!< A CFArray.
+    kCFUPropertyListSchemaTypeBoolean,     //!< A CFBoolean.
+    kCFUPropertyListSchemaTypeData,        //!< A CFData.
+    kCFUPropertyListSchemaTypeDate,        //!< A CFDate.
+    kCFUPropertyListSchemaTypeDictionary,  //!< A CFDictionary.
+    kCFUPropertyListSchemaTypeNumber,      //!< A CFNumber.
+    kCFUPropertyListSchemaTypeString       //!< A CFString.
+} CFUPropertyListSchemaType;
+
+/**
+ *  Property list schema entry flags.
+ *
+ *  @ingroup plist
+ *
+ */
+enum {
+    kCFUPropertyListSchemaRequired = (1U << 0),  //!< The key must be
+                                                 //!< present.
+    kCFUPropertyListSchemaRange    = (1U << 1)   //!< The value, for a
+                                                 //!< number, or the
+                                                 //!< length or count,
+                                                 //!< otherwise, must be
+                                                 //!< within the entry
+                                                 //!< minimum and
+                                                 //!< maximum,
+                                                 //!< inclusive.
+};
+
+/**
+ *  A declarative property list schema entry, describing the value at
+ *  a single key path.
+ *
+ *  A key path is a sequence of dictionary keys separated by a
+ *  period ('.'), where a "[]" component stands for every element of
+ *  an array, such as "Servers.[].Port". The empty key path describes
+ *  the top-level object. Containers along a key path are implicitly
+ *  expected to be dictionaries or, for "[]", arrays.
+ *
+ *  @ingroup plist
+ *
+ */
+typedef struct CFUPropertyListSchemaEntry {
+    const char *              mKeyPath;  //!< The key path of the value.
+    CFUPropertyListSchemaType mType;     //!< The expected value type.
+    CFOptionFlags             mFlags;    //!< Entry flags.
+    double                    mMinimum;  //!< The range minimum, if
+                                         //!< kCFUPropertyListSchemaRange
+                                         //!< is set.
+    double                    mMaximum;  //!< The range maximum, if
+                                         //!< kCFUPropertyListSchemaRange
+                                         //!< is set.
+} CFUPropertyListSchemaEntry;
+
+/**
+ *  Limits and validation enforced while reading a property list,
+ *  guarding against hostile, oversized, or malformed data. Any limit
+ *  that is zero (0) is not enforced.
+ *
+ *  @ingroup plist
+ *
+ */
+typedef struct CFUPropertyListReadOptions {
+    CFIndex                  mMaximumDepth;      //!< The maximum nesting
+                                                 //!< depth of arrays and
+                                                 //!< dictionaries, where
+                                                 //!< a top-level
+                                                 //!< container is at
+                                                 //!< depth one (1).
+    CFIndex                  mMaximumObjects;    //!< The maximum number
+                                                 //!< of objects,
+                                                 //!< including dictionary
+                                                 //!< keys.
+    CFIndex                  mMaximumBytes;      //!< The maximum total
+                                                 //!< decoded bytes across
+                                                 //!< all strings and
+                                                 //!< data.
+    CFIndex                  mMaximumLength;     //!< The maximum decoded
+                                                 //!< bytes in any single
+                                                 //!< string or data
+                                                 //!< object.
+    CFUPropertyListSchemaRef mSchema;            //!< An optional schema
+                                                 //!< the property list
+                                                 //!< must conform to.
+    CFIndex                  mMaximumInputBytes; //!< The maximum raw,
+                                                 //!< encoded bytes read
+                                                 //!< before the property
+                                                 //!< list is abandoned,
+                                                 //!< without reading
+                                                 //!< further.
+} CFUPropertyListReadOptions;
+
+// CFAllocator Operations
+
+extern CFAllocatorRef  CFUAllocatorArenaCreate(CFAllocatorRef inAllocator, size_t inChunkSize);
+extern Boolean         CFUAllocatorArenaReset(CFAllocatorRef inArena);
+extern CFAllocatorRef  CFUAllocatorAccountingCreate(CFAllocatorRef inAllocator, CFAllocatorRef inBacking);
+extern Boolean         CFUAllocatorAccountingGetStatistics(CFAllocatorRef           inAccounting,
+                                                           CFUAllocatorStatistics * outStatistics);
+extern Boolean         CFUAllocatorAccountingResetStatistics(CFAllocatorRef inAccounting);
+extern void            CFUAllocatorAccountingGetThreadStatistics(CFUAllocatorStatistics * outStatistics);
+extern void            CFUAllocatorAccountingResetThreadStatistics(void);
+
 // CFBase Operations
 
 extern bool            CFUIsTypeID(CFTypeRef inReference, CFTypeID inID);
 
 extern void            CFURelease(CFTypeRef inReference);
+extern void            CFUReleaseDeferred(CFTypeRef inReference);
+extern void            CFUReleaseQueueFlush(void);
+extern size_t          CFUReleaseQueueDrain(void);
+extern bool            CFUReleaseQueueStartReclaimer(void);
+extern void            CFUReleaseQueueStopReclaimer(void);
 
 // CFBoolean Operations
 
@@ -52,6 +252,15 @@ extern CFDateRef       CFUDateCreate(CFAllocatorRef inAllocator, time_t inTime);
 // CFDictionary Operations
 
 extern CFArrayRef      CFUDictionaryCopyKeys(CFDictionaryRef inDictionary);
+extern CFArrayRef      CFUDictionaryCopyKeysWithAllocator(CFAllocatorRef  inAllocator,
+                                                          CFDictionaryRef inDictionary);
+extern CFUDictionaryCopyOnWriteRef CFUDictionaryCopyOnWriteCreate(CFDictionaryRef inDictionary);
+extern CFUDictionaryCopyOnWriteRef CFUDictionaryCopyOnWriteCreateWithAllocator(CFAllocatorRef  inAllocator,
+                                                                               CFDictionaryRef inDictionary);
+extern void            CFUDictionaryCopyOnWriteDestroy(CFUDictionaryCopyOnWriteRef inCopy);
+extern CFMutableDictionaryRef CFUDictionaryCopyOnWriteGetMutableDictionary(CFUDictionaryCopyOnWriteRef inCopy,
+                                                                           CFArrayRef                  inKeyPath);
+extern CFDictionaryRef CFUDictionaryCopyOnWriteCopyDictionary(CFUDictionaryCopyOnWriteRef inCopy);
 extern Boolean         CFUDictionaryMerge(CFMutableDictionaryRef inDestination,
                                           CFDictionaryRef        inSource,
                                           bool                   inReplace);
@@ -71,6 +280,12 @@ extern Boolean         CFUDictionaryDifference(CFDictionaryRef          inPropos
                                                CFMutableDictionaryRef   outAdded,
                                                CFMutableDictionaryRef   outCommon,
                                                CFMutableDictionaryRef   outRemoved);
+extern Boolean         CFUDictionaryDifferenceWithAllocator(CFAllocatorRef           inAllocator,
+                                                            CFDictionaryRef          inProposed,
+                                                            CFMutableDictionaryRef * inOutBase,
+                                                            CFMutableDictionaryRef   outAdded,
+                                                            CFMutableDictionaryRef   outCommon,
+                                                            CFMutableDictionaryRef   outRemoved);
 
 // CFNumber Operations
 
@@ -82,6 +297,11 @@ extern Boolean         CFUPropertyListReadFromFile(const char *        inPath,
                                                    CFOptionFlags       inMutability,
                                                    CFPropertyListRef * outPlist,
                                                    CFStringRef *       outError);
+extern Boolean         CFUPropertyListReadFromFileWithOptions(const char *                       inPath,
+                                                              CFOptionFlags                      inMutability,
+                                                              const CFUPropertyListReadOptions * inOptions,
+                                                              CFPropertyListRef *                outPlist,
+                                                              CFStringRef *                      outError);
 extern Boolean         CFUPropertyListWriteToFile(const char *         inPath,
                                                   bool                 inWritable,
                                                   CFPropertyListFormat inFormat,
@@ -92,11 +312,61 @@ extern Boolean         CFUPropertyListReadFromURL(CFURLRef            inURL,
                                                   CFOptionFlags       inMutability,
                                                   CFPropertyListRef * outPlist,
                                                   CFStringRef *       outError);
+extern Boolean         CFUPropertyListReadFromURLWithOptions(CFURLRef                           inURL,
+                                                             CFOptionFlags                      inMutability,
+                                                             const CFUPropertyListReadOptions * inOptions,
+                                                             CFPropertyListRef *                outPlist,
+                                                             CFStringRef *                      outError);
 extern Boolean         CFUPropertyListWriteToURL(CFURLRef             inURL,
                                                  CFPropertyListFormat inFormat,
                                                  CFPropertyListRef    inPlist,
                                                  CFStringRef *        outError);
 
+extern Boolean         CFUPropertyListReadFromFD(int                                inDescriptor,
+                                                 size_t                             inBufferSize,
+                                                 CFOptionFlags                      inMutability,
+                                                 const CFUPropertyListReadOptions * inOptions,
+                                                 CFPropertyListRef *                outPlist,
+                                                 CFStringRef *                      outError);
+extern Boolean         CFUPropertyListReadFromFDWithAllocator(CFAllocatorRef                     inAllocator,
+                                                              int                                inDescriptor,
+                                                              size_t                             inBufferSize,
+                                                              CFOptionFlags                      inMutability,
+                                                              const CFUPropertyListReadOptions * inOptions,
+                                                              CFPropertyListRef *                outPlist,
+                                                              CFStringRef *                      outError);
+extern Boolean         CFUPropertyListWriteToFD(int                  inDescriptor,
+                                                size_t               inBufferSize,
+                                                CFPropertyListFormat inFormat,
+                                                CFPropertyListRef    inPlist,
+                                                CFStringRef *        outError);
+
+extern CFUPropertyListSchemaRef CFUPropertyListSchemaCreate(const CFUPropertyListSchemaEntry * inEntries,
+                                                            size_t                             inCount,
+                                                            CFStringRef *                      outError);
+extern void            CFUPropertyListSchemaDestroy(CFUPropertyListSchemaRef inSchema);
+extern Boolean         CFUPropertyListSchemaValidate(CFUPropertyListSchemaRef inSchema,
+                                                     CFPropertyListRef        inPlist,
+                                                     CFStringRef *            outError);
+
+extern CFUPropertyListWatcherRef CFUPropertyListWatcherCreate(const char *                   inPath,
+                                                              CFOptionFlags                  inMutability,
+                                                              unsigned int                   inDebounceMilliseconds,
+                                                              CFUPropertyListWatcherCallBack inCallBack,
+                                                              void *                         inContext);
+extern CFUPropertyListWatcherRef CFUPropertyListWatcherCreateWithAllocator(CFAllocatorRef                 inAllocator,
+                                                                           const char *                   inPath,
+                                                                           CFOptionFlags                  inMutability,
+                                                                           unsigned int                   inDebounceMilliseconds,
+                                                                           CFUPropertyListWatcherCallBack inCallBack,
+                                                                           void *                         inContext);
+extern void            CFUPropertyListWatcherDestroy(CFUPropertyListWatcherRef inWatcher);
+extern int             CFUPropertyListWatcherGetFileDescriptor(CFUPropertyListWatcherRef inWatcher);
+extern CFDictionaryRef CFUPropertyListWatcherCopyPropertyList(CFUPropertyListWatcherRef inWatcher);
+extern Boolean         CFUPropertyListWatcherProcess(CFUPropertyListWatcherRef inWatcher,
+                                                     int                       inTimeoutMilliseconds,
+                                                     CFStringRef *             outError);
+
 // CFSet Operations
 
 extern bool            CFUSetIsEmptySet(CFSetRef theSet);
@@ -114,6 +384,37 @@ extern CFTreeRef       CFUTreeCreate(CFTypeRef inType);
 
 extern bool            CFUStringChomp(CFMutableStringRef inOutString);
 extern bool            CFUStringsMatch(CFStringRef aFirst, CFStringRef aSecond);
+extern bool            CFUStringsMatchIgnoringCase(CFStringRef aFirst,
+                                                   CFStringRef aSecond);
+extern bool            CFUStringHasPrefix(CFStringRef aString,
+                                          CFStringRef aPrefix,
+                                          bool        aIgnoreCase);
+extern bool            CFUStringHasSuffix(CFStringRef aString,
+                                          CFStringRef aSuffix,
+                                          bool        aIgnoreCase);
+extern size_t          CFUStringGetHash(CFStringRef aString);
+extern CFStringRef     CFUStringGetInterned(const char * inUTF8String,
+                                            size_t       inLength);
+extern CFStringRef     CFUStringGetInternedCString(const char * inUTF8String);
+extern CFStringRef     CFUStringCreateWithUTF8Bytes(CFAllocatorRef inAllocator,
+                                                    const char *   inBytes,
+                                                    size_t         inLength);
+extern CFUStringLineReaderRef CFUStringLineReaderCreateWithFD(int    inDescriptor,
+                                                              size_t inBufferSize);
+extern CFUStringLineReaderRef CFUStringLineReaderCreateWithFile(const char * inPath,
+                                                                size_t       inBufferSize);
+extern void            CFUStringLineReaderDestroy(CFUStringLineReaderRef inReader);
+extern bool            CFUStringLineReaderReadBytes(CFUStringLineReaderRef inReader,
+                                                    const UInt8 **         outBytes,
+                                                    size_t *               outLength);
+extern bool            CFUStringLineReaderCopyLine(CFUStringLineReaderRef inReader,
+                                                   CFStringEncoding       inEncoding,
+                                                   CFStringRef *          outLine);
+extern bool            CFUStringLineReaderCopyLineWithAllocator(CFAllocatorRef         inAllocator,
+                                                                CFUStringLineReaderRef inReader,
+                                                                CFStringEncoding       inEncoding,
+                                                                CFStringRef *          outLine);
+extern int             CFUStringLineReaderGetError(CFUStringLineReaderRef inReader);
 
 #ifdef __cplusplus
 }
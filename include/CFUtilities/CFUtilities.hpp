@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2008-2023 Nuovation System Designs, LLC
+ *    Copyright (c) 2008-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -26,7 +26,13 @@
 
 #ifdef __cplusplus
 
+#include <iterator>
 #include <limits>
+#include <string>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+#include <vector>
 
 #include <boost/type_traits.hpp>
 
@@ -324,16 +330,158 @@ extern Boolean CFUDictionaryDifference(CFDictionaryRef          inProposed,
                                        CFMutableDictionaryRef   outAdded,
                                        CFMutableDictionaryRef   outCommon,
                                        CFMutableDictionaryRef   outRemoved);
+extern Boolean CFUDictionaryDifference(CFAllocatorRef           inAllocator,
+                                       CFDictionaryRef          inProposed,
+                                       CFMutableDictionaryRef & inOutBase,
+                                       CFMutableDictionaryRef   outAdded,
+                                       CFMutableDictionaryRef   outCommon,
+                                       CFMutableDictionaryRef   outRemoved);
 
 extern Boolean CFUPropertyListReadFromFile(CFStringRef         inPath,
                                            CFOptionFlags       inMutability,
                                            CFPropertyListRef * outPlist,
                                            CFStringRef *       outError);
+extern Boolean CFUPropertyListReadFromFileWithOptions(CFStringRef                        inPath,
+                                                      CFOptionFlags                      inMutability,
+                                                      const CFUPropertyListReadOptions * inOptions,
+                                                      CFPropertyListRef *                outPlist,
+                                                      CFStringRef *                      outError);
 extern Boolean CFUPropertyListWriteToFile(CFStringRef          inPath,
                                           CFPropertyListFormat inFormat,
                                           CFPropertyListRef    inPlist,
                                           CFStringRef *        outError);
 
+// CFArray Operations
+
+/**
+ *  @brief
+ *    Create an array of strings from a range of UTF-8 strings.
+ *
+ *  This function template creates an immutable array, sized exactly
+ *  once, of strings created from the UTF-8 bytes of each element of
+ *  the specified range. Elements consisting only of ASCII are not
+ *  transcoded.
+ *
+ *  @tparam     Iterator     The type of a forward iterator over
+ *                           objects, such as @a std::string or @a
+ *                           std::string_view, providing @a data and
+ *                           @a size.
+ *
+ *  @param[in]  inAllocator  The allocator to use to allocate memory
+ *                           for the array and its strings.
+ *  @param[in]  inFirst      An iterator to the first element of the
+ *                           range.
+ *  @param[in]  inLast       An iterator past the last element of the
+ *                           range.
+ *
+ *  @returns
+ *    A reference to the array if OK; otherwise, NULL if any element
+ *    is not valid UTF-8. The caller owns the reference and is
+ *    responsible for releasing the object.
+ *
+ *  @ingroup array
+ *
+ */
+template <typename Iterator>
+CFArrayRef
+CFUArrayCreateWithStrings(CFAllocatorRef inAllocator,
+                          Iterator       inFirst,
+                          Iterator       inLast)
+{
+    std::vector<CFStringRef> theStrings;
+    CFStringRef              theString;
+    CFArrayRef               theArray = NULL;
+
+    theStrings.reserve(static_cast<size_t>(std::distance(inFirst, inLast)));
+
+    for (; inFirst != inLast; ++inFirst)
+    {
+        // An empty view, such as a default-constructed
+        // std::string_view, may have null data, which
+        // CFUStringCreateWithUTF8Bytes rejects.
+
+        theString = CFUStringCreateWithUTF8Bytes(inAllocator,
+                                                 ((inFirst->size() == 0) ? "" : inFirst->data()),
+                                                 inFirst->size());
+        __Require(theString != NULL, done);
+
+        theStrings.push_back(theString);
+    }
+
+    theArray = CFArrayCreate(inAllocator,
+                             reinterpret_cast<const void **>(theStrings.data()),
+                             static_cast<CFIndex>(theStrings.size()),
+                             &kCFTypeArrayCallBacks);
+
+done:
+    for (size_t i = 0; i < theStrings.size(); i++)
+    {
+        CFRelease(theStrings[i]);
+    }
+
+    return (theArray);
+}
+
+/**
+ *  @brief
+ *    Create an array of strings from a vector of UTF-8 strings.
+ *
+ *  @param[in]  inAllocator  The allocator to use to allocate memory
+ *                           for the array and its strings.
+ *  @param[in]  inStrings    A reference to the UTF-8 strings.
+ *
+ *  @returns
+ *    A reference to the array if OK; otherwise, NULL on error. The
+ *    caller owns the reference and is responsible for releasing the
+ *    object.
+ *
+ *  @sa CFUArrayCreateWithStrings(CFAllocatorRef, Iterator, Iterator)
+ *
+ *  @ingroup array
+ *
+ */
+inline CFArrayRef
+CFUArrayCreateWithStrings(CFAllocatorRef                   inAllocator,
+                          const std::vector<std::string> & inStrings)
+{
+    return (CFUArrayCreateWithStrings(inAllocator,
+                                      inStrings.begin(),
+                                      inStrings.end()));
+}
+
+#if __cplusplus >= 201703L
+/**
+ *  @brief
+ *    Create an array of strings from a vector of UTF-8 string views.
+ *
+ *  @param[in]  inAllocator  The allocator to use to allocate memory
+ *                           for the array and its strings.
+ *  @param[in]  inStrings    A reference to the UTF-8 string views.
+ *
+ *  @returns
+ *    A reference to the array if OK; otherwise, NULL on error. The
+ *    caller owns the reference and is responsible for releasing the
+ *    object.
+ *
+ *  @sa CFUArrayCreateWithStrings(CFAllocatorRef, Iterator, Iterator)
+ *
+ *  @ingroup array
+ *
+ */
+inline CFArrayRef
+CFUArrayCreateWithStrings(CFAllocatorRef                        inAllocator,
+                          const std::vector<std::string_view> & inStrings)
+{
+    return (CFUArrayCreateWithStrings(inAllocator,
+                                      inStrings.begin(),
+                                      inStrings.end()));
+}
+#endif // __cplusplus >= 201703L
+
+extern bool    CFUArrayCopyStrings(CFArrayRef            inArray,
+                                   std::string &         outBytes,
+                                   std::vector<size_t> & outOffsets);
+
 // CFString Operations
 
 extern bool    CFUStringChomp(CFMutableStringRef inOutString,
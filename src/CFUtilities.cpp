@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2008-2023 Nuovation System Designs, LLC
+ *    Copyright (c) 2008-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -21,8 +21,25 @@
  *      interacting with Apple's CoreFoundation framework.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
 #include <sys/stat.h>
 
 #include <AssertMacros.h>
@@ -31,11 +48,21 @@
 
 #include <CFUtilities/CFUtilities.h>
 #include <CFUtilities/CFUtilities.hpp>
+#include <CFUtilities/CFStaticString.hpp>
 
 #if defined(HAVE_CONFIG_H)
 #include "CFUtilities/CFUConfig.h"
 #endif
 
+#if HAVE_SYS_INOTIFY_H
+#include <sys/inotify.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CFUTILITIES_STRING_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
 
 using namespace std;
 
@@ -162,864 +189,1134 @@ struct CFUSetContext {
     // clang-format on
 };
 
-// MARK: Global Variables
-
-static const CFTreeContext kCFUTreeContextInitializer = { 0, 0, 0, 0, 0 };
-
-
 /**
- *  This routine checks the type of the specified CoreFoundation
- *  reference against the specified type.
- *
- *  @param[in]  inReference  A CoreFoundation reference to type check.
- *  @param[in]  inID         The CoreFoundation type identifier to check
- *                           the reference type against.
- *
- *  @returns
- *    True if the specified reference matches the provided type;
- *    otherwise, false.
- *
- *  @ingroup base
+ *  Context for scanning raw property list data against read limits.
  *
+ *  @private
  */
-bool
-CFUIsTypeID(CFTypeRef inReference, CFTypeID inID)
-{
-    bool status = false;
-
-    __Require_Quiet(inReference != nullptr, done);
-
-    status = (CFGetTypeID(inReference) == inID);
-
-done:
-    return (status);
-}
+struct CFUPropertyListLimitsContext {
+    // clang-format off
+    const CFUPropertyListReadOptions * mOptions;   //!< The limits to
+                                                   //!< enforce.
+    uint64_t                           mObjects;   //!< The count of
+                                                   //!< objects scanned.
+    uint64_t                           mBytes;     //!< The total decoded
+                                                   //!< string and data
+                                                   //!< bytes scanned.
+    const char *                       mViolation; //!< A description of
+                                                   //!< the limit
+                                                   //!< violated, if any.
+    // clang-format on
+};
 
 /**
- *  @brief
- *    Releases a reference to a Core Foundation object.
- *
- *  This routine attempts to release the specified CoreFoundation
- *  object.
- *
- *  @note
- *    In contrast to the @a CFRelease interface, a null reference results
- *    in no action being taken.
- *
- *  @param[in,out]  inReference  A reference to the CoreFoundation
- *                               object to release. On success, if
- *                               @a inReference is non-null, the
- *                               reference is released.
- *
- *  @ingroup base
+ *  A traversal stack frame for determining the nesting depth of a
+ *  binary property list.
  *
+ *  @private
  */
-void
-CFURelease(CFTypeRef inReference)
-{
-    if (inReference != nullptr) {
-        CFRelease(inReference);
-    }
-}
+struct CFUPropertyListBinaryFrame {
+    // clang-format off
+    uint64_t mObject;  //!< The index of the container object.
+    uint64_t mFirst;   //!< The offset of its first object reference.
+    uint64_t mCount;   //!< The count of its object references.
+    uint64_t mNext;    //!< The index of the next reference to visit.
+    int64_t  mHeight;  //!< The greatest height among visited children.
+    // clang-format on
+};
 
 /**
- *  This routine returns a reference to a CoreFoundation Boolean
- *  object equivalent to the specified Boolean value.
- *
- *  @param[in] inBoolean  A Boolean value for which the corresponding
- *                        CoreFoundation Boolean object reference is
- *                        to be returned.
- *
- *  @returns
- *    kCFBooleanTrue if true; otherwise, kCFBooleanFalse.
+ *  A copy-on-write working copy of a dictionary.
  *
- *  @ingroup boolean
+ *  @private
+ */
+struct __CFUDictionaryCopyOnWrite {
+    // clang-format off
+    CFDictionaryRef mRoot;       //!< The top-level dictionary, either
+                                 //!< shared or a clone.
+    CFMutableSetRef mOwned;      //!< The dictionaries cloned since the
+                                 //!< last snapshot, which alone may be
+                                 //!< mutated in place.
+    CFAllocatorRef  mAllocator;  //!< The allocator with which clones
+                                 //!< are created.
+    // clang-format on
+};
+
+/**
+ *  A compiled property list schema node, describing the value at a
+ *  single key path component.
  *
+ *  @private
  */
-CFBooleanRef
-CFUBooleanCreate(bool inBoolean)
-{
-    return (inBoolean ? kCFBooleanTrue : kCFBooleanFalse);
-}
+struct CFUPropertyListSchemaNode {
+    // clang-format off
+    string                    mName;      //!< The key path component,
+                                          //!< for error reporting.
+    CFStringRef               mKey;       //!< The dictionary key, or
+                                          //!< null for the top-level
+                                          //!< object or an array
+                                          //!< element.
+    CFUPropertyListSchemaType mType;      //!< The expected value type.
+    CFTypeID                  mTypeID;    //!< The expected type
+                                          //!< identifier, or zero (0)
+                                          //!< for any type.
+    CFOptionFlags             mFlags;     //!< Entry flags.
+    double                    mMinimum;   //!< The range minimum.
+    double                    mMaximum;   //!< The range maximum.
+    bool                      mDeclared;  //!< Whether the node was
+                                          //!< explicitly declared
+                                          //!< rather than implied by a
+                                          //!< descendant key path.
+    vector<size_t>            mChildren;  //!< The indices of the child
+                                          //!< nodes.
+    // clang-format on
+};
 
 /**
- *  This routine converts the specified CoreFoundation absolute time
- *  into an equivalent POSIX time.
+ *  A compiled property list schema: a flattened tree of nodes, the
+ *  first of which describes the top-level object.
  *
- *  @param[in]  inAt  The CoreFoundation absolute time to convert.
+ *  @private
+ */
+struct __CFUPropertyListSchema {
+    // clang-format off
+    vector<CFUPropertyListSchemaNode> mNodes;  //!< The schema nodes.
+    // clang-format on
+};
+
+/**
+ *  Iterator context used for filtering common property list watcher
+ *  differences down to those whose values have actually changed.
  *
- *  @returns
- *    The POSIX time.
+ *  @private
+ */
+struct CFUPropertyListWatcherChangedContext {
+    // clang-format off
+    CFDictionaryRef        mProposed;        //!< A reference to the newly-
+                                             //!< read property list.
+    CFMutableDictionaryRef mChanged;         //!< A reference to the mutable
+                                             //!< dictionary containing
+                                             //!< entries common to both
+                                             //!< property lists but whose
+                                             //!< values differ.
+    // clang-format on
+};
+
+/**
+ *  State for a property list file watcher.
  *
- *  @sa CFUPOSIXTimeGetAbsoluteTime
+ *  @private
+ */
+struct __CFUPropertyListWatcher {
+    // clang-format off
+    int                            mDescriptor;   //!< The inotify descriptor.
+    int                            mWatch;        //!< The inotify watch
+                                                  //!< descriptor for the
+                                                  //!< parent directory.
+    string                         mPath;         //!< The path of the
+                                                  //!< watched file.
+    string                         mName;         //!< The last path
+                                                  //!< component of the
+                                                  //!< watched file.
+    CFOptionFlags                  mMutability;   //!< The degree of
+                                                  //!< mutability with which
+                                                  //!< to read the file.
+    unsigned int                   mDebounce;     //!< The quiet period, in
+                                                  //!< milliseconds, a burst
+                                                  //!< of writes must settle
+                                                  //!< for before a reload.
+    CFUPropertyListWatcherCallBack mCallBack;     //!< The change callback.
+    void *                         mContext;      //!< The change callback
+                                                  //!< context.
+    CFDictionaryRef                mPropertyList; //!< The most-recently
+                                                  //!< read property list.
+    CFAllocatorRef                 mAllocator;    //!< The allocator with
+                                                  //!< which to create
+                                                  //!< property lists and
+                                                  //!< their differences.
+    // clang-format on
+};
+
+/**
+ *  An interned string: a canonical, immortal CoreFoundation string
+ *  for a UTF-8 byte sequence, chained in an interning table bucket.
  *
- *  @ingroup date-time
+ *  The entry is allocated with its bytes inline, which also back
+ *  the string where CoreFoundation can use them without copying.
  *
+ *  @private
  */
-time_t
-CFUAbsoluteTimeGetPOSIXTime(CFAbsoluteTime inAt)
-{
-    return (static_cast<time_t>(inAt + kCFAbsoluteTimeIntervalSince1970));
-}
+struct CFUStringInternEntry {
+    // clang-format off
+    CFUStringInternEntry * mNext;      //!< The next entry in the bucket.
+    size_t                 mHash;      //!< The hash of the bytes.
+    size_t                 mLength;    //!< The length, in bytes, of
+                                       //!< the bytes.
+    CFStringRef            mString;    //!< The interned string.
+    char                   mBytes[1];  //!< The UTF-8 bytes, extending
+                                       //!< past the end of the entry.
+    // clang-format on
+};
 
 /**
- *  This routine converts the specified POSIX time into an
- *  equivalent CoreFoundation absolute time.
- *
- *  @param[in]  inTime  The POSIX time to convert.
+ *  State for a buffered, line-oriented reader.
  *
- *  @returns
- *    The CoreFoundation absolute time.
+ *  The buffer holds unconsumed bytes in [mStart, mEnd), of which
+ *  [mStart, mScan) are already known to contain no line feed, such
+ *  that refilling the buffer never rescans them.
  *
- *  @sa CFUAbsoluteTimeGetPOSIXTime
+ *  @private
+ */
+struct __CFUStringLineReader {
+    // clang-format off
+    int           mDescriptor;      //!< The descriptor read from.
+    bool          mOwnsDescriptor;  //!< Whether the reader closes
+                                    //!< mDescriptor when destroyed.
+    bool          mAtEnd;           //!< Whether end-of-file has been
+                                    //!< read.
+    int           mError;           //!< The error, if any, that ended
+                                    //!< reading.
+    vector<UInt8> mBuffer;          //!< The read buffer.
+    size_t        mStart;           //!< The offset of the first
+                                    //!< unconsumed byte.
+    size_t        mScan;            //!< The offset from which to
+                                    //!< resume searching for a line
+                                    //!< feed.
+    size_t        mEnd;             //!< The offset past the last
+                                    //!< buffered byte.
+    // clang-format on
+};
+
+/**
+ *  State shared by all threads for deferred release: batches of
+ *  references handed off by threads and awaiting release, spare
+ *  batch storage for reuse, and the optional reclaimer thread.
  *
- *  @ingroup date-time
+ *  The state is allocated once and never destroyed, such that
+ *  threads exiting after static destruction may still hand off
+ *  their queues.
  *
+ *  @private
  */
-CFAbsoluteTime
-CFUPOSIXTimeGetAbsoluteTime(time_t inTime)
-{
-    return (static_cast<CFAbsoluteTime>(inTime) - kCFAbsoluteTimeIntervalSince1970);
-}
+struct CFUReleaseQueueState {
+    // clang-format off
+    pthread_mutex_t            mMutex;      //!< Protects all other members.
+    pthread_cond_t             mCondition;  //!< Signals the reclaimer
+                                            //!< when a batch is handed off
+                                            //!< or it is to stop.
+    vector<vector<CFTypeRef> > mPending;    //!< Batches awaiting release.
+    vector<vector<CFTypeRef> > mSpare;      //!< Released, empty batches
+                                            //!< for reuse.
+    pthread_t                  mReclaimer;  //!< The reclaimer thread.
+    bool                       mRunning;    //!< Whether the reclaimer
+                                            //!< thread is running.
+    bool                       mStopping;   //!< Whether the reclaimer
+                                            //!< thread is to stop.
+    // clang-format on
+};
 
 /**
- *  This routine converts the specified CoreFoundation date
- *  reference into an equivalent POSIX time.
+ *  A thread's queue of references whose release is deferred, handed
+ *  off for release when the thread exits.
  *
- *  @param[in]  inDate  The CoreFoundation date reference to convert.
+ *  @private
+ */
+struct CFUReleaseQueue {
+    ~CFUReleaseQueue(void);
+
+    // clang-format off
+    vector<CFTypeRef> mReferences;  //!< The references to release.
+    // clang-format on
+};
+
+/**
+ *  A chunk of arena allocator storage, from which allocations are
+ *  carved by advancing a cursor. The storage immediately follows the
+ *  chunk header.
  *
- *  @returns
- *    The POSIX time.
+ *  @private
+ */
+struct CFUAllocatorArenaChunk {
+    // clang-format off
+    CFUAllocatorArenaChunk * mNext;  //!< The previously-current chunk,
+                                     //!< if any.
+    size_t                   mSize;  //!< The size, in bytes, of the
+                                     //!< chunk storage.
+    // clang-format on
+};
+
+/**
+ *  The state of an arena allocator, serving as the allocator context
+ *  information.
  *
- *  @ingroup date-time
+ *  @private
+ */
+struct CFUAllocatorArena {
+    // clang-format off
+    pthread_mutex_t          mMutex;        //!< Protects all other
+                                            //!< members.
+    size_t                   mChunkSize;    //!< The size, in bytes, of
+                                            //!< each regular chunk.
+    CFUAllocatorArenaChunk * mChunks;       //!< The current chunk, the
+                                            //!< head of the list of all
+                                            //!< chunks.
+    uint8_t *                mCursor;       //!< The next free byte in
+                                            //!< the current chunk.
+    uint8_t *                mLimit;        //!< The end of the current
+                                            //!< chunk.
+    uint8_t *                mLast;         //!< The most recent
+                                            //!< allocation, which alone
+                                            //!< may be grown in place or
+                                            //!< rolled back.
+    size_t                   mOutstanding;  //!< The count of
+                                            //!< allocations not yet
+                                            //!< deallocated.
+    // clang-format on
+};
+
+/**
+ *  The state of an accounting allocator, serving as the allocator
+ *  context information.
  *
+ *  @private
  */
-time_t
-CFUDateGetPOSIXTime(CFDateRef inDate)
-{
-    time_t tempTime = 0;
+struct CFUAllocatorAccounting {
+    // clang-format off
+    CFAllocatorRef   mBacking;         //!< The allocator to which
+                                       //!< requests are forwarded.
+    atomic<uint64_t> mAllocations;     //!< The count of allocations.
+    atomic<uint64_t> mDeallocations;   //!< The count of deallocations.
+    atomic<uint64_t> mReallocations;   //!< The count of reallocations.
+    atomic<uint64_t> mBytesAllocated;  //!< The total bytes allocated.
+    atomic<int64_t>  mBytesLive;       //!< The bytes currently
+                                       //!< allocated.
+    atomic<int64_t>  mBytesPeak;       //!< The greatest value of
+                                       //!< mBytesLive observed.
+    // clang-format on
+};
 
-    __Require(inDate != nullptr, done);
+// MARK: Global Variables
 
-    tempTime = CFUAbsoluteTimeGetPOSIXTime(CFDateGetAbsoluteTime(inDate));
+static const CFTreeContext kCFUTreeContextInitializer = { 0, 0, 0, 0, 0 };
+
+static const size_t        kCFUPropertyListDefaultBufferSize = 4096;
+
+static const size_t        kCFUStringLineReaderDefaultBufferSize = 16384;
+
+#if HAVE_SYS_INOTIFY_H
+/*
+ * A watched file rewritten more often than the debounce period never
+ * settles; it is reloaded anyway after this many debounce periods.
+ */
+static const unsigned int  kCFUPropertyListWatcherMaximumSettlePeriods = 4;
+#endif // HAVE_SYS_INOTIFY_H
+
+static const size_t        kCFUReleaseQueueBatchSize    = 256;
+static const size_t        kCFUReleaseQueueMaximumSpare = 16;
+
+/*
+ * Each arena allocation is preceded by a header recording its size
+ * and is aligned as malloc would align it.
+ */
+static const size_t        kCFUAllocatorArenaAlignment        = 16;
+static const size_t        kCFUAllocatorArenaHeaderSize       = 16;
+static const size_t        kCFUAllocatorArenaDefaultChunkSize = 65536;
+
+/*
+ * Each accounting allocation is preceded by a header recording its
+ * size, preserving the alignment of the backing allocator.
+ */
+static const size_t        kCFUAllocatorAccountingHeaderSize = 16;
+
+/*
+ * The string interning table is a fixed array of append-only,
+ * lock-free bucket chains. Entries are never removed, so lookups
+ * need neither locks nor reclamation. The bucket count must be a
+ * power of two.
+ */
+static const size_t        kCFUStringInternBuckets = 4096;
+
+static atomic<CFUStringInternEntry *> sCFUStringInternTable[kCFUStringInternBuckets];
 
-done:
-    return (tempTime);
-}
 
 /**
- *  This routine creates a CoreFoundation date object from the
- *  specified POSIX time.
- *
- *  @param[in]  inAllocator  The allocator with which to create the
- *                           CoreFoundation date object.
- *  @param[in]  inTime       The POSIX time to convert.
- *
- *  @returns
- *    A reference to a CoreFoundation date object if OK; otherwise, null.
- *
- *  @ingroup date-time
+ *  This routine rounds the specified size up to the arena allocator
+ *  alignment.
  *
+ *  @private
  */
-CFDateRef
-CFUDateCreate(CFAllocatorRef inAllocator, time_t inTime)
+static inline size_t
+CFUAllocatorArenaRound(size_t inSize)
 {
-    return (CFDateCreate(inAllocator, CFUPOSIXTimeGetAbsoluteTime(inTime)));
+    return ((inSize + (kCFUAllocatorArenaAlignment - 1)) & ~(kCFUAllocatorArenaAlignment - 1));
 }
 
 /**
- *  This routine returns a new array containing all the keys in the
- *  specified dictionary. The caller owns the returned array.
- *
- *  @param[in]  inDictionary  A reference to the dictionary to get the
- *                            keys from.
+ *  This routine returns a pointer to the storage of the specified
+ *  arena allocator chunk.
  *
- *  @returns
- *    A reference to an array containing the keys on success;
- *    otherwise, null on error.
- *
- *  @ingroup dictionary
+ *  @private
+ */
+static inline uint8_t *
+CFUAllocatorArenaChunkGetStorage(CFUAllocatorArenaChunk * inChunk)
+{
+    return (reinterpret_cast<uint8_t *>(inChunk) +
+            CFUAllocatorArenaRound(sizeof (CFUAllocatorArenaChunk)));
+}
+
+/**
+ *  This routine is the arena allocator allocate callback. It carves
+ *  the allocation from the current chunk, first allocating a new
+ *  chunk if the current one has insufficient space remaining.
  *
+ *  @private
  */
-CFArrayRef
-CFUDictionaryCopyKeys(CFDictionaryRef inDictionary)
+static void *
+CFUAllocatorArenaAllocate(CFIndex inSize, CFOptionFlags inHint, void * inInfo)
 {
-    CFIndex              numKeys;
-    vector<const void *> theKeys;
-    CFArrayRef           arrayRef = nullptr;
+    CFUAllocatorArena * const theArena  = static_cast<CFUAllocatorArena *>(inInfo);
+    const size_t              theSize   = CFUAllocatorArenaRound(static_cast<size_t>(inSize));
+    const size_t              theNeeded = theSize + kCFUAllocatorArenaHeaderSize;
+    uint8_t *                 theResult = nullptr;
 
-    __Require(inDictionary != nullptr, done);
+    (void)inHint;
 
-    numKeys = CFDictionaryGetCount(inDictionary);
+    __Require(inSize > 0, done);
 
-    theKeys.reserve(static_cast<size_t>(numKeys));
+    pthread_mutex_lock(&theArena->mMutex);
 
-    CFDictionaryGetKeysAndValues(inDictionary, &theKeys[0], nullptr);
+    if (static_cast<size_t>(theArena->mLimit - theArena->mCursor) < theNeeded)
+    {
+        // Any space remaining in the current chunk is abandoned. An
+        // allocation larger than a regular chunk gets a chunk of its
+        // own.
 
-    arrayRef = CFArrayCreate(kCFAllocatorDefault,
-                             &theKeys[0],
-                             numKeys,
-                             &kCFTypeArrayCallBacks);
+        const size_t             theChunkSize = max(theArena->mChunkSize, theNeeded);
+        CFUAllocatorArenaChunk * theChunk;
 
-done:
-    return (arrayRef);
+        theChunk = static_cast<CFUAllocatorArenaChunk *>(malloc(CFUAllocatorArenaRound(sizeof (CFUAllocatorArenaChunk)) +
+                                                                theChunkSize));
+        __Require(theChunk != nullptr, unlock);
+
+        theChunk->mNext    = theArena->mChunks;
+        theChunk->mSize    = theChunkSize;
+
+        theArena->mChunks  = theChunk;
+        theArena->mCursor  = CFUAllocatorArenaChunkGetStorage(theChunk);
+        theArena->mLimit   = theArena->mCursor + theChunkSize;
+        theArena->mLast    = nullptr;
+    }
+
+    *reinterpret_cast<size_t *>(theArena->mCursor) = theSize;
+
+    theResult = theArena->mCursor + kCFUAllocatorArenaHeaderSize;
+
+    theArena->mCursor += theNeeded;
+    theArena->mLast    = theResult;
+    theArena->mOutstanding++;
+
+ unlock:
+    pthread_mutex_unlock(&theArena->mMutex);
+
+ done:
+    return (theResult);
 }
 
 /**
- *  This routine is a CoreFoundation dictionary applier function
- *  that iterates on each entry in a source dictionary and performs
- *  the actual merge of those entries with a destination dictionary.
- *
- *  @param[in]      inKey      A pointer to the key of the current
- *                             key/value pair being iterated upon.
- *  @param[in]      inValue    A pointer to the value of the current
- *                             key/value pair being iterated upon.
- *  @param[in,out]  inContext  A pointer to the iterator context. On
- *                             completion, the context's dictionary
- *                             member will have been updated with the
- *                             results of the current key/value pair
- *                             iteration merge.
+ *  This routine is the arena allocator deallocate callback. Storage
+ *  is reclaimed only when the most recent allocation is deallocated;
+ *  otherwise, it is reclaimed when the arena is reset or destroyed.
  *
+ *  @private
  */
 static void
-CFUDictionaryMergeApplier(const void * inKey,
-                          const void * inValue,
-                          void *       inContext)
+CFUAllocatorArenaDeallocate(void * inPointer, void * inInfo)
 {
-    CFUDictionaryMergeContext * theContext = nullptr;
-    bool                        hasKey;
+    CFUAllocatorArena * const theArena   = static_cast<CFUAllocatorArena *>(inInfo);
+    uint8_t * const           thePointer = static_cast<uint8_t *>(inPointer);
 
-    __Require(inKey     != nullptr, done);
-    __Require(inContext != nullptr, done);
-
-    theContext = static_cast<CFUDictionaryMergeContext *>(inContext);
+    __Require_Quiet(thePointer != nullptr, done);
 
-    hasKey = CFDictionaryContainsKey(theContext->mDestinationDictionary, inKey);
+    pthread_mutex_lock(&theArena->mMutex);
 
-    /*
-     * If the key is absent or if the key is present and replacement
-     * has been requested, add or replace the key/value pair as
-     * appropriate.
-     */
+    if (thePointer == theArena->mLast)
+    {
+        theArena->mCursor = thePointer - kCFUAllocatorArenaHeaderSize;
+        theArena->mLast   = nullptr;
+    }
 
-    if (!hasKey) {
-        CFDictionaryAddValue(theContext->mDestinationDictionary,
-                             inKey,
-                             inValue);
+    theArena->mOutstanding--;
 
-    } else if (hasKey && theContext->mReplace) {
-        CFDictionaryReplaceValue(theContext->mDestinationDictionary,
-                                 inKey,
-                                 inValue);
-    }
+    pthread_mutex_unlock(&theArena->mMutex);
 
-done:
+ done:
     return;
 }
 
 /**
- *  This routine is a CoreFoundation dictionary applier function that
- *  iterates on each key/value pair of an added, common, removed
- *  difference dictionary (likely generated from
- *  #CFUDictionaryDifference) and applies the difference to the base
- *  dictionary as appropriate for the current algorithm phase.
-
- *
- *  @param[in]      inKey      A pointer to the key of the current
- *                             key/value pair being iterated upon.
- *  @param[in]      inValue    A pointer to the value of the current
- *                             key/value pair being iterated upon.
- *  @param[in,out]  inContext  A pointer to the iterator context. On
- *                             completion and depending on the context
- *                             phase, the add phase will add those
- *                             key/value pairs to the base; the remove
- *                             phase will remove those key/value pairs
- *                             from the base; and the phase will
- *                             replace those key/value pairs for which
- *                             the value is different in the common
- *                             relative to the base with the value
- *                             from the common.
+ *  This routine is the arena allocator reallocate callback. The most
+ *  recent allocation is resized in place where the current chunk
+ *  permits, as is any allocation that shrinks; otherwise, the
+ *  allocation is moved.
  *
  *  @private
- *
  */
-static void
-CFUDictionaryMergeWithDifferencesApplier(const void * inKey,
-                                         const void * inValue,
-                                         void *       inContext)
+static void *
+CFUAllocatorArenaReallocate(void * inPointer, CFIndex inSize, CFOptionFlags inHint, void * inInfo)
 {
-    CFStringRef                                 theKey     =
-        static_cast<CFStringRef>(inKey);
-    CFTypeRef                                   theValue   =
-        static_cast<CFTypeRef>(inValue);
-    CFUDictionaryMergeWithDifferencesContext *  theContext =
-        static_cast<CFUDictionaryMergeWithDifferencesContext *>(inContext);
+    CFUAllocatorArena * const theArena   = static_cast<CFUAllocatorArena *>(inInfo);
+    uint8_t * const           thePointer = static_cast<uint8_t *>(inPointer);
+    const size_t              theSize    = CFUAllocatorArenaRound(static_cast<size_t>(inSize));
+    size_t * const            theHeader  = reinterpret_cast<size_t *>(thePointer - kCFUAllocatorArenaHeaderSize);
+    void *                    theResult  = nullptr;
 
-    __Require(theKey     != nullptr, done);
-    __Require(theValue   != nullptr, done);
-    __Require(theContext != nullptr, done);
+    __Require(inSize > 0, done);
 
-    // If the phase is add, set the key/value pair.
-    //
-    // If the phase is common, replace the key/value pair if unequal.
-    //
-    // If the phase is remove, remove the key/value pair.
+    pthread_mutex_lock(&theArena->mMutex);
 
-    if (theContext->mPhase == kCFUDictionaryDifferencePhaseAdd)
+    if (thePointer == theArena->mLast)
     {
-        CFDictionarySetValue(theContext->mDestinationDictionary, theKey, theValue);
+        if (theSize <= static_cast<size_t>(theArena->mLimit - thePointer))
+        {
+            theArena->mCursor = thePointer + theSize;
+            *theHeader        = theSize;
+            theResult         = thePointer;
+        }
     }
-    else if (theContext->mPhase == kCFUDictionaryDifferencePhaseCommon)
+    else if (theSize <= *theHeader)
     {
-        CFTypeRef      theCurrentValue;
-        Boolean        lEqual;
-
-        theCurrentValue = static_cast<CFTypeRef>(CFDictionaryGetValue(theContext->mDestinationDictionary, theKey));
-        __Require(theCurrentValue != nullptr, done);
+        theResult = thePointer;
+    }
 
-        lEqual = CFEqual(theCurrentValue, theValue);
+    pthread_mutex_unlock(&theArena->mMutex);
 
-        if (!lEqual)
-        {
-            CFDictionaryReplaceValue(theContext->mDestinationDictionary, theKey, theValue);
-        }
-    }
-    else if (theContext->mPhase == kCFUDictionaryDifferencePhaseRemove)
+    if (theResult == nullptr)
     {
-        CFDictionaryRemoveValue(theContext->mDestinationDictionary, theKey);
+        theResult = CFUAllocatorArenaAllocate(inSize, inHint, inInfo);
+        __Require(theResult != nullptr, done);
+
+        memcpy(theResult, thePointer, min(*theHeader, theSize));
+
+        CFUAllocatorArenaDeallocate(thePointer, inInfo);
     }
 
  done:
-    return;
+    return (theResult);
 }
 
 /**
- *  This routine is a CoreFoundation array applier function that
- *  iterates on each value of a removed keys array and applies them
- *  difference to the base dictionary, as appropriate for the current
- *  algorithm phase, by removing the corresponding key/value pairs
- *  from the base dictionary.
- *
- *  @param[in]      inValue    A pointer to the current value being
- *                             iterated upon. This value is actually a
- *                             dictionary key.
- *  @param[in,out]  inContext  A pointer to the iterator context. On
- *                             completion and depending on the context
- *                             phase, the remove phase will remove
- *                             those key/value pairs from the base.
+ *  This routine is the arena allocator context release callback,
+ *  invoked when the allocator itself is deallocated, which frees
+ *  every chunk and the arena state.
  *
  *  @private
- *
  */
 static void
-CFUDictionaryMergeWithDifferencesApplierAndRemovedKeysApplier(const void * inValue,
-                                                              void *       inContext)
+CFUAllocatorArenaDestroy(const void * inInfo)
 {
-    // Note that that since this actually matches the signature of an
-    // array applier, in this context, the array values are actually
-    // dictionary keys. Consequently, the local is named accordingly.
-
-    CFDictionaryRef                             theKey     =
-        static_cast<CFDictionaryRef>(inValue);
-    CFUDictionaryMergeWithDifferencesContext *  theContext =
-        static_cast<CFUDictionaryMergeWithDifferencesContext *>(inContext);
+    CFUAllocatorArena * const theArena = static_cast<CFUAllocatorArena *>(const_cast<void *>(inInfo));
+    CFUAllocatorArenaChunk *  theChunk = theArena->mChunks;
 
-    __Require(theKey     != nullptr, done);
-    __Require(theContext != nullptr, done);
+    while (theChunk != nullptr)
+    {
+        CFUAllocatorArenaChunk * const theNext = theChunk->mNext;
 
-    // There is only work to do in this case for the removal
-    // phase. Other phases are handled with other applier functions.
+        free(theChunk);
 
-    if (theContext->mPhase == kCFUDictionaryDifferencePhaseRemove)
-    {
-        CFDictionaryRemoveValue(theContext->mDestinationDictionary, theKey);
+        theChunk = theNext;
     }
 
- done:
-    return;
+    pthread_mutex_destroy(&theArena->mMutex);
+
+    delete theArena;
 }
 
 /**
  *  @brief
- *    Merge a CoreFoundation dictionary from one or more difference
- *    dictionaries.
- *
- *  This routine merges a mutable CoreFoundation dictionary from one
- *  or more difference dictionaries (likely generated from
- *  #CFUDictionaryDifference). If present, key/value pairs in the @a
- *  inAdded dictionary are added to @a inOutBase and, if present,
- *  key/value pairs in the @a inCommon dictionary replace those in @a
- *  inOutBase if the values are different.
+ *    Create an arena allocator.
+ *
+ *  This routine creates a CoreFoundation allocator that carves
+ *  allocations sequentially from large chunks of memory and frees
+ *  them all at once, when the arena is reset or destroyed, rather
+ *  than one at a time.
+ *
+ *  Allocating from an arena costs little more than advancing a
+ *  pointer and deallocating costs nothing, which suits short-lived,
+ *  request-scoped object graphs: create the objects with the arena,
+ *  release them as usual when the request completes, and then reset
+ *  the arena with #CFUAllocatorArenaReset to reuse its memory.
+ *  Memory deallocated other than in the reverse order of allocation
+ *  is not reused until then, so an arena is ill-suited to
+ *  long-lived or frequently mutated objects.
+ *
+ *  The allocator may be used from multiple threads.
+ *
+ *  @param[in]  inAllocator  The allocator with which to allocate the
+ *                           arena allocator object itself. Pass null
+ *                           or kCFAllocatorDefault to use the
+ *                           current default allocator.
+ *  @param[in]  inChunkSize  The size, in bytes, of each chunk of
+ *                           memory the arena allocates. If zero (0),
+ *                           a default size is used. Allocations
+ *                           larger than a chunk are given a chunk of
+ *                           their own.
  *
- *  @param[in,out]  inOutBase  A reference to the mutable dictionary
- *                             to merge keys and values to. On
- *                             success, @a inOutBase contains a
- *                             reference to the destination dictionary
- *                             with entries from the added and common
- *                             dictionaries merged in.
- *  @param[out]     inAdded    An optional reference to the dictionary
- *                             containing entries to be added to the
- *                             base dictionary. If null, no such
- *                             entries will be added.
- *  @param[in]      inCommon   An optional reference to the dictionary
- *                             containing entries common to the base
- *                             dictionary, but potentially with
- *                             different values. Values that are
- *                             different will replace those in the
- *                             base. If null, no such entries will be
- *                             replaced.
+ *  @returns
+ *    A reference to the arena allocator on success, which the caller
+ *    owns and is responsible for releasing; otherwise, null on error.
+ *    The arena memory is freed once the allocator is released and
+ *    every object created with it has been deallocated.
  *
- *  @private
+ *  @ingroup allocator
  *
  */
-static void
-CFUDictionaryMerge(CFUDictionaryMergeWithDifferencesContext &  inOutContext,
-                   CFMutableDictionaryRef                      inOutBase,
-                   CFDictionaryRef                             inAdded,
-                   CFDictionaryRef                             inCommon)
+CFAllocatorRef
+CFUAllocatorArenaCreate(CFAllocatorRef inAllocator, size_t inChunkSize)
 {
-    inOutContext.mDestinationDictionary = inOutBase;
+    CFUAllocatorArena * theArena     = nullptr;
+    CFAllocatorRef      theAllocator = nullptr;
+    CFAllocatorContext  theContext;
 
-    if (inAdded != nullptr)
-    {
-        // Add new values
+    theArena = new (std::nothrow) CFUAllocatorArena();
+    __Require(theArena != nullptr, done);
 
-        inOutContext.mPhase = kCFUDictionaryDifferencePhaseAdd;
+    pthread_mutex_init(&theArena->mMutex, nullptr);
 
-        CFDictionaryApplyFunction(inAdded,
-                                  CFUDictionaryMergeWithDifferencesApplier,
-                                  &inOutContext);
-    }
+    theArena->mChunkSize   = ((inChunkSize == 0) ?
+                              kCFUAllocatorArenaDefaultChunkSize :
+                              CFUAllocatorArenaRound(inChunkSize));
+    theArena->mChunks      = nullptr;
+    theArena->mCursor      = nullptr;
+    theArena->mLimit       = nullptr;
+    theArena->mLast        = nullptr;
+    theArena->mOutstanding = 0;
 
-    if (inCommon != nullptr)
-    {
-        // Update common values;
+    memset(&theContext, 0, sizeof (theContext));
 
-        inOutContext.mPhase = kCFUDictionaryDifferencePhaseCommon;
+    theContext.info       = theArena;
+    theContext.release    = CFUAllocatorArenaDestroy;
+    theContext.allocate   = CFUAllocatorArenaAllocate;
+    theContext.reallocate = CFUAllocatorArenaReallocate;
+    theContext.deallocate = CFUAllocatorArenaDeallocate;
 
-        CFDictionaryApplyFunction(inCommon,
-                                  CFUDictionaryMergeWithDifferencesApplier,
-                                  &inOutContext);
-    }
+    theAllocator = CFAllocatorCreate(inAllocator, &theContext);
+    __Require_Action(theAllocator != nullptr, done, CFUAllocatorArenaDestroy(theArena));
+
+ done:
+    return (theAllocator);
 }
 
 /**
  *  @brief
- *    Merge a CoreFoundation dictionary from one or more difference
- *    dictionaries.
+ *    Reset an arena allocator.
  *
- *  This routine merges a mutable CoreFoundation dictionary from one
- *  or more difference dictionaries (likely generated from
- *  #CFUDictionaryDifference). If present, key/value pairs in the @a
- *  inAdded dictionary are added to @a inOutBase; if present,
- *  key/value pairs in the @a inCommon dictionary replace those in @a
- *  inOutBase if the values are different; and, if present, key/value
- *  pairs in the @a inRemoved dictionary are removed from @a
- *  inOutBase.
+ *  This routine frees, at once, all of the memory allocated from the
+ *  specified arena allocator, retaining a single chunk for reuse by
+ *  subsequent allocations. The cost is proportional to the number of
+ *  chunks, not the number of allocations.
  *
- *  @param[in,out]  inOutBase  A reference to the mutable dictionary
- *                             to merge keys and values to. On
- *                             success, @a inOutBase contains
- *                             a reference to the destination
- *                             dictionary with entries from the
- *                             added, common, and removed
- *                             dictionaries merged in.
- *  @param[out]     inAdded    An optional reference to the dictionary
- *                             containing entries to be added to the
- *                             base dictionary. If null, no such
- *                             entries will be added.
- *  @param[in]      inCommon   An optional reference to the dictionary
- *                             containing entries common to the base
- *                             dictionary, but potentially with
- *                             different values. Values that are
- *                             different will replace those in the
- *                             base. If null, no such entries will be
- *                             replaced.
- *  @param[in]      inRemoved  An optional reference to the dictionary
- *                             containing entries to be removed from
- *                             the base dictionary. If null, no such
- *                             entries will be removed.
+ *  Every object created with the arena must have been deallocated
+ *  beforehand; otherwise, the arena is left unchanged.
  *
- *  @returns
- *    True if the merge was successful; otherwise, false. False
- *    may be returned if an incorrect argument was supplied.
+ *  @param[in]  inArena  A reference to the arena allocator to reset.
  *
- *  @sa CFUDictionaryDifference
+ *  @returns
+ *    True if the arena was reset; otherwise, false if @a inArena is
+ *    not an arena allocator or allocations from it remain
+ *    outstanding.
  *
- *  @ingroup dictionary
+ *  @ingroup allocator
  *
  */
 Boolean
-CFUDictionaryMerge(CFMutableDictionaryRef inOutBase,
-                   CFDictionaryRef        inAdded,
-                   CFDictionaryRef        inCommon,
-                   CFDictionaryRef        inRemoved)
+CFUAllocatorArenaReset(CFAllocatorRef inArena)
 {
-    CFUDictionaryMergeWithDifferencesContext  theContext;
-    Boolean                                   status = true;
+    CFAllocatorContext       theContext;
+    CFUAllocatorArena *      theArena;
+    CFUAllocatorArenaChunk * theChunk;
+    Boolean                  status = false;
 
-    __Require_Action(inOutBase != nullptr, done, status = false);
+    __Require(inArena != nullptr, done);
 
-    // Add new and update common values
+    memset(&theContext, 0, sizeof (theContext));
 
-    CFUDictionaryMerge(theContext, inOutBase, inAdded, inCommon);
+    CFAllocatorGetContext(inArena, &theContext);
+    __Require(theContext.allocate == CFUAllocatorArenaAllocate, done);
 
-    if (inRemoved != nullptr)
-    {
-        // Remove old values
+    theArena = static_cast<CFUAllocatorArena *>(theContext.info);
 
-        theContext.mPhase = kCFUDictionaryDifferencePhaseRemove;
+    pthread_mutex_lock(&theArena->mMutex);
 
-        CFDictionaryApplyFunction(inRemoved,
-                                  CFUDictionaryMergeWithDifferencesApplier,
-                                  &theContext);
-    }
+    __Require_Quiet(theArena->mOutstanding == 0, unlock);
 
- done:
+    // Keep the current chunk for reuse, unless it was sized for a
+    // single, oversized allocation, and free the rest.
+
+    theChunk = theArena->mChunks;
+
+    if ((theChunk != nullptr) && (theChunk->mSize != theArena->mChunkSize))
+    {
+        theArena->mChunks = nullptr;
+    }
+    else if (theChunk != nullptr)
+    {
+        theChunk = theChunk->mNext;
+
+        theArena->mChunks->mNext = nullptr;
+    }
+
+    while (theChunk != nullptr)
+    {
+        CFUAllocatorArenaChunk * const theNext = theChunk->mNext;
+
+        free(theChunk);
+
+        theChunk = theNext;
+    }
+
+    if (theArena->mChunks != nullptr)
+    {
+        theArena->mCursor = CFUAllocatorArenaChunkGetStorage(theArena->mChunks);
+        theArena->mLimit  = theArena->mCursor + theArena->mChunks->mSize;
+    }
+    else
+    {
+        theArena->mCursor = nullptr;
+        theArena->mLimit  = nullptr;
+    }
+
+    theArena->mLast = nullptr;
+
+    status = true;
+
+ unlock:
+    pthread_mutex_unlock(&theArena->mMutex);
+
+ done:
     return (status);
 }
 
 /**
- *  @brief
- *    Merge a CoreFoundation dictionary from one or more difference
- *    dictionaries.
- *
- *  This routine merges a mutable CoreFoundation dictionary from two
- *  or more difference dictionaries (likely generated from
- *  #CFUDictionaryDifference) and a difference array, containing
- *  removed keys. If present, key/value pairs in the @a inAdded
- *  dictionary are added to @a inOutBase; if present, key/value pairs
- *  in the @a inCommon dictionary replace those in @a inOutBase if the
- *  values are different; and, if present, keys in the @a
- *  inRemovedKeys array are removed from @a inOutBase.
+ *  This routine returns the calling thread's accounting allocator
+ *  statistics.
  *
- *  @param[in,out]  inOutBase      A reference to the mutable
- *                                 dictionary to merge keys and values
- *                                 to. On success, @a inOutBase
- *                                 contains a reference to the
- *                                 destination dictionary with entries
- *                                 from the added and common
- *                                 dictionaries and the removed keys
- *                                 array merged in.
- *  @param[out]     inAdded        An optional reference to the
- *                                 dictionary containing entries to be
- *                                 added to the base dictionary. If
- *                                 null, no such entries will be
- *                                 added.
- *  @param[in]      inCommon       An optional reference to the
- *                                 dictionary containing entries
- *                                 common to the base dictionary, but
- *                                 potentially with different
- *                                 values. Values that are different
- *                                 will replace those in the base. If
- *                                 null, no such entries will be
- *                                 replaced.
- *  @param[in]      inRemovedKeys  An optional reference to the array
- *                                 containing key to be removed from
- *                                 the base dictionary. If null, no such
- *                                 entries will be removed.
+ *  @private
+ */
+static CFUAllocatorStatistics &
+CFUAllocatorAccountingGetThread(void)
+{
+    static thread_local CFUAllocatorStatistics sStatistics;
+
+    return (sStatistics);
+}
+
+/**
+ *  This routine records a change in the live bytes of the specified
+ *  accounting allocator and of the calling thread, updating the
+ *  total and peak bytes accordingly.
  *
- *  @returns
- *    True if the merge was successful; otherwise, false. False
- *    may be returned if an incorrect argument was supplied.
+ *  @private
+ */
+static void
+CFUAllocatorAccountingRecord(CFUAllocatorAccounting * inAccounting, int64_t inDelta)
+{
+    CFUAllocatorStatistics & theThread = CFUAllocatorAccountingGetThread();
+    int64_t                  theLive;
+    int64_t                  thePeak;
+
+    if (inDelta > 0)
+    {
+        inAccounting->mBytesAllocated.fetch_add(static_cast<uint64_t>(inDelta), memory_order_relaxed);
+
+        theThread.mBytesAllocated += static_cast<uint64_t>(inDelta);
+    }
+
+    theLive = inAccounting->mBytesLive.fetch_add(inDelta, memory_order_relaxed) + inDelta;
+    thePeak = inAccounting->mBytesPeak.load(memory_order_relaxed);
+
+    while ((theLive > thePeak) &&
+           !inAccounting->mBytesPeak.compare_exchange_weak(thePeak,
+                                                           theLive,
+                                                           memory_order_relaxed))
+    {
+        continue;
+    }
+
+    theThread.mBytesLive += inDelta;
+    theThread.mBytesPeak  = max(theThread.mBytesPeak, theThread.mBytesLive);
+}
+
+/**
+ *  This routine is the accounting allocator allocate callback.
  *
- *  @ingroup dictionary
+ *  @private
+ */
+static void *
+CFUAllocatorAccountingAllocate(CFIndex inSize, CFOptionFlags inHint, void * inInfo)
+{
+    CFUAllocatorAccounting * const theAccounting = static_cast<CFUAllocatorAccounting *>(inInfo);
+    uint8_t *                      theHeader;
+    void *                         theResult = nullptr;
+
+    __Require(inSize > 0, done);
+
+    theHeader = static_cast<uint8_t *>(CFAllocatorAllocate(theAccounting->mBacking,
+                                                           inSize + static_cast<CFIndex>(kCFUAllocatorAccountingHeaderSize),
+                                                           inHint));
+    __Require_Quiet(theHeader != nullptr, done);
+
+    *reinterpret_cast<CFIndex *>(theHeader) = inSize;
+
+    theResult = theHeader + kCFUAllocatorAccountingHeaderSize;
+
+    theAccounting->mAllocations.fetch_add(1, memory_order_relaxed);
+    CFUAllocatorAccountingGetThread().mAllocations++;
+
+    CFUAllocatorAccountingRecord(theAccounting, inSize);
+
+ done:
+    return (theResult);
+}
+
+/**
+ *  This routine is the accounting allocator reallocate callback.
  *
+ *  @private
  */
-Boolean
-CFUDictionaryMerge(CFMutableDictionaryRef inOutBase,
-                   CFDictionaryRef        inAdded,
-                   CFDictionaryRef        inCommon,
-                   CFArrayRef             inRemovedKeys)
+static void *
+CFUAllocatorAccountingReallocate(void * inPointer, CFIndex inSize, CFOptionFlags inHint, void * inInfo)
 {
-    CFUDictionaryMergeWithDifferencesContext  theContext;
-    Boolean                                   status = true;
+    CFUAllocatorAccounting * const theAccounting = static_cast<CFUAllocatorAccounting *>(inInfo);
+    uint8_t *                      theHeader     = static_cast<uint8_t *>(inPointer) - kCFUAllocatorAccountingHeaderSize;
+    const CFIndex                  theSize       = *reinterpret_cast<CFIndex *>(theHeader);
+    void *                         theResult     = nullptr;
 
-    __Require_Action(inOutBase != nullptr, done, status = false);
+    __Require(inSize > 0, done);
 
-    // Add new and update common values
+    theHeader = static_cast<uint8_t *>(CFAllocatorReallocate(theAccounting->mBacking,
+                                                             theHeader,
+                                                             inSize + static_cast<CFIndex>(kCFUAllocatorAccountingHeaderSize),
+                                                             inHint));
+    __Require_Quiet(theHeader != nullptr, done);
 
-    CFUDictionaryMerge(theContext, inOutBase, inAdded, inCommon);
+    *reinterpret_cast<CFIndex *>(theHeader) = inSize;
 
-    if (inRemovedKeys != nullptr)
-    {
-        // Remove old values
+    theResult = theHeader + kCFUAllocatorAccountingHeaderSize;
 
-        theContext.mPhase = kCFUDictionaryDifferencePhaseRemove;
+    theAccounting->mReallocations.fetch_add(1, memory_order_relaxed);
+    CFUAllocatorAccountingGetThread().mReallocations++;
 
-        CFArrayApplyFunction(inRemovedKeys,
-                             CFRangeMake(0, CFArrayGetCount(inRemovedKeys)),
-                             CFUDictionaryMergeWithDifferencesApplierAndRemovedKeysApplier,
-                             &theContext);
-    }
+    CFUAllocatorAccountingRecord(theAccounting, inSize - theSize);
 
  done:
-    return (status);
+    return (theResult);
 }
 
 /**
- *  @brief
- *    Merge two CoreFoundation dictionaries.
+ *  This routine is the accounting allocator deallocate callback.
  *
- *  This routine adds the key and value pairs from the specified
- *  source dictionary to the destination dictionary, replacing values
- *  with matching keys if requested.
+ *  @private
+ */
+static void
+CFUAllocatorAccountingDeallocate(void * inPointer, void * inInfo)
+{
+    CFUAllocatorAccounting * const theAccounting = static_cast<CFUAllocatorAccounting *>(inInfo);
+    uint8_t *                      theHeader;
+
+    __Require_Quiet(inPointer != nullptr, done);
+
+    theHeader = static_cast<uint8_t *>(inPointer) - kCFUAllocatorAccountingHeaderSize;
+
+    theAccounting->mDeallocations.fetch_add(1, memory_order_relaxed);
+    CFUAllocatorAccountingGetThread().mDeallocations++;
+
+    CFUAllocatorAccountingRecord(theAccounting, -*reinterpret_cast<CFIndex *>(theHeader));
+
+    CFAllocatorDeallocate(theAccounting->mBacking, theHeader);
+
+ done:
+    return;
+}
+
+/**
+ *  This routine is the accounting allocator context release
+ *  callback, invoked when the allocator itself is deallocated.
  *
- *  @param[in,out]  inDestination  A reference to the mutable dictionary
- *                                 to merge keys and values to. On
- *                                 success, @a inDestination contains
- *                                 a reference to the destination
- *                                 dictionary with entries from the
- *                                 source dictionary merged in.
- *  @param[in]      inSource       A reference to the dictionary to merge
- *                                 keys and values from.
- *  @param[in]      inReplace      A Boolean flag indicating whether
- *                                 values from the source dictionary
- *                                 will replace values in the
- *                                 destination when the keys for those
- *                                 values already exist in the
- *                                 destination.
+ *  @private
+ */
+static void
+CFUAllocatorAccountingDestroy(const void * inInfo)
+{
+    CFUAllocatorAccounting * const theAccounting = static_cast<CFUAllocatorAccounting *>(const_cast<void *>(inInfo));
+
+    CFURelease(theAccounting->mBacking);
+
+    delete theAccounting;
+}
+
+/**
+ *  This routine returns the state of the specified allocator if it
+ *  is an accounting allocator.
+ *
+ *  @private
+ */
+static CFUAllocatorAccounting *
+CFUAllocatorAccountingGet(CFAllocatorRef inAllocator)
+{
+    CFAllocatorContext       theContext;
+    CFUAllocatorAccounting * theAccounting = nullptr;
+
+    __Require(inAllocator != nullptr, done);
+
+    memset(&theContext, 0, sizeof (theContext));
+
+    CFAllocatorGetContext(inAllocator, &theContext);
+    __Require(theContext.allocate == CFUAllocatorAccountingAllocate, done);
+
+    theAccounting = static_cast<CFUAllocatorAccounting *>(theContext.info);
+
+ done:
+    return (theAccounting);
+}
+
+/**
+ *  @brief
+ *    Create an accounting allocator.
+ *
+ *  This routine creates a CoreFoundation allocator that forwards
+ *  every request to a backing allocator, counting allocations,
+ *  deallocations, and reallocations as well as the total, live, and
+ *  peak bytes allocated. The counts are kept both for the allocator,
+ *  retrieved with #CFUAllocatorAccountingGetStatistics, and for the
+ *  calling thread across all accounting allocators, retrieved with
+ *  #CFUAllocatorAccountingGetThreadStatistics.
+ *
+ *  Bytes are those requested by CoreFoundation, excluding the
+ *  overhead of the backing allocator.
+ *
+ *  To account for the allocations of interfaces that allocate with
+ *  kCFAllocatorDefault, such as most of those in this library, make
+ *  the accounting allocator the thread's default allocator with @a
+ *  CFAllocatorSetDefault for their duration.
+ *
+ *  The allocator may be used from multiple threads.
+ *
+ *  @param[in]  inAllocator  The allocator with which to allocate the
+ *                           accounting allocator object itself. Pass
+ *                           null or kCFAllocatorDefault to use the
+ *                           current default allocator.
+ *  @param[in]  inBacking    The allocator to which requests are
+ *                           forwarded. If null or
+ *                           kCFAllocatorDefault, the current default
+ *                           allocator at the time of creation is
+ *                           used.
  *
  *  @returns
- *    True if the merge was successful; otherwise, false. False
- *    may be returned if an incorrect argument was supplied.
+ *    A reference to the accounting allocator on success, which the
+ *    caller owns and is responsible for releasing; otherwise, null
+ *    on error.
  *
- *  @ingroup dictionary
+ *  @ingroup allocator
  *
  */
-Boolean
-CFUDictionaryMerge(CFMutableDictionaryRef inDestination,
-                   CFDictionaryRef        inSource,
-                   bool                   inReplace)
+CFAllocatorRef
+CFUAllocatorAccountingCreate(CFAllocatorRef inAllocator, CFAllocatorRef inBacking)
 {
-    CFUDictionaryMergeContext theContext = { inDestination, inReplace };
-    Boolean                   status     = true;
+    CFUAllocatorAccounting * theAccounting = nullptr;
+    CFAllocatorRef           theAllocator  = nullptr;
+    CFAllocatorContext       theContext;
 
-    __Require_Action(inDestination != nullptr, done, status = false);
-    __Require_Action(inSource      != nullptr, done, status = false);
+    theAccounting = new (std::nothrow) CFUAllocatorAccounting();
+    __Require(theAccounting != nullptr, done);
 
-    CFDictionaryApplyFunction(inSource, CFUDictionaryMergeApplier, &theContext);
+    // Resolve the default backing allocator now, such that the
+    // accounting allocator may later itself be made the default
+    // without forwarding to itself.
 
-done:
-    return (status);
+    theAccounting->mBacking = static_cast<CFAllocatorRef>(CFRetain((inBacking == nullptr) ?
+                                                                   CFAllocatorGetDefault() :
+                                                                   inBacking));
+
+    theAccounting->mAllocations    = 0;
+    theAccounting->mDeallocations  = 0;
+    theAccounting->mReallocations  = 0;
+    theAccounting->mBytesAllocated = 0;
+    theAccounting->mBytesLive      = 0;
+    theAccounting->mBytesPeak      = 0;
+
+    memset(&theContext, 0, sizeof (theContext));
+
+    theContext.info       = theAccounting;
+    theContext.release    = CFUAllocatorAccountingDestroy;
+    theContext.allocate   = CFUAllocatorAccountingAllocate;
+    theContext.reallocate = CFUAllocatorAccountingReallocate;
+    theContext.deallocate = CFUAllocatorAccountingDeallocate;
+
+    theAllocator = CFAllocatorCreate(inAllocator, &theContext);
+    __Require_Action(theAllocator != nullptr, done, CFUAllocatorAccountingDestroy(theAccounting));
+
+ done:
+    return (theAllocator);
 }
 
 /**
  *  @brief
- *    Merge a CoreFoundation dictionary from one or more difference
- *    dictionaries.
- *
- *  This routine merges a mutable CoreFoundation dictionary from one
- *  or more difference dictionaries (likely generated from
- *  #CFUDictionaryDifference). If present, key/value pairs in the @a
- *  inAdded dictionary are added to @a inOutBase; if present,
- *  key/value pairs in the @a inCommon dictionary replace those in @a
- *  inOutBase if the values are different; and, if present, key/value
- *  pairs in the @a inRemoved dictionary are removed from @a
- *  inOutBase.
+ *    Get the statistics of an accounting allocator.
  *
- *  @param[in,out]  inOutBase  A reference to the mutable dictionary
- *                             to merge keys and values to. On
- *                             success, @a inOutBase contains
- *                             a reference to the destination
- *                             dictionary with entries from the
- *                             added, common, and removed
- *                             dictionaries merged in.
- *  @param[out]     inAdded    An optional reference to the dictionary
- *                             containing entries to be added to the
- *                             base dictionary. If null, no such
- *                             entries will be added.
- *  @param[in]      inCommon   An optional reference to the dictionary
- *                             containing entries common to the base
- *                             dictionary, but potentially with
- *                             different values. Values that are
- *                             different will replace those in the
- *                             base. If null, no such entries will be
- *                             replaced.
- *  @param[in]      inRemoved  An optional reference to the dictionary
- *                             containing entries to be removed from
- *                             the base dictionary. If null, no such
- *                             entries will be removed.
+ *  @param[in]   inAccounting   A reference to the accounting
+ *                              allocator.
+ *  @param[out]  outStatistics  A pointer to storage for the
+ *                              statistics. Each is read
+ *                              independently and, while the
+ *                              allocator is in use by other threads,
+ *                              they may not be mutually consistent.
  *
  *  @returns
- *    True if the merge was successful; otherwise, false. False
- *    may be returned if an incorrect argument was supplied.
+ *    True on success; otherwise, false if @a inAccounting is not an
+ *    accounting allocator or @a outStatistics is null.
  *
- *  @ingroup dictionary
+ *  @ingroup allocator
  *
  */
 Boolean
-CFUDictionaryMergeWithDifferences(CFMutableDictionaryRef inOutBase,
-                                  CFDictionaryRef        inAdded,
-                                  CFDictionaryRef        inCommon,
-                                  CFDictionaryRef        inRemoved)
+CFUAllocatorAccountingGetStatistics(CFAllocatorRef           inAccounting,
+                                    CFUAllocatorStatistics * outStatistics)
 {
-    Boolean status = true;
+    CFUAllocatorAccounting * theAccounting;
+    Boolean                  status = false;
 
-    status = CFUDictionaryMerge(inOutBase,
-                                inAdded,
-                                inCommon,
-                                inRemoved);
+    __Require(outStatistics != nullptr, done);
+
+    theAccounting = CFUAllocatorAccountingGet(inAccounting);
+    __Require(theAccounting != nullptr, done);
+
+    outStatistics->mAllocations    = theAccounting->mAllocations.load(memory_order_relaxed);
+    outStatistics->mDeallocations  = theAccounting->mDeallocations.load(memory_order_relaxed);
+    outStatistics->mReallocations  = theAccounting->mReallocations.load(memory_order_relaxed);
+    outStatistics->mBytesAllocated = theAccounting->mBytesAllocated.load(memory_order_relaxed);
+    outStatistics->mBytesLive      = theAccounting->mBytesLive.load(memory_order_relaxed);
+    outStatistics->mBytesPeak      = theAccounting->mBytesPeak.load(memory_order_relaxed);
+
+    status = true;
 
+ done:
     return (status);
 }
 
 /**
  *  @brief
- *    Merge a CoreFoundation dictionary from one or more difference
- *    dictionaries.
+ *    Reset the statistics of an accounting allocator.
  *
- *  This routine merges a mutable CoreFoundation dictionary from two
- *  or more difference dictionaries (likely generated from
- *  #CFUDictionaryDifference) and a difference array, containing
- *  removed keys. If present, key/value pairs in the @a inAdded
- *  dictionary are added to @a inOutBase; if present, key/value pairs
- *  in the @a inCommon dictionary replace those in @a inOutBase if the
- *  values are different; and, if present, keys in the @a
- *  inRemovedKeys array are removed from @a inOutBase.
+ *  This routine zeroes the counts and total bytes of the specified
+ *  accounting allocator. The live bytes, which reflect allocations
+ *  still outstanding, are retained, and the peak restarts from them.
  *
- *  @param[in,out]  inOutBase      A reference to the mutable
- *                                 dictionary to merge keys and values
- *                                 to. On success, @a inOutBase
- *                                 contains a reference to the
- *                                 destination dictionary with entries
- *                                 from the added and common
- *                                 dictionaries and the removed keys
- *                                 array merged in.
- *  @param[out]     inAdded        An optional reference to the
- *                                 dictionary containing entries to be
- *                                 added to the base dictionary. If
- *                                 null, no such entries will be
- *                                 added.
- *  @param[in]      inCommon       An optional reference to the
- *                                 dictionary containing entries
- *                                 common to the base dictionary, but
- *                                 potentially with different
- *                                 values. Values that are different
- *                                 will replace those in the base. If
- *                                 null, no such entries will be
- *                                 replaced.
- *  @param[in]      inRemovedKeys  An optional reference to the array
- *                                 containing key to be removed from
- *                                 the base dictionary. If null, no such
- *                                 entries will be removed.
+ *  @param[in]  inAccounting  A reference to the accounting allocator.
  *
  *  @returns
- *    True if the merge was successful; otherwise, false. False
- *    may be returned if an incorrect argument was supplied.
+ *    True on success; otherwise, false if @a inAccounting is not an
+ *    accounting allocator.
  *
- *  @ingroup dictionary
+ *  @ingroup allocator
  *
  */
 Boolean
-CFUDictionaryMergeWithDifferencesAndRemovedKeys(CFMutableDictionaryRef inOutBase,
-                                                CFDictionaryRef        inAdded,
-                                                CFDictionaryRef        inCommon,
-                                                CFArrayRef             inRemovedKeys)
+CFUAllocatorAccountingResetStatistics(CFAllocatorRef inAccounting)
 {
-    Boolean status = true;
+    CFUAllocatorAccounting * theAccounting;
+    Boolean                  status = false;
 
-    status = CFUDictionaryMerge(inOutBase,
-                                inAdded,
-                                inCommon,
-                                inRemovedKeys);
+    theAccounting = CFUAllocatorAccountingGet(inAccounting);
+    __Require(theAccounting != nullptr, done);
 
+    theAccounting->mAllocations.store(0, memory_order_relaxed);
+    theAccounting->mDeallocations.store(0, memory_order_relaxed);
+    theAccounting->mReallocations.store(0, memory_order_relaxed);
+    theAccounting->mBytesAllocated.store(0, memory_order_relaxed);
+    theAccounting->mBytesPeak.store(theAccounting->mBytesLive.load(memory_order_relaxed),
+                                    memory_order_relaxed);
+
+    status = true;
+
+ done:
     return (status);
 }
 
 /**
  *  @brief
- *    Get a Boolean value from a CoreFoundation dictionary.
- *
- *  This routine is a type-safe wrapper that allows using intrinsic
- *  C/C++ standard @a bool value types rather than
- *  CoreFoundation-defined @a Boolean value types.
- *
- *  @param[in]      inDictionary  A reference to the CoreFoundation
- *                                dictionary to get the Boolean from.
- *  @param[in]      inKey         A pointer to the key for which to
- *                                find a Boolean in the dictionary.
- *  @param[in,out]  outValue      A reference to storage for the
- *                                converted Boolean.
+ *    Get the accounting allocator statistics of the calling thread.
  *
- *  @returns
- *    True if the requested Boolean was successfully retrieved;
- *    otherwise, false.
+ *  This routine returns the statistics of the requests made on the
+ *  calling thread to any accounting allocator. Live bytes are those
+ *  allocated less those deallocated on this thread and so may be
+ *  negative where objects are released on a thread other than the
+ *  one that created them.
  *
- *  @sa CFUDictionarySetBoolean
- *  @sa CFUDictionarySetNumber
+ *  @param[out]  outStatistics  A pointer to storage for the
+ *                              statistics.
  *
- *  @ingroup dictionary
+ *  @ingroup allocator
  *
  */
-Boolean
-CFUDictionaryGetBoolean(CFDictionaryRef inDictionary,
-                        const void *    inKey,
-                        bool &          outValue)
+void
+CFUAllocatorAccountingGetThreadStatistics(CFUAllocatorStatistics * outStatistics)
 {
-    Boolean status, tempBool;
+    __Require(outStatistics != nullptr, done);
 
-    status = CFUDictionaryGetBoolean(inDictionary, inKey, tempBool);
-    __Require_Quiet(status, done);
-
-    outValue = tempBool;
+    *outStatistics = CFUAllocatorAccountingGetThread();
 
-done:
-    return (status);
+ done:
+    return;
 }
 
 /**
  *  @brief
- *    Get a Boolean value from a CoreFoundation dictionary.
+ *    Reset the accounting allocator statistics of the calling
+ *    thread.
  *
- *  This routine attempts to retrieve and convert the CoreFoundation
- *  Boolean associated with the specified key from the provided
- *  dictionary and convert it to the specified Boolean value.
+ *  This routine zeroes the counts and total bytes of the calling
+ *  thread. The live bytes are retained and the peak restarts from
+ *  them, such that the peak less the live bytes at the time of the
+ *  reset is the high-water mark of an operation that follows.
  *
- *  @param[in]      inDictionary  A reference to the CoreFoundation
- *                                dictionary to get the Boolean from.
- *  @param[in]      inKey         A pointer to the key for which to
- *                                find a Boolean in the dictionary.
- *  @param[in,out]  outValue      A reference to storage for the
- *                                converted Boolean.
+ *  @ingroup allocator
+ *
+ */
+void
+CFUAllocatorAccountingResetThreadStatistics(void)
+{
+    CFUAllocatorStatistics & theThread = CFUAllocatorAccountingGetThread();
+
+    theThread.mAllocations    = 0;
+    theThread.mDeallocations  = 0;
+    theThread.mReallocations  = 0;
+    theThread.mBytesAllocated = 0;
+    theThread.mBytesPeak      = theThread.mBytesLive;
+}
+
+/**
+ *  This routine checks the type of the specified CoreFoundation
+ *  reference against the specified type.
+ *
+ *  @param[in]  inReference  A CoreFoundation reference to type check.
+ *  @param[in]  inID         The CoreFoundation type identifier to check
+ *                           the reference type against.
  *
  *  @returns
- *    True if the requested Boolean was successfully retrieved;
+ *    True if the specified reference matches the provided type;
  *    otherwise, false.
  *
- *  @sa CFUDictionarySetBoolean
- *  @sa CFUDictionarySetNumber
- *
- *  @ingroup dictionary
+ *  @ingroup base
  *
  */
-Boolean
-CFUDictionaryGetBoolean(CFDictionaryRef inDictionary,
-                        const void *    inKey,
-                        Boolean &       outValue)
+bool
+CFUIsTypeID(CFTypeRef inReference, CFTypeID inID)
 {
-    bool         status      = false;
-    CFBooleanRef tempBoolean = nullptr;
-
-    // Sanity check the input parameters.
-
-    __Require(inDictionary != nullptr, done);
-    __Require(inKey != nullptr, done);
-
-    // Attempt to get the value from the dictionary.
-
-    tempBoolean = static_cast<CFBooleanRef>(
-        CFDictionaryGetValue(inDictionary, inKey));
-
-    // The key being absent is a quiet failure; whereas, the value not
-    // being of type Boolean is.
-
-    __Require_Quiet(tempBoolean != nullptr, done);
-    __Require(CFUIsTypeID(tempBoolean, CFBooleanGetTypeID()), done);
+    bool status = false;
 
-    outValue = CFBooleanGetValue(tempBoolean);
+    __Require_Quiet(inReference != nullptr, done);
 
-    status = true;
+    status = (CFGetTypeID(inReference) == inID);
 
 done:
     return (status);
@@ -1027,1264 +1324,7487 @@ done:
 
 /**
  *  @brief
- *    Set a Boolean value in a CoreFoundation dictionary.
- *
- *  This routine sets the specified Boolean value in the provided
- *  dictionary associated with the specified key.
+ *    Releases a reference to a Core Foundation object.
  *
- *  @param[in,out]  inDictionary  A reference to the CoreFoundation
- *                                dictionary to set the Boolean in. On
- *                                success, the dictionary is modified
- *                                with a reference to the Boolean as a
- *                                CoreFoundation Boolean value.
- *  @param[in]      inKey         A pointer to the key with which to
- *                                associate the Boolean in the
- *                                dictionary.
- *  @param[in]      inValue       The Boolean value to set.
+ *  This routine attempts to release the specified CoreFoundation
+ *  object.
  *
- *  @returns
- *    True if the value was successfully set; otherwise, false.
+ *  @note
+ *    In contrast to the @a CFRelease interface, a null reference results
+ *    in no action being taken.
  *
- *  @sa CFUDictionaryGetBoolean
+ *  @param[in,out]  inReference  A reference to the CoreFoundation
+ *                               object to release. On success, if
+ *                               @a inReference is non-null, the
+ *                               reference is released.
  *
- *  @ingroup dictionary
+ *  @ingroup base
  *
  */
-Boolean
-CFUDictionarySetBoolean(CFMutableDictionaryRef inDictionary,
-                        const void *           inKey,
-                        Boolean                inValue)
+void
+CFURelease(CFTypeRef inReference)
 {
-    bool status = false;
-
-    __Require(inDictionary != nullptr, done);
-    __Require(inKey != nullptr, done);
-
-    CFDictionarySetValue(inDictionary,
-                         inKey,
-                         (inValue ? kCFBooleanTrue : kCFBooleanFalse));
-
-    status = true;
-
-done:
-    return (status);
+    if (inReference != nullptr) {
+        CFRelease(inReference);
+    }
 }
 
 /**
- *  @brief
- *    Add a null-termited C string to a dictionary.
-
- *  This routine sets the specified null-terminated C string value, as
- *  a CFString, in the provided dictionary associated with the
- *  specified key.
+ *  This routine allocates and initializes the deferred release
+ *  state shared by all threads.
  *
- *  @param[in,out]  inDictionary  A reference to the CoreFoundation
- *                                dictionary to set the
- *                                null-terminated C string in. On
- *                                success, the dictionary is modified
- *                                with a reference to the CFString
- *                                value equivalent to the
- *                                null-terminated C string set.
- *  @param[in]      inKey         A pointer to the key with which to
- *                                associate the null-terminated C
- *                                string in the dictionary.
- *  @param[in]      inString      The null-terminated C string value to set.
+ *  The state is deliberately never destroyed, such that threads
+ *  exiting, and so handing off their queues, after static
+ *  destruction has begun do not use a destroyed lock.
  *
  *  @returns
- *    True if the value was successfully set; otherwise, false.
- *
- *  @ingroup dictionary
+ *    A pointer to the state if OK; otherwise, null if memory
+ *    allocation was unsuccessful.
  *
+ *  @private
  */
-Boolean
-CFUDictionarySetCString(CFMutableDictionaryRef inDictionary,
-                        const void *           inKey,
-                        const char *           inString)
+static CFUReleaseQueueState *
+CFUReleaseQueueCreateState(void)
 {
-    bool        status     = false;
-    CFStringRef tempString = nullptr;
-
-    __Require(inDictionary != nullptr, done);
-    __Require(inKey != nullptr, done);
-    __Require(inString != nullptr, done);
-
-    tempString = CFStringCreateWithCString(kCFAllocatorDefault,
-                                           inString,
-                                           CFStringGetSystemEncoding());
-    __Require(tempString != nullptr, done);
+    CFUReleaseQueueState * const theState = new (std::nothrow) CFUReleaseQueueState();
 
-    CFDictionarySetValue(inDictionary, inKey, tempString);
+    __Require(theState != nullptr, done);
 
-    status = true;
+    pthread_mutex_init(&theState->mMutex, nullptr);
+    pthread_cond_init(&theState->mCondition, nullptr);
 
-done:
-    CFURelease(tempString);
+    theState->mRunning  = false;
+    theState->mStopping = false;
 
-    return (status);
+ done:
+    return (theState);
 }
 
 /**
- *  This routine is a CoreFoundation dictionary applier function
- *  that iterates on each key/value pair of a base or proposed
- *  dictionary and determines whether each entry is unique or common
- *  to the other.
+ *  This routine returns the deferred release state shared by all
+ *  threads, creating it on first use.
  *
- *  @param[in]      inKey      A pointer to the key of the current
- *                             key/value pair being iterated upon.
- *  @param[in]      inValue    A pointer to the value of the current
- *                             key/value pair being iterated upon.
- *  @param[in,out]  inContext  A pointer to the iterator context. On
- *                             completion and depending on the context
- *                             phase, the context's added dictionary,
- *                             if present, will contain entries unique
- *                             to the proposed dictionary; the
- *                             context's removed dictionary, if
- *                             present, will contain entries unique to
- *                             the base dictionary; and the context's
- *                             common dictionary, if present, will
- *                             contain entries common to both the base
- *                             and proposed dictionaries but for which
- *                             may have different values for their
- *                             keys.
+ *  @returns
+ *    A pointer to the state if OK; otherwise, null if it could not
+ *    be created, in which case deferred releases are instead
+ *    released immediately on the calling thread.
  *
  *  @private
- *
  */
-static void
-CFUDictionaryDifferenceApplier(const void *inKey,
-                               const void *inValue,
-                               void *inContext)
+static CFUReleaseQueueState *
+CFUReleaseQueueGetState(void)
 {
-    CFStringRef                       theKey     = static_cast<CFStringRef>(inKey);
-    CFDictionaryRef                   theValue   = static_cast<CFDictionaryRef>(inValue);
-    CFUDictionaryDifferenceContext *  theContext = static_cast<CFUDictionaryDifferenceContext *>(inContext);
+    static CFUReleaseQueueState * const sState = CFUReleaseQueueCreateState();
 
-    __Require(theKey != nullptr,     done);
-    __Require(theValue != nullptr,   done);
-    __Require(theContext != nullptr, done);
+    return (sState);
+}
 
-    if (theContext->mPhase == kCFUDictionaryDifferencePhaseAdd)
-    {
-        const bool theDictionaryHasKey = CFDictionaryContainsKey(theContext->mBase, theKey);
+/**
+ *  This routine returns the calling thread's deferred release
+ *  queue.
+ *
+ *  @private
+ */
+static CFUReleaseQueue &
+CFUReleaseQueueGetLocal(void)
+{
+    static thread_local CFUReleaseQueue sQueue;
 
-        if (!theDictionaryHasKey)
+    return (sQueue);
+}
+
+/**
+ *  This routine hands off the specified queue of references, if
+ *  any, as a batch awaiting release, replacing it with spare batch
+ *  storage, if available, such that steady-state deferral does not
+ *  allocate.
+ *
+ *  @param[in,out]  inOutReferences  The queue of references to hand
+ *                                   off. On return, empty.
+ *
+ *  @private
+ */
+static void
+CFUReleaseQueueHandOff(vector<CFTypeRef> & inOutReferences)
+{
+    CFUReleaseQueueState * const theState = CFUReleaseQueueGetState();
+
+    __Require_Quiet(!inOutReferences.empty(), done);
+
+    // Without shared state, there is nowhere to hand off to; release
+    // the references now rather than leak them.
+
+    if (theState == nullptr)
+    {
+        for (CFTypeRef theReference : inOutReferences)
         {
-            if (theContext->mAdded != nullptr)
-            {
-                CFDictionarySetValue(theContext->mAdded, theKey, theValue);
-            }
+            CFRelease(theReference);
         }
-        else
+
+        inOutReferences.clear();
+    }
+    __Require_Quiet(theState != nullptr, done);
+
+    pthread_mutex_lock(&theState->mMutex);
+
+    theState->mPending.push_back(std::move(inOutReferences));
+
+    inOutReferences.clear();
+
+    if (!theState->mSpare.empty())
+    {
+        inOutReferences.swap(theState->mSpare.back());
+
+        theState->mSpare.pop_back();
+    }
+
+    pthread_cond_signal(&theState->mCondition);
+
+    pthread_mutex_unlock(&theState->mMutex);
+
+ done:
+    return;
+}
+
+/**
+ *  This routine releases the references of the specified batches,
+ *  which must be done without holding the state lock, and then
+ *  returns their storage to the spare batches, up to a limit.
+ *
+ *  @param[in,out]  inState       The deferred release state to
+ *                                which to return storage.
+ *  @param[in,out]  inOutBatches  The batches to release. On return,
+ *                                empty.
+ *
+ *  @returns
+ *    The number of references released.
+ *
+ *  @private
+ */
+static size_t
+CFUReleaseQueueRelease(CFUReleaseQueueState &       inState,
+                       vector<vector<CFTypeRef> > & inOutBatches)
+{
+    size_t theCount = 0;
+
+    for (vector<CFTypeRef> & theBatch : inOutBatches)
+    {
+        for (CFTypeRef theReference : theBatch)
         {
-            if (theContext->mCommon != nullptr)
-            {
-                CFDictionarySetValue(theContext->mCommon, theKey, theValue);
-            }
+            CFRelease(theReference);
         }
+
+        theCount += theBatch.size();
+
+        theBatch.clear();
     }
-    else if (theContext->mPhase == kCFUDictionaryDifferencePhaseRemove)
+
+    pthread_mutex_lock(&inState.mMutex);
+
+    while (!inOutBatches.empty() &&
+           (inState.mSpare.size() < kCFUReleaseQueueMaximumSpare))
     {
-        const bool theDictionaryHasKey = CFDictionaryContainsKey(theContext->mProposed, theKey);
+        inState.mSpare.push_back(std::move(inOutBatches.back()));
 
-        if (!theDictionaryHasKey)
+        inOutBatches.pop_back();
+    }
+
+    pthread_mutex_unlock(&inState.mMutex);
+
+    inOutBatches.clear();
+
+    return (theCount);
+}
+
+/**
+ *  This routine is the body of the reclaimer thread, which releases
+ *  batches as they are handed off until asked to stop.
+ *
+ *  @param[in,out]  inContext  A pointer to the deferred release
+ *                             state.
+ *
+ *  @private
+ */
+static void *
+CFUReleaseQueueReclaim(void * inContext)
+{
+    CFUReleaseQueueState &     theState = *static_cast<CFUReleaseQueueState *>(inContext);
+    vector<vector<CFTypeRef> > theBatches;
+
+    pthread_mutex_lock(&theState.mMutex);
+
+    while (!theState.mStopping)
+    {
+        if (theState.mPending.empty())
         {
-            if (theContext->mRemoved != nullptr)
-            {
-                CFDictionarySetValue(theContext->mRemoved, theKey, theValue);
-            }
+            pthread_cond_wait(&theState.mCondition, &theState.mMutex);
         }
         else
         {
-            if (theContext->mCommon != nullptr)
-            {
-                CFDictionarySetValue(theContext->mCommon, theKey, theValue);
-            }
+            theBatches.swap(theState.mPending);
+
+            pthread_mutex_unlock(&theState.mMutex);
+
+            CFUReleaseQueueRelease(theState, theBatches);
+
+            pthread_mutex_lock(&theState.mMutex);
         }
     }
 
- done:
-    return;
+    pthread_mutex_unlock(&theState.mMutex);
+
+    return (nullptr);
+}
+
+CFUReleaseQueue :: ~CFUReleaseQueue(void)
+{
+    CFUReleaseQueueHandOff(mReferences);
 }
 
 /**
  *  @brief
- *    Initialize a CoreFoundation dictionary difference context.
+ *    Defers the release of a reference to a CoreFoundation object.
  *
- *  This intializes a CoreFoundation dictionary difference context for
- *  a #CFUDictionaryDifference call.
+ *  This routine queues the specified reference on the calling
+ *  thread's deferred release queue rather than releasing it, such
+ *  that, should it be the last reference to a large object graph,
+ *  the graph is not torn down on the calling thread.
  *
- *  @param[in]      inProposed  A reference to the dictionary serving
- *                              as the focus of the difference.
- *  @param[in,out]  inOutBase   An reference to a mutable dictionary
- *                              reference serving as the base of the
- *                              difference. The reference itself is
- *                              optional and may be null. If the
- *                              reference is null, a mutable
- *                              dictionary will be allocated on the
- *                              caller's behalf that becomes their
- *                              responsiblity to release on success.
- *  @param[out]     outAdded    An optional reference to the mutable
- *                              dictionary containing entries unique
- *                              to the proposed dictionary. If null,
- *                              no such entries will be enumerated and
- *                              populated.
- *  @param[out]     outCommon   An optional reference to the mutable
- *                              dictionary containing entries common
- *                              to both the base and current
- *                              dictionary but that may be changed
- *                              between them in terms of values. If
- *                              null, no such entries will be
- *                              enumerated and populated.
- *  @param[out]     outRemoved  A optional reference to the mutable
- *                              dictionary containing entries unique
- *                              to the base dictionary. If null, no
- *                              such entries will be enumerated and
- *                              populated.
- *  @param[out]     outContext  A reference to the context to be
- *                              intialized.
+ *  Each time the queue fills a batch, or on
+ *  #CFUReleaseQueueFlush, it is handed off to be released either by
+ *  the reclaimer thread, if started with
+ *  #CFUReleaseQueueStartReclaimer, or by the next call to
+ *  #CFUReleaseQueueDrain, on whichever thread makes it. A thread's
+ *  queue is also handed off when the thread exits.
  *
- *  @returns
- *    True if the difference was successful; otherwise, false. False
- *    may be returned if memory allocation was unsuccessful.
+ *  @note
+ *    As with #CFURelease, a null reference results in no action
+ *    being taken.
  *
- *  @private
+ *  @param[in]  inReference  A reference to the CoreFoundation object
+ *                           to release.
+ *
+ *  @sa CFUReleaseQueueFlush
+ *  @sa CFUReleaseQueueDrain
+ *
+ *  @ingroup base
  *
  */
-static Boolean
-CFUDictionaryDifferenceContextSetup(CFDictionaryRef inProposed,
-                                    CFMutableDictionaryRef &inOutBase,
-                                    CFMutableDictionaryRef outAdded,
-                                    CFMutableDictionaryRef outCommon,
-                                    CFMutableDictionaryRef outRemoved,
-                                    CFUDictionaryDifferenceContext &outContext)
+void
+CFUReleaseDeferred(CFTypeRef inReference)
 {
-    Boolean status = true;
-
-    if (inOutBase == nullptr)
-    {
-        CFMutableDictionaryRef theTemporaryDictionary = nullptr;
-
-        theTemporaryDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
-                                                           0,
-                                                           &kCFTypeDictionaryKeyCallBacks,
-                                                           &kCFTypeDictionaryValueCallBacks);
-        __Require_Action(theTemporaryDictionary != nullptr,
-                         done,
-                         status = false);
+    CFUReleaseQueue & theQueue = CFUReleaseQueueGetLocal();
 
-        CFUReferenceSet(inOutBase, theTemporaryDictionary);
+    __Require_Quiet(inReference != nullptr, done);
 
-        CFURelease(theTemporaryDictionary);
+    if (theQueue.mReferences.capacity() == 0)
+    {
+        theQueue.mReferences.reserve(kCFUReleaseQueueBatchSize);
     }
 
-    // Setup the difference context based on the provided dictionary
-    // arguments.
+    theQueue.mReferences.push_back(inReference);
 
-    outContext.mProposed = inProposed;
-    outContext.mBase     = inOutBase;
-    outContext.mAdded    = outAdded;
-    outContext.mCommon   = outCommon;
-    outContext.mRemoved  = outRemoved;
+    if (theQueue.mReferences.size() >= kCFUReleaseQueueBatchSize)
+    {
+        CFUReleaseQueueHandOff(theQueue.mReferences);
+    }
 
  done:
-    return (status);
+    return;
+}
 
+/**
+ *  @brief
+ *    Hands off the calling thread's deferred releases.
+ *
+ *  This routine hands off the references queued on the calling
+ *  thread by #CFUReleaseDeferred, however few, to be released.
+ *  Call it at a quiescent point, such as the end of a request, such
+ *  that references do not linger on an idle thread.
+ *
+ *  @ingroup base
+ *
+ */
+void
+CFUReleaseQueueFlush(void)
+{
+    CFUReleaseQueueHandOff(CFUReleaseQueueGetLocal().mReferences);
 }
 
 /**
  *  @brief
- *    Apply a difference between the proposed and base dictionaries.
+ *    Releases all deferred releases on the calling thread.
  *
- *  The attempts to apply a difference between the proposed and base
- *  dictionaries, returning, if requested by virtue of non-null
- *  mutable dictionary references, the entries between the proposed
- *  and base dictionaries that are unique to the proposed (that is,
- *  added relative to the base), unique to the proposed (that is,
- *  removed relative to the base), and common between them, though
- *  with potentially different values between the base and proposed in
- *  such case, the common dictionary will contain the base value.
+ *  This routine hands off the calling thread's deferred releases
+ *  and then releases, on the calling thread, those of every thread
+ *  handed off and not yet released.
  *
- *  @param[in]      inProposed  A reference to the dictionary serving
- *                              as the focus of the difference.
- *  @param[in,out]  inOutBase   An reference to a mutable dictionary
- *                              reference serving as the base of the
- *                              difference. The reference itself is
- *                              optional and may be null. If the
- *                              reference is null, a mutable
- *                              dictionary will be allocated on the
- *                              caller's behalf that becomes their
- *                              responsiblity to release on success.
- *  @param[out]     outAdded    An optional reference to the mutable
- *                              dictionary containing entries unique
- *                              to the proposed dictionary. If null,
- *                              no such entries will be enumerated and
- *                              populated.
- *  @param[out]     outCommon   An optional reference to the mutable
- *                              dictionary containing entries common
- *                              to both the base and current
- *                              dictionary but that may be changed
- *                              between them in terms of values. If
- *                              null, no such entries will be
- *                              enumerated and populated.
- *  @param[out]     outRemoved  A optional reference to the mutable
- *                              dictionary containing entries unique
- *                              to the base dictionary. If null, no
- *                              such entries will be enumerated and
- *                              populated.
+ *  Without a reclaimer thread, call it periodically at a quiescent
+ *  point, on a thread whose latency does not matter.
  *
  *  @returns
- *    True if the difference was successful; otherwise, false. False
- *    may be returned if an incorrect argument was supplied or if
- *    memory allocation was unsuccessful.
+ *    The number of references released.
  *
- *  @ingroup dictionary
+ *  @ingroup base
  *
  */
-Boolean
-CFUDictionaryDifference(CFDictionaryRef inProposed,
-                        CFMutableDictionaryRef &inOutBase,
-                        CFMutableDictionaryRef outAdded,
-                        CFMutableDictionaryRef outCommon,
-                        CFMutableDictionaryRef outRemoved)
+size_t
+CFUReleaseQueueDrain(void)
 {
-    CFUDictionaryDifferenceContext theContext;
-    Boolean                        status = true;
-
-    __Require_Action(inProposed != nullptr, done, status = false);
-
-    // Setup the difference context.
-
-    status = CFUDictionaryDifferenceContextSetup(inProposed,
-                                                 inOutBase,
-                                                 outAdded,
-                                                 outCommon,
-                                                 outRemoved,
-                                                 theContext);
-    __Require(status, done);
-    __Require(inOutBase != nullptr, done);
+    CFUReleaseQueueState * const theState = CFUReleaseQueueGetState();
+    vector<vector<CFTypeRef> >   theBatches;
+    size_t                       theRetval = 0;
 
-    // Generate the dictionary unique to the proposed dictionary by
-    // iterating over the proposed dictionary, representing "what is".
+    CFUReleaseQueueFlush();
 
-    theContext.mPhase   = kCFUDictionaryDifferencePhaseAdd;
+    __Require_Quiet(theState != nullptr, done);
 
-    CFDictionaryApplyFunction(inProposed,
-                              CFUDictionaryDifferenceApplier,
-                              &theContext);
+    pthread_mutex_lock(&theState->mMutex);
 
-    // Generate the dictionary unique to the base dictionary by
-    // iterating over the base dictionary, representing "what was".
+    theBatches.swap(theState->mPending);
 
-    theContext.mPhase   = kCFUDictionaryDifferencePhaseRemove;
+    pthread_mutex_unlock(&theState->mMutex);
 
-    CFDictionaryApplyFunction(inOutBase,
-                              CFUDictionaryDifferenceApplier,
-                              &theContext);
+    theRetval = CFUReleaseQueueRelease(*theState, theBatches);
 
  done:
+    return (theRetval);
+}
+
+/**
+ *  @brief
+ *    Starts a background thread for deferred releases.
+ *
+ *  This routine starts, if not already started, a thread that
+ *  releases deferred releases as they are handed off.
+ *
+ *  @returns
+ *    True if the reclaimer thread is running; otherwise, false.
+ *
+ *  @sa CFUReleaseQueueStopReclaimer
+ *
+ *  @ingroup base
+ *
+ */
+bool
+CFUReleaseQueueStartReclaimer(void)
+{
+    CFUReleaseQueueState * const theState = CFUReleaseQueueGetState();
+    int                          theStatus;
+    bool                         theRetval = false;
+
+    __Require(theState != nullptr, done);
+
+    pthread_mutex_lock(&theState->mMutex);
+
+    __Require_Quiet(!theState->mRunning, unlock);
+
+    theState->mStopping = false;
+
+    // Failing to start a thread, for example for want of resources,
+    // is reported to the caller rather than asserted.
+
+    theStatus = pthread_create(&theState->mReclaimer,
+                               nullptr,
+                               CFUReleaseQueueReclaim,
+                               theState);
+    __Require_Quiet(theStatus == 0, unlock);
+
+    theState->mRunning = true;
+
+ unlock:
+    theRetval = theState->mRunning;
+
+    pthread_mutex_unlock(&theState->mMutex);
+
+ done:
+    return (theRetval);
+}
+
+/**
+ *  @brief
+ *    Stops the background thread for deferred releases.
+ *
+ *  This routine stops the reclaimer thread, if running, waiting for
+ *  it to finish any batch it is releasing. Batches handed off and
+ *  not yet released remain so until the next call to
+ *  #CFUReleaseQueueDrain or until the reclaimer thread is restarted.
+ *
+ *  @note
+ *    This routine must not be called concurrently with itself or
+ *    with #CFUReleaseQueueStartReclaimer.
+ *
+ *  @sa CFUReleaseQueueStartReclaimer
+ *
+ *  @ingroup base
+ *
+ */
+void
+CFUReleaseQueueStopReclaimer(void)
+{
+    CFUReleaseQueueState * const theState = CFUReleaseQueueGetState();
+    pthread_t                    theReclaimer;
+    bool                         theRunning;
+
+    __Require_Quiet(theState != nullptr, done);
+
+    pthread_mutex_lock(&theState->mMutex);
+
+    theRunning   = theState->mRunning;
+    theReclaimer = theState->mReclaimer;
+
+    theState->mStopping = true;
+
+    pthread_cond_signal(&theState->mCondition);
+
+    pthread_mutex_unlock(&theState->mMutex);
+
+    __Require_Quiet(theRunning, done);
+
+    pthread_join(theReclaimer, nullptr);
+
+    pthread_mutex_lock(&theState->mMutex);
+
+    theState->mRunning  = false;
+    theState->mStopping = false;
+
+    pthread_mutex_unlock(&theState->mMutex);
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Copy the strings of an array into a contiguous UTF-8 arena.
+ *
+ *  This routine copies the UTF-8 bytes of every string in the
+ *  specified array, end to end, into a single arena, recording the
+ *  offset at which each begins. String @a i occupies the bytes from
+ *  @a outOffsets[i] up to, but excluding, @a outOffsets[i + 1].
+ *
+ *  Strings backed by ASCII storage are copied directly; others are
+ *  transcoded directly into the arena.
+ *
+ *  @param[in]   inArray     A reference to the array of strings to
+ *                           copy.
+ *  @param[out]  outBytes    A reference to storage for the arena of
+ *                           UTF-8 bytes, which are not
+ *                           null-terminated per string.
+ *  @param[out]  outOffsets  A reference to storage for the offsets,
+ *                           one more than the number of strings, of
+ *                           each string in @a outBytes.
+ *
+ *  @returns
+ *    True if OK; otherwise, false if the array is null, contains a
+ *    value other than a string, or contains a string that cannot be
+ *    converted to UTF-8, such as one with an unpaired surrogate, in
+ *    which case both @a outBytes and @a outOffsets are empty.
+ *
+ *  @ingroup array
+ *
+ */
+bool
+CFUArrayCopyStrings(CFArrayRef       inArray,
+                    string &         outBytes,
+                    vector<size_t> & outOffsets)
+{
+    const CFTypeID    theStringTypeID = CFStringGetTypeID();
+    vector<CFTypeRef> theValues;
+    CFIndex           theCount;
+    CFIndex           theLength;
+    size_t            theTotal        = 0;
+    size_t            theSize;
+    const char *      theBytes;
+    CFIndex           theCharacters;
+    CFIndex           theConverted;
+    bool              theRetval       = false;
+
+    outBytes.clear();
+    outOffsets.clear();
+
+    __Require(inArray != nullptr, done);
+
+    theCount = CFArrayGetCount(inArray);
+
+    theValues.resize(static_cast<size_t>(theCount));
+
+    CFArrayGetValues(inArray, CFRangeMake(0, theCount), theValues.data());
+
+    // Size the arena once, for the common case of ASCII strings,
+    // whose UTF-8 length is their UTF-16 length.
+
+    for (CFIndex i = 0; i < theCount; i++)
+    {
+        __Require(CFUIsTypeID(theValues[i], theStringTypeID), done);
+
+        theTotal += static_cast<size_t>(CFStringGetLength(static_cast<CFStringRef>(theValues[i])));
+    }
+
+    outBytes.reserve(theTotal);
+    outOffsets.reserve(static_cast<size_t>(theCount) + 1);
+
+    for (CFIndex i = 0; i < theCount; i++)
+    {
+        const CFStringRef theString = static_cast<CFStringRef>(theValues[i]);
+
+        outOffsets.push_back(outBytes.size());
+
+        theLength = CFStringGetLength(theString);
+        theBytes  = CFStringGetCStringPtr(theString, kCFStringEncodingASCII);
+
+        if (theBytes != nullptr)
+        {
+            outBytes.append(theBytes, static_cast<size_t>(theLength));
+        }
+        else
+        {
+            // Transcode directly into the arena, sized for the worst
+            // case, and then trim it to the bytes actually produced.
+
+            theSize = outBytes.size();
+
+            outBytes.resize(theSize +
+                            static_cast<size_t>(CFStringGetMaximumSizeForEncoding(theLength,
+                                                                                  kCFStringEncodingUTF8)));
+
+            theCharacters = CFStringGetBytes(theString,
+                                             CFRangeMake(0, theLength),
+                                             kCFStringEncodingUTF8,
+                                             0,
+                                             false,
+                                             reinterpret_cast<UInt8 *>(&outBytes[theSize]),
+                                             static_cast<CFIndex>(outBytes.size() - theSize),
+                                             &theConverted);
+
+            // Without a loss byte, conversion stops short at any
+            // character, such as an unpaired surrogate, that has no
+            // UTF-8 form.
+
+            __Require(theCharacters == theLength, done);
+
+            outBytes.resize(theSize + static_cast<size_t>(theConverted));
+        }
+    }
+
+    outOffsets.push_back(outBytes.size());
+
+    theRetval = true;
+
+done:
+    if (!theRetval)
+    {
+        outBytes.clear();
+        outOffsets.clear();
+    }
+
+    return (theRetval);
+}
+
+/**
+ *  This routine returns a reference to a CoreFoundation Boolean
+ *  object equivalent to the specified Boolean value.
+ *
+ *  @param[in] inBoolean  A Boolean value for which the corresponding
+ *                        CoreFoundation Boolean object reference is
+ *                        to be returned.
+ *
+ *  @returns
+ *    kCFBooleanTrue if true; otherwise, kCFBooleanFalse.
+ *
+ *  @ingroup boolean
+ *
+ */
+CFBooleanRef
+CFUBooleanCreate(bool inBoolean)
+{
+    return (inBoolean ? kCFBooleanTrue : kCFBooleanFalse);
+}
+
+/**
+ *  This routine converts the specified CoreFoundation absolute time
+ *  into an equivalent POSIX time.
+ *
+ *  @param[in]  inAt  The CoreFoundation absolute time to convert.
+ *
+ *  @returns
+ *    The POSIX time.
+ *
+ *  @sa CFUPOSIXTimeGetAbsoluteTime
+ *
+ *  @ingroup date-time
+ *
+ */
+time_t
+CFUAbsoluteTimeGetPOSIXTime(CFAbsoluteTime inAt)
+{
+    return (static_cast<time_t>(inAt + kCFAbsoluteTimeIntervalSince1970));
+}
+
+/**
+ *  This routine converts the specified POSIX time into an
+ *  equivalent CoreFoundation absolute time.
+ *
+ *  @param[in]  inTime  The POSIX time to convert.
+ *
+ *  @returns
+ *    The CoreFoundation absolute time.
+ *
+ *  @sa CFUAbsoluteTimeGetPOSIXTime
+ *
+ *  @ingroup date-time
+ *
+ */
+CFAbsoluteTime
+CFUPOSIXTimeGetAbsoluteTime(time_t inTime)
+{
+    return (static_cast<CFAbsoluteTime>(inTime) - kCFAbsoluteTimeIntervalSince1970);
+}
+
+/**
+ *  This routine converts the specified CoreFoundation date
+ *  reference into an equivalent POSIX time.
+ *
+ *  @param[in]  inDate  The CoreFoundation date reference to convert.
+ *
+ *  @returns
+ *    The POSIX time.
+ *
+ *  @ingroup date-time
+ *
+ */
+time_t
+CFUDateGetPOSIXTime(CFDateRef inDate)
+{
+    time_t tempTime = 0;
+
+    __Require(inDate != nullptr, done);
+
+    tempTime = CFUAbsoluteTimeGetPOSIXTime(CFDateGetAbsoluteTime(inDate));
+
+done:
+    return (tempTime);
+}
+
+/**
+ *  This routine creates a CoreFoundation date object from the
+ *  specified POSIX time.
+ *
+ *  @param[in]  inAllocator  The allocator with which to create the
+ *                           CoreFoundation date object.
+ *  @param[in]  inTime       The POSIX time to convert.
+ *
+ *  @returns
+ *    A reference to a CoreFoundation date object if OK; otherwise, null.
+ *
+ *  @ingroup date-time
+ *
+ */
+CFDateRef
+CFUDateCreate(CFAllocatorRef inAllocator, time_t inTime)
+{
+    return (CFDateCreate(inAllocator, CFUPOSIXTimeGetAbsoluteTime(inTime)));
+}
+
+/**
+ *  This routine returns a new array containing all the keys in the
+ *  specified dictionary. The caller owns the returned array.
+ *
+ *  @param[in]  inDictionary  A reference to the dictionary to get the
+ *                            keys from.
+ *
+ *  @returns
+ *    A reference to an array containing the keys on success;
+ *    otherwise, null on error.
+ *
+ *  @ingroup dictionary
+ *
+ */
+CFArrayRef
+CFUDictionaryCopyKeys(CFDictionaryRef inDictionary)
+{
+    return (CFUDictionaryCopyKeysWithAllocator(kCFAllocatorDefault, inDictionary));
+}
+
+/**
+ *  This routine returns a new array, created with the specified
+ *  allocator, containing all the keys in the specified
+ *  dictionary. The caller owns the returned array.
+ *
+ *  @param[in]  inAllocator   The allocator with which to create the
+ *                            array.
+ *  @param[in]  inDictionary  A reference to the dictionary to get the
+ *                            keys from.
+ *
+ *  @returns
+ *    A reference to an array containing the keys on success;
+ *    otherwise, null on error.
+ *
+ *  @ingroup dictionary
+ *
+ */
+CFArrayRef
+CFUDictionaryCopyKeysWithAllocator(CFAllocatorRef  inAllocator,
+                                   CFDictionaryRef inDictionary)
+{
+    CFIndex              numKeys;
+    vector<const void *> theKeys;
+    CFArrayRef           arrayRef = nullptr;
+
+    __Require(inDictionary != nullptr, done);
+
+    numKeys = CFDictionaryGetCount(inDictionary);
+
+    theKeys.resize(static_cast<size_t>(numKeys));
+
+    CFDictionaryGetKeysAndValues(inDictionary, theKeys.data(), nullptr);
+
+    arrayRef = CFArrayCreate(inAllocator,
+                             theKeys.data(),
+                             numKeys,
+                             &kCFTypeArrayCallBacks);
+
+done:
+    return (arrayRef);
+}
+
+/**
+ *  This routine is a CoreFoundation dictionary applier function
+ *  that iterates on each entry in a source dictionary and performs
+ *  the actual merge of those entries with a destination dictionary.
+ *
+ *  @param[in]      inKey      A pointer to the key of the current
+ *                             key/value pair being iterated upon.
+ *  @param[in]      inValue    A pointer to the value of the current
+ *                             key/value pair being iterated upon.
+ *  @param[in,out]  inContext  A pointer to the iterator context. On
+ *                             completion, the context's dictionary
+ *                             member will have been updated with the
+ *                             results of the current key/value pair
+ *                             iteration merge.
+ *
+ */
+static void
+CFUDictionaryMergeApplier(const void * inKey,
+                          const void * inValue,
+                          void *       inContext)
+{
+    CFUDictionaryMergeContext * theContext = nullptr;
+    bool                        hasKey;
+
+    __Require(inKey     != nullptr, done);
+    __Require(inContext != nullptr, done);
+
+    theContext = static_cast<CFUDictionaryMergeContext *>(inContext);
+
+    hasKey = CFDictionaryContainsKey(theContext->mDestinationDictionary, inKey);
+
+    /*
+     * If the key is absent or if the key is present and replacement
+     * has been requested, add or replace the key/value pair as
+     * appropriate.
+     */
+
+    if (!hasKey) {
+        CFDictionaryAddValue(theContext->mDestinationDictionary,
+                             inKey,
+                             inValue);
+
+    } else if (hasKey && theContext->mReplace) {
+        CFDictionaryReplaceValue(theContext->mDestinationDictionary,
+                                 inKey,
+                                 inValue);
+    }
+
+done:
+    return;
+}
+
+/**
+ *  This routine is a CoreFoundation dictionary applier function that
+ *  iterates on each key/value pair of an added, common, removed
+ *  difference dictionary (likely generated from
+ *  #CFUDictionaryDifference) and applies the difference to the base
+ *  dictionary as appropriate for the current algorithm phase.
+
+ *
+ *  @param[in]      inKey      A pointer to the key of the current
+ *                             key/value pair being iterated upon.
+ *  @param[in]      inValue    A pointer to the value of the current
+ *                             key/value pair being iterated upon.
+ *  @param[in,out]  inContext  A pointer to the iterator context. On
+ *                             completion and depending on the context
+ *                             phase, the add phase will add those
+ *                             key/value pairs to the base; the remove
+ *                             phase will remove those key/value pairs
+ *                             from the base; and the phase will
+ *                             replace those key/value pairs for which
+ *                             the value is different in the common
+ *                             relative to the base with the value
+ *                             from the common.
+ *
+ *  @private
+ *
+ */
+static void
+CFUDictionaryMergeWithDifferencesApplier(const void * inKey,
+                                         const void * inValue,
+                                         void *       inContext)
+{
+    CFStringRef                                 theKey     =
+        static_cast<CFStringRef>(inKey);
+    CFTypeRef                                   theValue   =
+        static_cast<CFTypeRef>(inValue);
+    CFUDictionaryMergeWithDifferencesContext *  theContext =
+        static_cast<CFUDictionaryMergeWithDifferencesContext *>(inContext);
+
+    __Require(theKey     != nullptr, done);
+    __Require(theValue   != nullptr, done);
+    __Require(theContext != nullptr, done);
+
+    // If the phase is add, set the key/value pair.
+    //
+    // If the phase is common, replace the key/value pair if unequal.
+    //
+    // If the phase is remove, remove the key/value pair.
+
+    if (theContext->mPhase == kCFUDictionaryDifferencePhaseAdd)
+    {
+        CFDictionarySetValue(theContext->mDestinationDictionary, theKey, theValue);
+    }
+    else if (theContext->mPhase == kCFUDictionaryDifferencePhaseCommon)
+    {
+        CFTypeRef      theCurrentValue;
+        Boolean        lEqual;
+
+        theCurrentValue = static_cast<CFTypeRef>(CFDictionaryGetValue(theContext->mDestinationDictionary, theKey));
+        __Require(theCurrentValue != nullptr, done);
+
+        lEqual = CFEqual(theCurrentValue, theValue);
+
+        if (!lEqual)
+        {
+            CFDictionaryReplaceValue(theContext->mDestinationDictionary, theKey, theValue);
+        }
+    }
+    else if (theContext->mPhase == kCFUDictionaryDifferencePhaseRemove)
+    {
+        CFDictionaryRemoveValue(theContext->mDestinationDictionary, theKey);
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  This routine is a CoreFoundation array applier function that
+ *  iterates on each value of a removed keys array and applies them
+ *  difference to the base dictionary, as appropriate for the current
+ *  algorithm phase, by removing the corresponding key/value pairs
+ *  from the base dictionary.
+ *
+ *  @param[in]      inValue    A pointer to the current value being
+ *                             iterated upon. This value is actually a
+ *                             dictionary key.
+ *  @param[in,out]  inContext  A pointer to the iterator context. On
+ *                             completion and depending on the context
+ *                             phase, the remove phase will remove
+ *                             those key/value pairs from the base.
+ *
+ *  @private
+ *
+ */
+static void
+CFUDictionaryMergeWithDifferencesApplierAndRemovedKeysApplier(const void * inValue,
+                                                              void *       inContext)
+{
+    // Note that that since this actually matches the signature of an
+    // array applier, in this context, the array values are actually
+    // dictionary keys. Consequently, the local is named accordingly.
+
+    CFDictionaryRef                             theKey     =
+        static_cast<CFDictionaryRef>(inValue);
+    CFUDictionaryMergeWithDifferencesContext *  theContext =
+        static_cast<CFUDictionaryMergeWithDifferencesContext *>(inContext);
+
+    __Require(theKey     != nullptr, done);
+    __Require(theContext != nullptr, done);
+
+    // There is only work to do in this case for the removal
+    // phase. Other phases are handled with other applier functions.
+
+    if (theContext->mPhase == kCFUDictionaryDifferencePhaseRemove)
+    {
+        CFDictionaryRemoveValue(theContext->mDestinationDictionary, theKey);
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Merge a CoreFoundation dictionary from one or more difference
+ *    dictionaries.
+ *
+ *  This routine merges a mutable CoreFoundation dictionary from one
+ *  or more difference dictionaries (likely generated from
+ *  #CFUDictionaryDifference). If present, key/value pairs in the @a
+ *  inAdded dictionary are added to @a inOutBase and, if present,
+ *  key/value pairs in the @a inCommon dictionary replace those in @a
+ *  inOutBase if the values are different.
+ *
+ *  @param[in,out]  inOutBase  A reference to the mutable dictionary
+ *                             to merge keys and values to. On
+ *                             success, @a inOutBase contains a
+ *                             reference to the destination dictionary
+ *                             with entries from the added and common
+ *                             dictionaries merged in.
+ *  @param[out]     inAdded    An optional reference to the dictionary
+ *                             containing entries to be added to the
+ *                             base dictionary. If null, no such
+ *                             entries will be added.
+ *  @param[in]      inCommon   An optional reference to the dictionary
+ *                             containing entries common to the base
+ *                             dictionary, but potentially with
+ *                             different values. Values that are
+ *                             different will replace those in the
+ *                             base. If null, no such entries will be
+ *                             replaced.
+ *
+ *  @private
+ *
+ */
+static void
+CFUDictionaryMerge(CFUDictionaryMergeWithDifferencesContext &  inOutContext,
+                   CFMutableDictionaryRef                      inOutBase,
+                   CFDictionaryRef                             inAdded,
+                   CFDictionaryRef                             inCommon)
+{
+    inOutContext.mDestinationDictionary = inOutBase;
+
+    if (inAdded != nullptr)
+    {
+        // Add new values
+
+        inOutContext.mPhase = kCFUDictionaryDifferencePhaseAdd;
+
+        CFDictionaryApplyFunction(inAdded,
+                                  CFUDictionaryMergeWithDifferencesApplier,
+                                  &inOutContext);
+    }
+
+    if (inCommon != nullptr)
+    {
+        // Update common values;
+
+        inOutContext.mPhase = kCFUDictionaryDifferencePhaseCommon;
+
+        CFDictionaryApplyFunction(inCommon,
+                                  CFUDictionaryMergeWithDifferencesApplier,
+                                  &inOutContext);
+    }
+}
+
+/**
+ *  @brief
+ *    Merge a CoreFoundation dictionary from one or more difference
+ *    dictionaries.
+ *
+ *  This routine merges a mutable CoreFoundation dictionary from one
+ *  or more difference dictionaries (likely generated from
+ *  #CFUDictionaryDifference). If present, key/value pairs in the @a
+ *  inAdded dictionary are added to @a inOutBase; if present,
+ *  key/value pairs in the @a inCommon dictionary replace those in @a
+ *  inOutBase if the values are different; and, if present, key/value
+ *  pairs in the @a inRemoved dictionary are removed from @a
+ *  inOutBase.
+ *
+ *  @param[in,out]  inOutBase  A reference to the mutable dictionary
+ *                             to merge keys and values to. On
+ *                             success, @a inOutBase contains
+ *                             a reference to the destination
+ *                             dictionary with entries from the
+ *                             added, common, and removed
+ *                             dictionaries merged in.
+ *  @param[out]     inAdded    An optional reference to the dictionary
+ *                             containing entries to be added to the
+ *                             base dictionary. If null, no such
+ *                             entries will be added.
+ *  @param[in]      inCommon   An optional reference to the dictionary
+ *                             containing entries common to the base
+ *                             dictionary, but potentially with
+ *                             different values. Values that are
+ *                             different will replace those in the
+ *                             base. If null, no such entries will be
+ *                             replaced.
+ *  @param[in]      inRemoved  An optional reference to the dictionary
+ *                             containing entries to be removed from
+ *                             the base dictionary. If null, no such
+ *                             entries will be removed.
+ *
+ *  @returns
+ *    True if the merge was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied.
+ *
+ *  @sa CFUDictionaryDifference
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryMerge(CFMutableDictionaryRef inOutBase,
+                   CFDictionaryRef        inAdded,
+                   CFDictionaryRef        inCommon,
+                   CFDictionaryRef        inRemoved)
+{
+    CFUDictionaryMergeWithDifferencesContext  theContext;
+    Boolean                                   status = true;
+
+    __Require_Action(inOutBase != nullptr, done, status = false);
+
+    // Add new and update common values
+
+    CFUDictionaryMerge(theContext, inOutBase, inAdded, inCommon);
+
+    if (inRemoved != nullptr)
+    {
+        // Remove old values
+
+        theContext.mPhase = kCFUDictionaryDifferencePhaseRemove;
+
+        CFDictionaryApplyFunction(inRemoved,
+                                  CFUDictionaryMergeWithDifferencesApplier,
+                                  &theContext);
+    }
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Merge a CoreFoundation dictionary from one or more difference
+ *    dictionaries.
+ *
+ *  This routine merges a mutable CoreFoundation dictionary from two
+ *  or more difference dictionaries (likely generated from
+ *  #CFUDictionaryDifference) and a difference array, containing
+ *  removed keys. If present, key/value pairs in the @a inAdded
+ *  dictionary are added to @a inOutBase; if present, key/value pairs
+ *  in the @a inCommon dictionary replace those in @a inOutBase if the
+ *  values are different; and, if present, keys in the @a
+ *  inRemovedKeys array are removed from @a inOutBase.
+ *
+ *  @param[in,out]  inOutBase      A reference to the mutable
+ *                                 dictionary to merge keys and values
+ *                                 to. On success, @a inOutBase
+ *                                 contains a reference to the
+ *                                 destination dictionary with entries
+ *                                 from the added and common
+ *                                 dictionaries and the removed keys
+ *                                 array merged in.
+ *  @param[out]     inAdded        An optional reference to the
+ *                                 dictionary containing entries to be
+ *                                 added to the base dictionary. If
+ *                                 null, no such entries will be
+ *                                 added.
+ *  @param[in]      inCommon       An optional reference to the
+ *                                 dictionary containing entries
+ *                                 common to the base dictionary, but
+ *                                 potentially with different
+ *                                 values. Values that are different
+ *                                 will replace those in the base. If
+ *                                 null, no such entries will be
+ *                                 replaced.
+ *  @param[in]      inRemovedKeys  An optional reference to the array
+ *                                 containing key to be removed from
+ *                                 the base dictionary. If null, no such
+ *                                 entries will be removed.
+ *
+ *  @returns
+ *    True if the merge was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryMerge(CFMutableDictionaryRef inOutBase,
+                   CFDictionaryRef        inAdded,
+                   CFDictionaryRef        inCommon,
+                   CFArrayRef             inRemovedKeys)
+{
+    CFUDictionaryMergeWithDifferencesContext  theContext;
+    Boolean                                   status = true;
+
+    __Require_Action(inOutBase != nullptr, done, status = false);
+
+    // Add new and update common values
+
+    CFUDictionaryMerge(theContext, inOutBase, inAdded, inCommon);
+
+    if (inRemovedKeys != nullptr)
+    {
+        // Remove old values
+
+        theContext.mPhase = kCFUDictionaryDifferencePhaseRemove;
+
+        CFArrayApplyFunction(inRemovedKeys,
+                             CFRangeMake(0, CFArrayGetCount(inRemovedKeys)),
+                             CFUDictionaryMergeWithDifferencesApplierAndRemovedKeysApplier,
+                             &theContext);
+    }
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Merge two CoreFoundation dictionaries.
+ *
+ *  This routine adds the key and value pairs from the specified
+ *  source dictionary to the destination dictionary, replacing values
+ *  with matching keys if requested.
+ *
+ *  @param[in,out]  inDestination  A reference to the mutable dictionary
+ *                                 to merge keys and values to. On
+ *                                 success, @a inDestination contains
+ *                                 a reference to the destination
+ *                                 dictionary with entries from the
+ *                                 source dictionary merged in.
+ *  @param[in]      inSource       A reference to the dictionary to merge
+ *                                 keys and values from.
+ *  @param[in]      inReplace      A Boolean flag indicating whether
+ *                                 values from the source dictionary
+ *                                 will replace values in the
+ *                                 destination when the keys for those
+ *                                 values already exist in the
+ *                                 destination.
+ *
+ *  @returns
+ *    True if the merge was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryMerge(CFMutableDictionaryRef inDestination,
+                   CFDictionaryRef        inSource,
+                   bool                   inReplace)
+{
+    CFUDictionaryMergeContext theContext = { inDestination, inReplace };
+    Boolean                   status     = true;
+
+    __Require_Action(inDestination != nullptr, done, status = false);
+    __Require_Action(inSource      != nullptr, done, status = false);
+
+    CFDictionaryApplyFunction(inSource, CFUDictionaryMergeApplier, &theContext);
+
+done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Merge a CoreFoundation dictionary from one or more difference
+ *    dictionaries.
+ *
+ *  This routine merges a mutable CoreFoundation dictionary from one
+ *  or more difference dictionaries (likely generated from
+ *  #CFUDictionaryDifference). If present, key/value pairs in the @a
+ *  inAdded dictionary are added to @a inOutBase; if present,
+ *  key/value pairs in the @a inCommon dictionary replace those in @a
+ *  inOutBase if the values are different; and, if present, key/value
+ *  pairs in the @a inRemoved dictionary are removed from @a
+ *  inOutBase.
+ *
+ *  @param[in,out]  inOutBase  A reference to the mutable dictionary
+ *                             to merge keys and values to. On
+ *                             success, @a inOutBase contains
+ *                             a reference to the destination
+ *                             dictionary with entries from the
+ *                             added, common, and removed
+ *                             dictionaries merged in.
+ *  @param[out]     inAdded    An optional reference to the dictionary
+ *                             containing entries to be added to the
+ *                             base dictionary. If null, no such
+ *                             entries will be added.
+ *  @param[in]      inCommon   An optional reference to the dictionary
+ *                             containing entries common to the base
+ *                             dictionary, but potentially with
+ *                             different values. Values that are
+ *                             different will replace those in the
+ *                             base. If null, no such entries will be
+ *                             replaced.
+ *  @param[in]      inRemoved  An optional reference to the dictionary
+ *                             containing entries to be removed from
+ *                             the base dictionary. If null, no such
+ *                             entries will be removed.
+ *
+ *  @returns
+ *    True if the merge was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryMergeWithDifferences(CFMutableDictionaryRef inOutBase,
+                                  CFDictionaryRef        inAdded,
+                                  CFDictionaryRef        inCommon,
+                                  CFDictionaryRef        inRemoved)
+{
+    Boolean status = true;
+
+    status = CFUDictionaryMerge(inOutBase,
+                                inAdded,
+                                inCommon,
+                                inRemoved);
+
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Merge a CoreFoundation dictionary from one or more difference
+ *    dictionaries.
+ *
+ *  This routine merges a mutable CoreFoundation dictionary from two
+ *  or more difference dictionaries (likely generated from
+ *  #CFUDictionaryDifference) and a difference array, containing
+ *  removed keys. If present, key/value pairs in the @a inAdded
+ *  dictionary are added to @a inOutBase; if present, key/value pairs
+ *  in the @a inCommon dictionary replace those in @a inOutBase if the
+ *  values are different; and, if present, keys in the @a
+ *  inRemovedKeys array are removed from @a inOutBase.
+ *
+ *  @param[in,out]  inOutBase      A reference to the mutable
+ *                                 dictionary to merge keys and values
+ *                                 to. On success, @a inOutBase
+ *                                 contains a reference to the
+ *                                 destination dictionary with entries
+ *                                 from the added and common
+ *                                 dictionaries and the removed keys
+ *                                 array merged in.
+ *  @param[out]     inAdded        An optional reference to the
+ *                                 dictionary containing entries to be
+ *                                 added to the base dictionary. If
+ *                                 null, no such entries will be
+ *                                 added.
+ *  @param[in]      inCommon       An optional reference to the
+ *                                 dictionary containing entries
+ *                                 common to the base dictionary, but
+ *                                 potentially with different
+ *                                 values. Values that are different
+ *                                 will replace those in the base. If
+ *                                 null, no such entries will be
+ *                                 replaced.
+ *  @param[in]      inRemovedKeys  An optional reference to the array
+ *                                 containing key to be removed from
+ *                                 the base dictionary. If null, no such
+ *                                 entries will be removed.
+ *
+ *  @returns
+ *    True if the merge was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryMergeWithDifferencesAndRemovedKeys(CFMutableDictionaryRef inOutBase,
+                                                CFDictionaryRef        inAdded,
+                                                CFDictionaryRef        inCommon,
+                                                CFArrayRef             inRemovedKeys)
+{
+    Boolean status = true;
+
+    status = CFUDictionaryMerge(inOutBase,
+                                inAdded,
+                                inCommon,
+                                inRemovedKeys);
+
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Get a Boolean value from a CoreFoundation dictionary.
+ *
+ *  This routine is a type-safe wrapper that allows using intrinsic
+ *  C/C++ standard @a bool value types rather than
+ *  CoreFoundation-defined @a Boolean value types.
+ *
+ *  @param[in]      inDictionary  A reference to the CoreFoundation
+ *                                dictionary to get the Boolean from.
+ *  @param[in]      inKey         A pointer to the key for which to
+ *                                find a Boolean in the dictionary.
+ *  @param[in,out]  outValue      A reference to storage for the
+ *                                converted Boolean.
+ *
+ *  @returns
+ *    True if the requested Boolean was successfully retrieved;
+ *    otherwise, false.
+ *
+ *  @sa CFUDictionarySetBoolean
+ *  @sa CFUDictionarySetNumber
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryGetBoolean(CFDictionaryRef inDictionary,
+                        const void *    inKey,
+                        bool &          outValue)
+{
+    Boolean status, tempBool;
+
+    status = CFUDictionaryGetBoolean(inDictionary, inKey, tempBool);
+    __Require_Quiet(status, done);
+
+    outValue = tempBool;
+
+done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Get a Boolean value from a CoreFoundation dictionary.
+ *
+ *  This routine attempts to retrieve and convert the CoreFoundation
+ *  Boolean associated with the specified key from the provided
+ *  dictionary and convert it to the specified Boolean value.
+ *
+ *  @param[in]      inDictionary  A reference to the CoreFoundation
+ *                                dictionary to get the Boolean from.
+ *  @param[in]      inKey         A pointer to the key for which to
+ *                                find a Boolean in the dictionary.
+ *  @param[in,out]  outValue      A reference to storage for the
+ *                                converted Boolean.
+ *
+ *  @returns
+ *    True if the requested Boolean was successfully retrieved;
+ *    otherwise, false.
+ *
+ *  @sa CFUDictionarySetBoolean
+ *  @sa CFUDictionarySetNumber
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryGetBoolean(CFDictionaryRef inDictionary,
+                        const void *    inKey,
+                        Boolean &       outValue)
+{
+    bool         status      = false;
+    CFBooleanRef tempBoolean = nullptr;
+
+    // Sanity check the input parameters.
+
+    __Require(inDictionary != nullptr, done);
+    __Require(inKey != nullptr, done);
+
+    // Attempt to get the value from the dictionary.
+
+    tempBoolean = static_cast<CFBooleanRef>(
+        CFDictionaryGetValue(inDictionary, inKey));
+
+    // The key being absent is a quiet failure; whereas, the value not
+    // being of type Boolean is.
+
+    __Require_Quiet(tempBoolean != nullptr, done);
+    __Require(CFUIsTypeID(tempBoolean, CFBooleanGetTypeID()), done);
+
+    outValue = CFBooleanGetValue(tempBoolean);
+
+    status = true;
+
+done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Set a Boolean value in a CoreFoundation dictionary.
+ *
+ *  This routine sets the specified Boolean value in the provided
+ *  dictionary associated with the specified key.
+ *
+ *  @param[in,out]  inDictionary  A reference to the CoreFoundation
+ *                                dictionary to set the Boolean in. On
+ *                                success, the dictionary is modified
+ *                                with a reference to the Boolean as a
+ *                                CoreFoundation Boolean value.
+ *  @param[in]      inKey         A pointer to the key with which to
+ *                                associate the Boolean in the
+ *                                dictionary.
+ *  @param[in]      inValue       The Boolean value to set.
+ *
+ *  @returns
+ *    True if the value was successfully set; otherwise, false.
+ *
+ *  @sa CFUDictionaryGetBoolean
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionarySetBoolean(CFMutableDictionaryRef inDictionary,
+                        const void *           inKey,
+                        Boolean                inValue)
+{
+    bool status = false;
+
+    __Require(inDictionary != nullptr, done);
+    __Require(inKey != nullptr, done);
+
+    CFDictionarySetValue(inDictionary,
+                         inKey,
+                         (inValue ? kCFBooleanTrue : kCFBooleanFalse));
+
+    status = true;
+
+done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Add a null-termited C string to a dictionary.
+
+ *  This routine sets the specified null-terminated C string value, as
+ *  a CFString, in the provided dictionary associated with the
+ *  specified key.
+ *
+ *  @param[in,out]  inDictionary  A reference to the CoreFoundation
+ *                                dictionary to set the
+ *                                null-terminated C string in. On
+ *                                success, the dictionary is modified
+ *                                with a reference to the CFString
+ *                                value equivalent to the
+ *                                null-terminated C string set.
+ *  @param[in]      inKey         A pointer to the key with which to
+ *                                associate the null-terminated C
+ *                                string in the dictionary.
+ *  @param[in]      inString      The null-terminated C string value to set.
+ *
+ *  @returns
+ *    True if the value was successfully set; otherwise, false.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionarySetCString(CFMutableDictionaryRef inDictionary,
+                        const void *           inKey,
+                        const char *           inString)
+{
+    bool        status     = false;
+    CFStringRef tempString = nullptr;
+
+    __Require(inDictionary != nullptr, done);
+    __Require(inKey != nullptr, done);
+    __Require(inString != nullptr, done);
+
+    // Where the system encoding is UTF-8, take the validated,
+    // ASCII-optimized creation path.
+
+    if (CFStringGetSystemEncoding() == kCFStringEncodingUTF8) {
+        tempString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault,
+                                                  inString,
+                                                  strlen(inString));
+    } else {
+        tempString = CFStringCreateWithCString(kCFAllocatorDefault,
+                                               inString,
+                                               CFStringGetSystemEncoding());
+    }
+    __Require(tempString != nullptr, done);
+
+    CFDictionarySetValue(inDictionary, inKey, tempString);
+
+    status = true;
+
+done:
+    CFURelease(tempString);
+
+    return (status);
+}
+
+/**
+ *  This routine is a CoreFoundation dictionary applier function
+ *  that iterates on each key/value pair of a base or proposed
+ *  dictionary and determines whether each entry is unique or common
+ *  to the other.
+ *
+ *  @param[in]      inKey      A pointer to the key of the current
+ *                             key/value pair being iterated upon.
+ *  @param[in]      inValue    A pointer to the value of the current
+ *                             key/value pair being iterated upon.
+ *  @param[in,out]  inContext  A pointer to the iterator context. On
+ *                             completion and depending on the context
+ *                             phase, the context's added dictionary,
+ *                             if present, will contain entries unique
+ *                             to the proposed dictionary; the
+ *                             context's removed dictionary, if
+ *                             present, will contain entries unique to
+ *                             the base dictionary; and the context's
+ *                             common dictionary, if present, will
+ *                             contain entries common to both the base
+ *                             and proposed dictionaries but for which
+ *                             may have different values for their
+ *                             keys.
+ *
+ *  @private
+ *
+ */
+static void
+CFUDictionaryDifferenceApplier(const void *inKey,
+                               const void *inValue,
+                               void *inContext)
+{
+    CFStringRef                       theKey     = static_cast<CFStringRef>(inKey);
+    CFDictionaryRef                   theValue   = static_cast<CFDictionaryRef>(inValue);
+    CFUDictionaryDifferenceContext *  theContext = static_cast<CFUDictionaryDifferenceContext *>(inContext);
+
+    __Require(theKey != nullptr,     done);
+    __Require(theValue != nullptr,   done);
+    __Require(theContext != nullptr, done);
+
+    if (theContext->mPhase == kCFUDictionaryDifferencePhaseAdd)
+    {
+        const bool theDictionaryHasKey = CFDictionaryContainsKey(theContext->mBase, theKey);
+
+        if (!theDictionaryHasKey)
+        {
+            if (theContext->mAdded != nullptr)
+            {
+                CFDictionarySetValue(theContext->mAdded, theKey, theValue);
+            }
+        }
+        else
+        {
+            if (theContext->mCommon != nullptr)
+            {
+                CFDictionarySetValue(theContext->mCommon, theKey, theValue);
+            }
+        }
+    }
+    else if (theContext->mPhase == kCFUDictionaryDifferencePhaseRemove)
+    {
+        const bool theDictionaryHasKey = CFDictionaryContainsKey(theContext->mProposed, theKey);
+
+        if (!theDictionaryHasKey)
+        {
+            if (theContext->mRemoved != nullptr)
+            {
+                CFDictionarySetValue(theContext->mRemoved, theKey, theValue);
+            }
+        }
+        else
+        {
+            if (theContext->mCommon != nullptr)
+            {
+                CFDictionarySetValue(theContext->mCommon, theKey, theValue);
+            }
+        }
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Initialize a CoreFoundation dictionary difference context.
+ *
+ *  This intializes a CoreFoundation dictionary difference context for
+ *  a #CFUDictionaryDifference call.
+ *
+ *  @param[in]      inAllocator The allocator with which to create
+ *                              the base dictionary, if it is null.
+ *  @param[in]      inProposed  A reference to the dictionary serving
+ *                              as the focus of the difference.
+ *  @param[in,out]  inOutBase   An reference to a mutable dictionary
+ *                              reference serving as the base of the
+ *                              difference. The reference itself is
+ *                              optional and may be null. If the
+ *                              reference is null, a mutable
+ *                              dictionary will be allocated on the
+ *                              caller's behalf that becomes their
+ *                              responsiblity to release on success.
+ *  @param[out]     outAdded    An optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the proposed dictionary. If null,
+ *                              no such entries will be enumerated and
+ *                              populated.
+ *  @param[out]     outCommon   An optional reference to the mutable
+ *                              dictionary containing entries common
+ *                              to both the base and current
+ *                              dictionary but that may be changed
+ *                              between them in terms of values. If
+ *                              null, no such entries will be
+ *                              enumerated and populated.
+ *  @param[out]     outRemoved  A optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the base dictionary. If null, no
+ *                              such entries will be enumerated and
+ *                              populated.
+ *  @param[out]     outContext  A reference to the context to be
+ *                              intialized.
+ *
+ *  @returns
+ *    True if the difference was successful; otherwise, false. False
+ *    may be returned if memory allocation was unsuccessful.
+ *
+ *  @private
+ *
+ */
+static Boolean
+CFUDictionaryDifferenceContextSetup(CFAllocatorRef inAllocator,
+                                    CFDictionaryRef inProposed,
+                                    CFMutableDictionaryRef &inOutBase,
+                                    CFMutableDictionaryRef outAdded,
+                                    CFMutableDictionaryRef outCommon,
+                                    CFMutableDictionaryRef outRemoved,
+                                    CFUDictionaryDifferenceContext &outContext)
+{
+    Boolean status = true;
+
+    if (inOutBase == nullptr)
+    {
+        CFMutableDictionaryRef theTemporaryDictionary = nullptr;
+
+        theTemporaryDictionary = CFDictionaryCreateMutable(inAllocator,
+                                                           0,
+                                                           &kCFTypeDictionaryKeyCallBacks,
+                                                           &kCFTypeDictionaryValueCallBacks);
+        __Require_Action(theTemporaryDictionary != nullptr,
+                         done,
+                         status = false);
+
+        CFUReferenceSet(inOutBase, theTemporaryDictionary);
+
+        CFURelease(theTemporaryDictionary);
+    }
+
+    // Setup the difference context based on the provided dictionary
+    // arguments.
+
+    outContext.mProposed = inProposed;
+    outContext.mBase     = inOutBase;
+    outContext.mAdded    = outAdded;
+    outContext.mCommon   = outCommon;
+    outContext.mRemoved  = outRemoved;
+
+ done:
+    return (status);
+
+}
+
+/**
+ *  @brief
+ *    Apply a difference between the proposed and base dictionaries.
+ *
+ *  The attempts to apply a difference between the proposed and base
+ *  dictionaries, returning, if requested by virtue of non-null
+ *  mutable dictionary references, the entries between the proposed
+ *  and base dictionaries that are unique to the proposed (that is,
+ *  added relative to the base), unique to the proposed (that is,
+ *  removed relative to the base), and common between them, though
+ *  with potentially different values between the base and proposed in
+ *  such case, the common dictionary will contain the base value.
+ *
+ *  @param[in]      inProposed  A reference to the dictionary serving
+ *                              as the focus of the difference.
+ *  @param[in,out]  inOutBase   An reference to a mutable dictionary
+ *                              reference serving as the base of the
+ *                              difference. The reference itself is
+ *                              optional and may be null. If the
+ *                              reference is null, a mutable
+ *                              dictionary will be allocated on the
+ *                              caller's behalf that becomes their
+ *                              responsiblity to release on success.
+ *  @param[out]     outAdded    An optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the proposed dictionary. If null,
+ *                              no such entries will be enumerated and
+ *                              populated.
+ *  @param[out]     outCommon   An optional reference to the mutable
+ *                              dictionary containing entries common
+ *                              to both the base and current
+ *                              dictionary but that may be changed
+ *                              between them in terms of values. If
+ *                              null, no such entries will be
+ *                              enumerated and populated.
+ *  @param[out]     outRemoved  A optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the base dictionary. If null, no
+ *                              such entries will be enumerated and
+ *                              populated.
+ *
+ *  @returns
+ *    True if the difference was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied or if
+ *    memory allocation was unsuccessful.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryDifference(CFDictionaryRef inProposed,
+                        CFMutableDictionaryRef &inOutBase,
+                        CFMutableDictionaryRef outAdded,
+                        CFMutableDictionaryRef outCommon,
+                        CFMutableDictionaryRef outRemoved)
+{
+    return (CFUDictionaryDifference(kCFAllocatorDefault,
+                                    inProposed,
+                                    inOutBase,
+                                    outAdded,
+                                    outCommon,
+                                    outRemoved));
+}
+
+/**
+ *  @brief
+ *    Apply a difference between the proposed and base dictionaries.
+ *
+ *  The attempts to apply a difference between the proposed and base
+ *  dictionaries, returning, if requested by virtue of non-null
+ *  mutable dictionary references, the entries between the proposed
+ *  and base dictionaries that are unique to the proposed (that is,
+ *  added relative to the base), unique to the proposed (that is,
+ *  removed relative to the base), and common between them, though
+ *  with potentially different values between the base and proposed in
+ *  such case, the common dictionary will contain the base value.
+ *
+ *  If the base dictionary is null, it is created with the specified
+ *  allocator.
+ *
+ *  @param[in]      inAllocator The allocator with which to create
+ *                              the base dictionary, if it is null.
+ *  @param[in]      inProposed  A reference to the dictionary serving
+ *                              as the focus of the difference.
+ *  @param[in,out]  inOutBase   An reference to a mutable dictionary
+ *                              reference serving as the base of the
+ *                              difference. The reference itself is
+ *                              optional and may be null. If the
+ *                              reference is null, a mutable
+ *                              dictionary will be allocated on the
+ *                              caller's behalf that becomes their
+ *                              responsiblity to release on success.
+ *  @param[out]     outAdded    An optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the proposed dictionary. If null,
+ *                              no such entries will be enumerated and
+ *                              populated.
+ *  @param[out]     outCommon   An optional reference to the mutable
+ *                              dictionary containing entries common
+ *                              to both the base and current
+ *                              dictionary but that may be changed
+ *                              between them in terms of values. If
+ *                              null, no such entries will be
+ *                              enumerated and populated.
+ *  @param[out]     outRemoved  A optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the base dictionary. If null, no
+ *                              such entries will be enumerated and
+ *                              populated.
+ *
+ *  @returns
+ *    True if the difference was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied or if
+ *    memory allocation was unsuccessful.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryDifference(CFAllocatorRef inAllocator,
+                        CFDictionaryRef inProposed,
+                        CFMutableDictionaryRef &inOutBase,
+                        CFMutableDictionaryRef outAdded,
+                        CFMutableDictionaryRef outCommon,
+                        CFMutableDictionaryRef outRemoved)
+{
+    CFUDictionaryDifferenceContext theContext;
+    Boolean                        status = true;
+
+    __Require_Action(inProposed != nullptr, done, status = false);
+
+    // Setup the difference context.
+
+    status = CFUDictionaryDifferenceContextSetup(inAllocator,
+                                                 inProposed,
+                                                 inOutBase,
+                                                 outAdded,
+                                                 outCommon,
+                                                 outRemoved,
+                                                 theContext);
+    __Require(status, done);
+    __Require(inOutBase != nullptr, done);
+
+    // Generate the dictionary unique to the proposed dictionary by
+    // iterating over the proposed dictionary, representing "what is".
+
+    theContext.mPhase   = kCFUDictionaryDifferencePhaseAdd;
+
+    CFDictionaryApplyFunction(inProposed,
+                              CFUDictionaryDifferenceApplier,
+                              &theContext);
+
+    // Generate the dictionary unique to the base dictionary by
+    // iterating over the base dictionary, representing "what was".
+
+    theContext.mPhase   = kCFUDictionaryDifferencePhaseRemove;
+
+    CFDictionaryApplyFunction(inOutBase,
+                              CFUDictionaryDifferenceApplier,
+                              &theContext);
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Apply a difference between the proposed and base dictionaries.
+ *
+ *  The attempts to apply a difference between the proposed and base
+ *  dictionaries, returning, if requested by virtue of non-null
+ *  mutable dictionary references, the entries between the proposed
+ *  and base dictionaries that are unique to the proposed (that is,
+ *  added relative to the base), unique to the proposed (that is,
+ *  removed relative to the base), and common between them, though
+ *  with potentially different values between the base and proposed in
+ *  such case, the common dictionary will contain the base value.
+ *
+ *  @param[in]      inProposed  A reference to the dictionary serving
+ *                              as the focus of the difference.
+ *  @param[in,out]  inOutBase   A pointer to a mutable dictionary
+ *                              reference serving as the base of the
+ *                              difference. The reference itself is
+ *                              optional and may be null. If the
+ *                              reference is null, a mutable
+ *                              dictionary will be allocated on the
+ *                              caller's behalf that becomes their
+ *                              responsiblity to release on success.
+ *  @param[out]     outAdded    An optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the proposed dictionary. If null,
+ *                              no such entries will be enumerated and
+ *                              populated.
+ *  @param[out]     outCommon   An optional reference to the mutable
+ *                              dictionary containing entries common
+ *                              to both the base and current
+ *                              dictionary but that may be changed
+ *                              between them in terms of values. If
+ *                              null, no such entries will be
+ *                              enumerated and populated.
+ *  @param[out]     outRemoved  A optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the base dictionary. If null, no
+ *                              such entries will be enumerated and
+ *                              populated.
+ *
+ *  @returns
+ *    True if the difference was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied or if
+ *    memory allocation was unsuccessful.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryDifference(CFDictionaryRef inProposed,
+                        CFMutableDictionaryRef *inOutBase,
+                        CFMutableDictionaryRef outAdded,
+                        CFMutableDictionaryRef outCommon,
+                        CFMutableDictionaryRef outRemoved)
+{
+    Boolean status = true;
+
+    __Require_Action(inOutBase != nullptr, done, status = false);
+
+    status = CFUDictionaryDifference(inProposed,
+                                     *inOutBase,
+                                     outAdded,
+                                     outCommon,
+                                     outRemoved);
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Apply a difference between the proposed and base dictionaries.
+ *
+ *  The attempts to apply a difference between the proposed and base
+ *  dictionaries, returning, if requested by virtue of non-null
+ *  mutable dictionary references, the entries between the proposed
+ *  and base dictionaries that are unique to the proposed (that is,
+ *  added relative to the base), unique to the proposed (that is,
+ *  removed relative to the base), and common between them, though
+ *  with potentially different values between the base and proposed in
+ *  such case, the common dictionary will contain the base value.
+ *
+ *  If the base dictionary is null, it is created with the specified
+ *  allocator.
+ *
+ *  @param[in]      inAllocator The allocator with which to create
+ *                              the base dictionary, if it is null.
+ *  @param[in]      inProposed  A reference to the dictionary serving
+ *                              as the focus of the difference.
+ *  @param[in,out]  inOutBase   A pointer to a mutable dictionary
+ *                              reference serving as the base of the
+ *                              difference. The reference itself is
+ *                              optional and may be null. If the
+ *                              reference is null, a mutable
+ *                              dictionary will be allocated on the
+ *                              caller's behalf that becomes their
+ *                              responsiblity to release on success.
+ *  @param[out]     outAdded    An optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the proposed dictionary. If null,
+ *                              no such entries will be enumerated and
+ *                              populated.
+ *  @param[out]     outCommon   An optional reference to the mutable
+ *                              dictionary containing entries common
+ *                              to both the base and current
+ *                              dictionary but that may be changed
+ *                              between them in terms of values. If
+ *                              null, no such entries will be
+ *                              enumerated and populated.
+ *  @param[out]     outRemoved  A optional reference to the mutable
+ *                              dictionary containing entries unique
+ *                              to the base dictionary. If null, no
+ *                              such entries will be enumerated and
+ *                              populated.
+ *
+ *  @returns
+ *    True if the difference was successful; otherwise, false. False
+ *    may be returned if an incorrect argument was supplied or if
+ *    memory allocation was unsuccessful.
+ *
+ *  @ingroup dictionary
+ *
+ */
+Boolean
+CFUDictionaryDifferenceWithAllocator(CFAllocatorRef inAllocator,
+                                     CFDictionaryRef inProposed,
+                                     CFMutableDictionaryRef *inOutBase,
+                                     CFMutableDictionaryRef outAdded,
+                                     CFMutableDictionaryRef outCommon,
+                                     CFMutableDictionaryRef outRemoved)
+{
+    Boolean status = true;
+
+    __Require_Action(inOutBase != nullptr, done, status = false);
+
+    status = CFUDictionaryDifference(inAllocator,
+                                     inProposed,
+                                     *inOutBase,
+                                     outAdded,
+                                     outCommon,
+                                     outRemoved);
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Create a copy-on-write working copy of a dictionary.
+ *
+ *  This routine creates a working copy of the specified dictionary
+ *  that shares, rather than duplicates, the dictionary and all of
+ *  its descendants. Containers are cloned, shallowly, only along the
+ *  key paths subsequently requested with
+ *  CFUDictionaryCopyOnWriteGetMutableDictionary. Everything else,
+ *  including every leaf string, number, date and data object,
+ *  remains shared with the original.
+ *
+ *  Creating the working copy is therefore constant time regardless
+ *  of the size of the dictionary, and each mutated path costs only
+ *  the shallow copies of the containers along it.
+ *
+ *  @param[in]  inDictionary  A reference to the dictionary to copy.
+ *                            The dictionary and its descendants
+ *                            must not be mutated while shared by the
+ *                            working copy.
+ *
+ *  @returns
+ *    A reference to the working copy on success, which must be
+ *    released with CFUDictionaryCopyOnWriteDestroy; otherwise, null
+ *    on error.
+ *
+ *  @ingroup dictionary
+ *
+ */
+CFUDictionaryCopyOnWriteRef
+CFUDictionaryCopyOnWriteCreate(CFDictionaryRef inDictionary)
+{
+    return (CFUDictionaryCopyOnWriteCreateWithAllocator(kCFAllocatorDefault, inDictionary));
+}
+
+/**
+ *  @brief
+ *    Create a copy-on-write working copy of a dictionary with an
+ *    allocator.
+ *
+ *  This routine creates a working copy of the specified dictionary
+ *  that shares, rather than duplicates, the dictionary and all of
+ *  its descendants. Containers are cloned, shallowly, only along the
+ *  key paths subsequently requested with
+ *  CFUDictionaryCopyOnWriteGetMutableDictionary. Everything else,
+ *  including every leaf string, number, date and data object,
+ *  remains shared with the original.
+ *
+ *  The clones are created with the specified allocator, such that a
+ *  request-scoped working copy may, for example, use an arena
+ *  allocator created with #CFUAllocatorArenaCreate.
+ *
+ *  Creating the working copy is therefore constant time regardless
+ *  of the size of the dictionary, and each mutated path costs only
+ *  the shallow copies of the containers along it.
+ *
+ *  @param[in]  inAllocator   The allocator with which to create the
+ *                            clones and the working copy's
+ *                            bookkeeping.
+ *  @param[in]  inDictionary  A reference to the dictionary to copy.
+ *                            The dictionary and its descendants
+ *                            must not be mutated while shared by the
+ *                            working copy.
+ *
+ *  @returns
+ *    A reference to the working copy on success, which must be
+ *    released with CFUDictionaryCopyOnWriteDestroy; otherwise, null
+ *    on error.
+ *
+ *  @ingroup dictionary
+ *
+ */
+CFUDictionaryCopyOnWriteRef
+CFUDictionaryCopyOnWriteCreateWithAllocator(CFAllocatorRef  inAllocator,
+                                            CFDictionaryRef inDictionary)
+{
+    CFSetCallBacks              theCallBacks = kCFTypeSetCallBacks;
+    CFUDictionaryCopyOnWriteRef theCopy      = nullptr;
+    bool                        status       = false;
+
+    __Require(inDictionary != nullptr, done);
+
+    theCopy = new (std::nothrow) __CFUDictionaryCopyOnWrite();
+    __Require(theCopy != nullptr, done);
+
+    theCopy->mRoot      = static_cast<CFDictionaryRef>(CFRetain(inDictionary));
+    theCopy->mAllocator = ((inAllocator == nullptr) ?
+                           nullptr :
+                           static_cast<CFAllocatorRef>(CFRetain(inAllocator)));
+
+    // Ownership is a question of identity, not equality: an equal
+    // but shared dictionary must never be mistaken for a clone.
+    // Retaining the clones guarantees that their addresses cannot be
+    // reused by other objects while they are tracked.
+
+    theCallBacks.equal = nullptr;
+    theCallBacks.hash  = nullptr;
+
+    theCopy->mOwned = CFSetCreateMutable(theCopy->mAllocator, 0, &theCallBacks);
+    __Require(theCopy->mOwned != nullptr, done);
+
+    status = true;
+
+ done:
+    if (!status)
+    {
+        CFUDictionaryCopyOnWriteDestroy(theCopy);
+
+        theCopy = nullptr;
+    }
+
+    return (theCopy);
+}
+
+/**
+ *  @brief
+ *    Destroy a copy-on-write working copy of a dictionary.
+ *
+ *  @param[in]  inCopy  A reference to the working copy to destroy.
+ *                      Null is permitted and ignored.
+ *
+ *  @ingroup dictionary
+ *
+ */
+void
+CFUDictionaryCopyOnWriteDestroy(CFUDictionaryCopyOnWriteRef inCopy)
+{
+    __Require_Quiet(inCopy != nullptr, done);
+
+    CFURelease(inCopy->mOwned);
+    CFURelease(inCopy->mRoot);
+    CFURelease(inCopy->mAllocator);
+
+    delete inCopy;
+
+ done:
+    return;
+}
+
+/**
+ *  @brief
+ *    Get a mutable dictionary at a key path of a copy-on-write
+ *    working copy.
+ *
+ *  This routine returns the mutable dictionary at the specified key
+ *  path of the working copy, first cloning, shallowly, each
+ *  dictionary along the path that is still shared with the original
+ *  or with a prior snapshot. Missing dictionaries along the path are
+ *  created empty.
+ *
+ *  The returned dictionary may be mutated freely, for example with
+ *  #CFUDictionaryMerge, until the next snapshot is taken with
+ *  CFUDictionaryCopyOnWriteCopyDictionary. Nested dictionaries
+ *  reached through it, however, are still shared and must themselves
+ *  be obtained with this routine before being mutated.
+ *
+ *  @param[in]  inCopy     A reference to the working copy.
+ *  @param[in]  inKeyPath  An optional reference to an array of the
+ *                         successive keys of the key path. If null or
+ *                         empty, the top-level dictionary is
+ *                         returned.
+ *
+ *  @returns
+ *    A reference to the mutable dictionary on success, which the
+ *    caller does not own; otherwise, null if a value along the key
+ *    path is not a dictionary or on error.
+ *
+ *  @ingroup dictionary
+ *
+ */
+CFMutableDictionaryRef
+CFUDictionaryCopyOnWriteGetMutableDictionary(CFUDictionaryCopyOnWriteRef inCopy,
+                                             CFArrayRef                  inKeyPath)
+{
+    const CFIndex          theCount      = ((inKeyPath == nullptr) ? 0 : CFArrayGetCount(inKeyPath));
+    CFMutableDictionaryRef theDictionary = nullptr;
+    CFMutableDictionaryRef theClone;
+
+    __Require(inCopy != nullptr, done);
+
+    if (!CFSetContainsValue(inCopy->mOwned, inCopy->mRoot))
+    {
+        theClone = CFDictionaryCreateMutableCopy(inCopy->mAllocator, 0, inCopy->mRoot);
+        __Require(theClone != nullptr, done);
+
+        CFSetAddValue(inCopy->mOwned, theClone);
+
+        CFRelease(inCopy->mRoot);
+
+        inCopy->mRoot = theClone;
+    }
+
+    theDictionary = const_cast<CFMutableDictionaryRef>(inCopy->mRoot);
+
+    for (CFIndex i = 0; i < theCount; i++)
+    {
+        const void *    theKey   = CFArrayGetValueAtIndex(inKeyPath, i);
+        CFDictionaryRef theChild = static_cast<CFDictionaryRef>(CFDictionaryGetValue(theDictionary, theKey));
+
+        if (theChild == nullptr)
+        {
+            theClone = CFDictionaryCreateMutable(inCopy->mAllocator,
+                                                 0,
+                                                 &kCFTypeDictionaryKeyCallBacks,
+                                                 &kCFTypeDictionaryValueCallBacks);
+        }
+        else if (CFSetContainsValue(inCopy->mOwned, theChild))
+        {
+            theDictionary = const_cast<CFMutableDictionaryRef>(theChild);
+            continue;
+        }
+        else
+        {
+            __Require_Action(CFUIsTypeID(theChild, CFDictionaryGetTypeID()),
+                             done,
+                             theDictionary = nullptr);
+
+            theClone = CFDictionaryCreateMutableCopy(inCopy->mAllocator, 0, theChild);
+        }
+
+        __Require_Action(theClone != nullptr, done, theDictionary = nullptr);
+
+        CFSetAddValue(inCopy->mOwned, theClone);
+        CFDictionarySetValue(theDictionary, theKey, theClone);
+        CFRelease(theClone);
+
+        theDictionary = theClone;
+    }
+
+ done:
+    return (theDictionary);
+}
+
+/**
+ *  @brief
+ *    Snapshot a copy-on-write working copy of a dictionary.
+ *
+ *  This routine returns the current contents of the working copy as
+ *  a dictionary that will not change with subsequent mutations of
+ *  the working copy. Any later mutation clones the dictionaries
+ *  along its key path anew, sharing everything else with the
+ *  snapshot.
+ *
+ *  @param[in]  inCopy  A reference to the working copy.
+ *
+ *  @returns
+ *    A reference to the snapshot dictionary on success, which the
+ *    caller owns and is responsible for releasing; otherwise, null on
+ *    error.
+ *
+ *  @ingroup dictionary
+ *
+ */
+CFDictionaryRef
+CFUDictionaryCopyOnWriteCopyDictionary(CFUDictionaryCopyOnWriteRef inCopy)
+{
+    CFDictionaryRef theDictionary = nullptr;
+
+    __Require(inCopy != nullptr, done);
+
+    theDictionary = static_cast<CFDictionaryRef>(CFRetain(inCopy->mRoot));
+
+    // Relinquish ownership of every clone, which now belongs to the
+    // snapshot as much as to the working copy.
+
+    CFSetRemoveAllValues(inCopy->mOwned);
+
+ done:
+    return (theDictionary);
+}
+
+/**
+ *  This routines returns the appropriate CoreFoundation number type
+ *  for the specified parameters.
+ *
+ *  @note
+ *    Clients are discouraged from calling this interface directly and
+ *    should, instead, use the template function version.
+ *
+ *  @param[in]  inIntegral  A Boolean indicating whether the type is
+ *                          integral (true) or floating point
+ *                          (false).
+ *  @param[in]  inBytes     The size, in bytes, of the number representation.
+ *
+ *  @returns
+ *    The corresponding CoreFoundation number type if a successful
+ *    mapping was found; otherwise, false.
+ *
+ *  @ingroup number
+ *
+ */
+CFNumberType
+CFUGetNumberType(bool inIntegral, size_t inBytes)
+{
+    CFNumberType theType = static_cast<CFNumberType>(false);
+
+    if (inIntegral) {
+        if (inBytes == 1) {
+            theType = kCFNumberSInt8Type;
+
+        } else if (inBytes == 2) {
+            theType = kCFNumberSInt16Type;
+
+        } else if (inBytes == 4) {
+            theType = kCFNumberSInt32Type;
+
+        } else if (inBytes == 8) {
+            theType = kCFNumberSInt64Type;
+        }
+
+    } else {
+        if (inBytes == 4) {
+            theType = kCFNumberFloat32Type;
+
+        } else if (inBytes == 8) {
+            theType = kCFNumberFloat64Type;
+        }
+    }
+
+    return (theType);
+}
+
+/**
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data on the specified open stream.
+ *
+ *  @param[in]      inAllocator   The allocator to use to allocate
+ *                                memory for the property list.
+ *  @param[in]      inStream      A CoreFoundation read stream
+ *                                reference to the open stream to read
+ *                                the property list data from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @private
+ *
+ */
+static Boolean
+CFUPropertyListCreateWithStream(CFAllocatorRef      inAllocator,
+                                CFReadStreamRef     inStream,
+                                CFOptionFlags       inMutability,
+                                CFPropertyListRef * outPlist,
+                                CFStringRef *       outError)
+{
+    Boolean              status = false;
+    CFPropertyListFormat theFormat;
+
+#if HAVE_CFPROPERTYLISTCREATEWITHSTREAM
+    {
+        CFErrorRef theError = nullptr;
+
+        *outPlist = CFPropertyListCreateWithStream(inAllocator,
+                                                   inStream,
+                                                   0,
+                                                   inMutability,
+                                                   &theFormat,
+                                                   &theError);
+
+        if (theError != nullptr) {
+            if (outError != nullptr) {
+                *outError = CFErrorCopyDescription(theError);
+            }
+
+            CFRelease(theError);
+        }
+
+        __Require(*outPlist != nullptr, done);
+    }
+#elif HAVE_CFPROPERTYLISTCREATEFROMSTREAM
+    *outPlist = CFPropertyListCreateFromStream(inAllocator,
+                                               inStream,
+                                               0,
+                                               inMutability,
+                                               &theFormat,
+                                               outError);
+    __Require(*outPlist != nullptr, done);
+#else // !HAVE_CFPROPERTYLISTCREATEWITHSTREAM || !HAVE_CFPROPERTYLISTCREATEFROMSTREAM
+#error "One of 'CFPropertyListCreateWithStream' or 'CFPropertyListCreateFromStream' must be available."
+#endif // HAVE_CFPROPERTYLISTCREATEWITHSTREAM
+
+    status = true;
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine accounts for a single property list object
+ *  encountered while scanning raw property list data against the
+ *  read limits.
+ *
+ *  @param[in,out]  inOutContext  A reference to the scan context.
+ *
+ *  @returns
+ *    True if the object is within the limits; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListLimitsAddObject(CFUPropertyListLimitsContext & inOutContext)
+{
+    const CFIndex theLimit = inOutContext.mOptions->mMaximumObjects;
+
+    inOutContext.mObjects++;
+
+    if ((theLimit > 0) && (inOutContext.mObjects > static_cast<uint64_t>(theLimit)))
+    {
+        inOutContext.mViolation = "object count";
+    }
+
+    return (inOutContext.mViolation == nullptr);
+}
+
+/**
+ *  This routine accounts for a single string or data payload
+ *  encountered while scanning raw property list data against the
+ *  read limits.
+ *
+ *  @param[in]      inLength      The decoded length, in bytes, of the
+ *                                payload.
+ *  @param[in,out]  inOutContext  A reference to the scan context.
+ *
+ *  @returns
+ *    True if the payload is within the limits; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListLimitsAddPayload(uint64_t                       inLength,
+                                CFUPropertyListLimitsContext & inOutContext)
+{
+    const CFIndex theLengthLimit = inOutContext.mOptions->mMaximumLength;
+    const CFIndex theBytesLimit  = inOutContext.mOptions->mMaximumBytes;
+
+    inOutContext.mBytes += inLength;
+
+    if ((theLengthLimit > 0) && (inLength > static_cast<uint64_t>(theLengthLimit)))
+    {
+        inOutContext.mViolation = "string or data length";
+    }
+    else if ((theBytesLimit > 0) && (inOutContext.mBytes > static_cast<uint64_t>(theBytesLimit)))
+    {
+        inOutContext.mViolation = "total decoded bytes";
+    }
+
+    return (inOutContext.mViolation == nullptr);
+}
+
+/**
+ *  This routine accounts for a container property list object at the
+ *  specified nesting depth encountered while scanning raw property
+ *  list data against the read limits.
+ *
+ *  @param[in]      inDepth       The nesting depth of the container,
+ *                                where a top-level container is at
+ *                                depth one (1).
+ *  @param[in,out]  inOutContext  A reference to the scan context.
+ *
+ *  @returns
+ *    True if the depth is within the limits; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListLimitsCheckDepth(size_t                         inDepth,
+                                CFUPropertyListLimitsContext & inOutContext)
+{
+    const CFIndex theLimit = inOutContext.mOptions->mMaximumDepth;
+
+    if ((theLimit > 0) && (inDepth > static_cast<size_t>(theLimit)))
+    {
+        inOutContext.mViolation = "depth";
+    }
+
+    return (inOutContext.mViolation == nullptr);
+}
+
+/**
+ *  This routine determines whether the specified XML tag name
+ *  matches the specified literal.
+ *
+ *  @param[in]  inName    A pointer to the start of the tag name.
+ *  @param[in]  inLength  The length, in bytes, of the tag name.
+ *  @param[in]  inString  A pointer to the null-terminated literal to
+ *                        match.
+ *
+ *  @returns
+ *    True if the name matches; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListXMLTagIs(const UInt8 * inName, size_t inLength, const char * inString)
+{
+    return ((strlen(inString) == inLength) && (memcmp(inName, inString, inLength) == 0));
+}
+
+/**
+ *  This routine scans raw XML property list data against the read
+ *  limits, without materializing any objects.
+ *
+ *  String and data lengths are computed conservatively: character
+ *  entities are counted at their encoded length and Base64 data at
+ *  three-quarters of its non-whitespace encoded length.
+ *
+ *  @param[in]      inBytes       A pointer to the raw property list
+ *                                data.
+ *  @param[in]      inSize        The size, in bytes, of the raw
+ *                                property list data.
+ *  @param[in,out]  inOutContext  A reference to the scan context. On
+ *                                a limit violation, the violation is
+ *                                set in the context.
+ *
+ *  @returns
+ *    True if the data is within the limits; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListScanXML(const UInt8 *                  inBytes,
+                       size_t                         inSize,
+                       CFUPropertyListLimitsContext & inOutContext)
+{
+    enum { kPayloadNone, kPayloadString, kPayloadData } thePayload = kPayloadNone;
+    uint64_t theLength = 0;
+    size_t   theDepth  = 0;
+    size_t   theIndex  = 0;
+    bool     status    = true;
+
+    while (status && (theIndex < inSize))
+    {
+        const UInt8 * theMarkup    = &inBytes[theIndex];
+        const size_t  theRemaining = inSize - theIndex;
+        const char *  theTerminator;
+        const UInt8 * theEnd;
+
+        if (*theMarkup != '<')
+        {
+            if ((thePayload == kPayloadString) ||
+                ((thePayload == kPayloadData) && !isspace(*theMarkup)))
+            {
+                theLength++;
+            }
+
+            theIndex++;
+            continue;
+        }
+
+        // Determine the terminator for this kind of markup.
+
+        if ((theRemaining >= 4) && (memcmp(theMarkup, "<!--", 4) == 0))
+        {
+            theTerminator = "-->";
+        }
+        else if ((theRemaining >= 9) && (memcmp(theMarkup, "<![CDATA[", 9) == 0))
+        {
+            theTerminator = "]]>";
+        }
+        else if ((theRemaining >= 2) && (theMarkup[1] == '?'))
+        {
+            theTerminator = "?>";
+        }
+        else
+        {
+            theTerminator = ">";
+        }
+
+        theEnd = static_cast<const UInt8 *>(memmem(theMarkup,
+                                                   theRemaining,
+                                                   theTerminator,
+                                                   strlen(theTerminator)));
+
+        // Unterminated markup is malformed; leave it to the parser
+        // to reject.
+
+        if (theEnd == nullptr)
+        {
+            break;
+        }
+
+        if (theTerminator[0] == ']')
+        {
+            if (thePayload != kPayloadNone)
+            {
+                theLength += static_cast<uint64_t>(theEnd - theMarkup) - 9;
+            }
+        }
+        else if ((theTerminator[0] == '>') && (theMarkup[1] != '!'))
+        {
+            const bool    theClosing     = (theMarkup[1] == '/');
+            const bool    theSelfClosing = (theEnd[-1] == '/');
+            const UInt8 * theName        = &theMarkup[theClosing ? 2 : 1];
+            size_t        theNameLength  = 0;
+
+            while ((&theName[theNameLength] < theEnd)   &&
+                   !isspace(theName[theNameLength])     &&
+                   (theName[theNameLength] != '/'))
+            {
+                theNameLength++;
+            }
+
+            const bool theContainer = (CFUPropertyListXMLTagIs(theName, theNameLength, "dict") ||
+                                       CFUPropertyListXMLTagIs(theName, theNameLength, "array"));
+            const bool theString    = (CFUPropertyListXMLTagIs(theName, theNameLength, "string") ||
+                                       CFUPropertyListXMLTagIs(theName, theNameLength, "key"));
+            const bool theData      = CFUPropertyListXMLTagIs(theName, theNameLength, "data");
+            const bool theScalar    = (CFUPropertyListXMLTagIs(theName, theNameLength, "date")    ||
+                                       CFUPropertyListXMLTagIs(theName, theNameLength, "integer") ||
+                                       CFUPropertyListXMLTagIs(theName, theNameLength, "real")    ||
+                                       CFUPropertyListXMLTagIs(theName, theNameLength, "true")    ||
+                                       CFUPropertyListXMLTagIs(theName, theNameLength, "false"));
+
+            if (theClosing)
+            {
+                if (theContainer && (theDepth > 0))
+                {
+                    theDepth--;
+                }
+                else if ((theString || theData) && (thePayload != kPayloadNone))
+                {
+                    if (thePayload == kPayloadData)
+                    {
+                        theLength = (theLength / 4) * 3;
+                    }
+
+                    status     = CFUPropertyListLimitsAddPayload(theLength, inOutContext);
+                    thePayload = kPayloadNone;
+                }
+            }
+            else if (theContainer || theString || theData || theScalar)
+            {
+                status = CFUPropertyListLimitsAddObject(inOutContext);
+
+                if (status && theContainer)
+                {
+                    status = CFUPropertyListLimitsCheckDepth(theDepth + 1, inOutContext);
+
+                    if (!theSelfClosing)
+                    {
+                        theDepth++;
+                    }
+                }
+                else if (status && (theString || theData) && !theSelfClosing)
+                {
+                    thePayload = (theData ? kPayloadData : kPayloadString);
+                    theLength  = 0;
+                }
+            }
+        }
+
+        theIndex = static_cast<size_t>(theEnd - inBytes) + strlen(theTerminator);
+    }
+
+    return (status);
+}
+
+/**
+ *  This routine reads a big-endian unsigned integer of the specified
+ *  width from raw binary property list data.
+ *
+ *  @param[in]   inBytes   A pointer to the raw property list data.
+ *  @param[in]   inSize    The size, in bytes, of the raw property
+ *                         list data.
+ *  @param[in]   inOffset  The offset, in bytes, of the integer.
+ *  @param[in]   inWidth   The width, in bytes, of the integer.
+ *  @param[out]  outValue  A reference to storage for the integer.
+ *
+ *  @returns
+ *    True if the integer lies within the data; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListBinaryReadInteger(const UInt8 * inBytes,
+                                 size_t        inSize,
+                                 uint64_t      inOffset,
+                                 size_t        inWidth,
+                                 uint64_t &    outValue)
+{
+    bool status = false;
+
+    __Require_Quiet((inWidth > 0) && (inWidth <= sizeof (uint64_t)), done);
+    __Require_Quiet(inOffset <= inSize, done);
+    __Require_Quiet(inWidth <= (inSize - inOffset), done);
+
+    outValue = 0;
+
+    for (size_t i = 0; i < inWidth; i++)
+    {
+        outValue = (outValue << 8) | inBytes[inOffset + i];
+    }
+
+    status = true;
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine returns the length encoded in the marker of the
+ *  binary property list object at the specified offset, whether
+ *  inline in the marker or in a trailing integer object.
+ *
+ *  @param[in]   inBytes    A pointer to the raw property list data.
+ *  @param[in]   inSize     The size, in bytes, of the raw property
+ *                          list data.
+ *  @param[in]   inOffset   The offset, in bytes, of the object.
+ *  @param[out]  outFirst   A reference to storage for the offset of
+ *                          the first byte following the length.
+ *  @param[out]  outLength  A reference to storage for the length.
+ *
+ *  @returns
+ *    True if the length is well-formed; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListBinaryGetLength(const UInt8 * inBytes,
+                               size_t        inSize,
+                               uint64_t      inOffset,
+                               uint64_t &    outFirst,
+                               uint64_t &    outLength)
+{
+    bool status = true;
+
+    outLength = (inBytes[inOffset] & 0x0F);
+    outFirst  = inOffset + 1;
+
+    if (outLength == 0x0F)
+    {
+        size_t theWidth;
+
+        __Require_Action_Quiet(outFirst < inSize, done, status = false);
+        __Require_Action_Quiet((inBytes[outFirst] >> 4) == 0x1, done, status = false);
+
+        theWidth = static_cast<size_t>(1) << (inBytes[outFirst] & 0x0F);
+
+        status = CFUPropertyListBinaryReadInteger(inBytes,
+                                                  inSize,
+                                                  outFirst + 1,
+                                                  theWidth,
+                                                  outLength);
+        __Require_Quiet(status, done);
+
+        outFirst += 1 + theWidth;
+    }
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine determines whether the binary property list object
+ *  at the specified offset is a container and, if so, returns the
+ *  location and count of its object references.
+ *
+ *  @param[in]   inBytes          A pointer to the raw property list
+ *                                data.
+ *  @param[in]   inSize           The size, in bytes, of the raw
+ *                                property list data.
+ *  @param[in]   inOffset         The offset, in bytes, of the object.
+ *  @param[in]   inReferenceSize  The size, in bytes, of an object
+ *                                reference.
+ *  @param[out]  outFirst         A reference to storage for the
+ *                                offset of the first object reference.
+ *  @param[out]  outCount         A reference to storage for the count
+ *                                of object references.
+ *
+ *  @returns
+ *    True if the object is a well-formed container; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListBinaryGetContainer(const UInt8 * inBytes,
+                                  size_t        inSize,
+                                  uint64_t      inOffset,
+                                  size_t        inReferenceSize,
+                                  uint64_t &    outFirst,
+                                  uint64_t &    outCount)
+{
+    const UInt8 theType = static_cast<UInt8>(inBytes[inOffset] >> 4);
+    bool        status  = false;
+
+    __Require_Quiet((theType == 0xA) || (theType == 0xC) || (theType == 0xD), done);
+
+    status = CFUPropertyListBinaryGetLength(inBytes, inSize, inOffset, outFirst, outCount);
+    __Require_Quiet(status, done);
+
+    // Dictionaries carry both key and value references.
+
+    if (theType == 0xD)
+    {
+        outCount *= 2;
+    }
+
+    status = (outCount <= (inSize - outFirst) / inReferenceSize);
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine scans raw binary property list data against the read
+ *  limits, without materializing any objects.
+ *
+ *  The object count is checked directly against the trailer before
+ *  any objects are visited. Structurally malformed data is left to
+ *  the parser to reject.
+ *
+ *  @param[in]      inBytes       A pointer to the raw property list
+ *                                data.
+ *  @param[in]      inSize        The size, in bytes, of the raw
+ *                                property list data.
+ *  @param[in,out]  inOutContext  A reference to the scan context. On
+ *                                a limit violation, the violation is
+ *                                set in the context.
+ *
+ *  @returns
+ *    True if the data is within the limits; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListScanBinary(const UInt8 *                  inBytes,
+                          size_t                         inSize,
+                          CFUPropertyListLimitsContext & inOutContext)
+{
+    static const size_t                 kHeaderSize  = 8;
+    static const size_t                 kTrailerSize = 32;
+    static const int64_t                kUnvisited   = -1;
+    static const int64_t                kVisiting    = -2;
+    const UInt8 *                       theTrailer;
+    size_t                              theOffsetSize;
+    size_t                              theReferenceSize;
+    uint64_t                            theCount;
+    uint64_t                            theTop;
+    uint64_t                            theTable;
+    vector<uint64_t>                    theOffsets;
+    vector<int64_t>                     theHeights;
+    vector<CFUPropertyListBinaryFrame>  theStack;
+    CFUPropertyListBinaryFrame          theFrame;
+    bool                                status = true;
+
+    __Require_Quiet(inSize >= kHeaderSize + kTrailerSize, done);
+
+    theTrailer       = &inBytes[inSize - kTrailerSize];
+    theOffsetSize    = theTrailer[6];
+    theReferenceSize = theTrailer[7];
+
+    CFUPropertyListBinaryReadInteger(theTrailer, kTrailerSize,  8, 8, theCount);
+    CFUPropertyListBinaryReadInteger(theTrailer, kTrailerSize, 16, 8, theTop);
+    CFUPropertyListBinaryReadInteger(theTrailer, kTrailerSize, 24, 8, theTable);
+
+    // Binary property lists are uniqued and carry their object count
+    // in the trailer, so the object limit is enforced without
+    // visiting a single object.
+
+    inOutContext.mObjects = theCount;
+
+    if ((inOutContext.mOptions->mMaximumObjects > 0) &&
+        (theCount > static_cast<uint64_t>(inOutContext.mOptions->mMaximumObjects)))
+    {
+        inOutContext.mViolation = "object count";
+    }
+
+    __Require_Action_Quiet(inOutContext.mViolation == nullptr, done, status = false);
+
+    // Any further malformation is left to the parser.
+
+    __Require_Quiet((theCount > 0) && (theTop < theCount), done);
+    __Require_Quiet((theOffsetSize > 0) && (theOffsetSize <= 8), done);
+    __Require_Quiet((theReferenceSize > 0) && (theReferenceSize <= 8), done);
+    __Require_Quiet(theTable < inSize, done);
+    __Require_Quiet(theCount <= (inSize - theTable) / theOffsetSize, done);
+
+    theOffsets.resize(static_cast<size_t>(theCount));
+    theHeights.assign(static_cast<size_t>(theCount), kUnvisited);
+
+    // Visit every object once, accounting for string and data
+    // payload lengths.
+
+    for (size_t i = 0; status && (i < theOffsets.size()); i++)
+    {
+        uint64_t theOffset;
+        uint64_t theFirst;
+        uint64_t theLength;
+        UInt8    theType;
+
+        CFUPropertyListBinaryReadInteger(inBytes,
+                                         inSize,
+                                         theTable + (i * theOffsetSize),
+                                         theOffsetSize,
+                                         theOffset);
+        __Require_Quiet((theOffset >= kHeaderSize) && (theOffset < inSize - kTrailerSize), done);
+
+        theOffsets[i] = theOffset;
+
+        theType = static_cast<UInt8>(inBytes[theOffset] >> 4);
+
+        if ((theType == 0x4) || (theType == 0x5) || (theType == 0x6) || (theType == 0x7))
+        {
+            __Require_Quiet(CFUPropertyListBinaryGetLength(inBytes,
+                                                           inSize,
+                                                           theOffset,
+                                                           theFirst,
+                                                           theLength),
+                            done);
+
+            // UTF-16 strings are counted in code units.
+
+            if (theType == 0x6)
+            {
+                theLength *= 2;
+            }
+
+            status = CFUPropertyListLimitsAddPayload(theLength, inOutContext);
+        }
+    }
+
+    __Require_Quiet(status, done);
+    __Require_Quiet(inOutContext.mOptions->mMaximumDepth > 0, done);
+
+    // Determine the nesting depth with an iterative, memoized
+    // depth-first traversal from the top object such that neither
+    // hostile nesting nor shared references can blow the stack or the
+    // run time. Each container's height (the number of container
+    // levels at and beneath it) is computed once. A reference cycle
+    // is left to the parser to reject.
+
+    theFrame.mObject = theTop;
+    theFrame.mNext   = 0;
+    theFrame.mHeight = 0;
+
+    if (!CFUPropertyListBinaryGetContainer(inBytes,
+                                           inSize,
+                                           theOffsets[static_cast<size_t>(theTop)],
+                                           theReferenceSize,
+                                           theFrame.mFirst,
+                                           theFrame.mCount))
+    {
+        goto done;
+    }
+
+    theHeights[static_cast<size_t>(theTop)] = kVisiting;
+    theStack.push_back(theFrame);
+
+    status = CFUPropertyListLimitsCheckDepth(theStack.size(), inOutContext);
+
+    while (status && !theStack.empty())
+    {
+        CFUPropertyListBinaryFrame & theCurrent = theStack.back();
+
+        if (theCurrent.mNext < theCurrent.mCount)
+        {
+            uint64_t theChild;
+            int64_t  theHeight;
+
+            CFUPropertyListBinaryReadInteger(inBytes,
+                                             inSize,
+                                             theCurrent.mFirst + (theCurrent.mNext * theReferenceSize),
+                                             theReferenceSize,
+                                             theChild);
+            __Require_Quiet(theChild < theCount, done);
+
+            theCurrent.mNext++;
+
+            theHeight = theHeights[static_cast<size_t>(theChild)];
+
+            __Require_Quiet(theHeight != kVisiting, done);
+
+            if (theHeight != kUnvisited)
+            {
+                theCurrent.mHeight = max(theCurrent.mHeight, theHeight);
+            }
+            else if (CFUPropertyListBinaryGetContainer(inBytes,
+                                                       inSize,
+                                                       theOffsets[static_cast<size_t>(theChild)],
+                                                       theReferenceSize,
+                                                       theFrame.mFirst,
+                                                       theFrame.mCount))
+            {
+                theFrame.mObject = theChild;
+                theFrame.mNext   = 0;
+                theFrame.mHeight = 0;
+
+                theHeights[static_cast<size_t>(theChild)] = kVisiting;
+                theStack.push_back(theFrame);
+
+                status = CFUPropertyListLimitsCheckDepth(theStack.size(), inOutContext);
+            }
+            else
+            {
+                theHeights[static_cast<size_t>(theChild)] = 0;
+            }
+        }
+        else
+        {
+            const int64_t theHeight = theCurrent.mHeight + 1;
+
+            theHeights[static_cast<size_t>(theCurrent.mObject)] = theHeight;
+            theStack.pop_back();
+
+            if (!theStack.empty())
+            {
+                theStack.back().mHeight = max(theStack.back().mHeight, theHeight);
+            }
+
+            status = CFUPropertyListLimitsCheckDepth(theStack.size() + static_cast<size_t>(theHeight),
+                                                     inOutContext);
+        }
+    }
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine returns the number of raw property list bytes a
+ *  reader should accept before it stops reading, given the specified
+ *  read limits.
+ *
+ *  @param[in]  inOptions  An optional pointer to the read limits to
+ *                         enforce.
+ *
+ *  @returns
+ *    One (1) more than the raw input limit, such that reading
+ *    exactly that many bytes indicates the limit was exceeded, or
+ *    SIZE_MAX if raw input is unlimited.
+ *
+ *  @private
+ *
+ */
+static size_t
+CFUPropertyListLimitsGetInputCapacity(const CFUPropertyListReadOptions * inOptions)
+{
+    size_t theCapacity = SIZE_MAX;
+
+    if ((inOptions != nullptr) && (inOptions->mMaximumInputBytes > 0))
+    {
+        theCapacity = static_cast<size_t>(inOptions->mMaximumInputBytes) + 1;
+    }
+
+    return (theCapacity);
+}
+
+/**
+ *  This routine checks the number of raw property list bytes read
+ *  against the raw input limit, if any, of the specified read
+ *  limits.
+ *
+ *  @param[in]      inSize     The number of raw bytes read.
+ *  @param[in]      inOptions  An optional pointer to the read limits
+ *                             to enforce.
+ *  @param[in,out]  outError   An optional pointer to storage for a
+ *                             returned string indicating the limit
+ *                             violation. On failure, this is a
+ *                             reference to the error. The caller
+ *                             owns the reference and is responsible
+ *                             for releasing the object.
+ *
+ *  @returns
+ *    True if the raw input is within the limit; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListLimitsCheckInput(size_t                             inSize,
+                                const CFUPropertyListReadOptions * inOptions,
+                                CFStringRef *                      outError)
+{
+    const bool status = (inSize < CFUPropertyListLimitsGetInputCapacity(inOptions));
+
+    if (!status && (outError != nullptr))
+    {
+        *outError = CFStringCreateWithFormat(kCFAllocatorDefault,
+                                             nullptr,
+                                             CFSTR("Property list exceeds the read limit for %s"),
+                                             "input bytes");
+    }
+
+    return (status);
+}
+
+/**
+ *  This routine scans the specified raw property list data against
+ *  the specified read limits, if any, and, only if it is within
+ *  them, creates the property list from it.
+ *
+ *  @param[in]      inAllocator   The allocator to use to allocate
+ *                                memory for the property list.
+ *  @param[in]      inBytes       A pointer to the raw property list
+ *                                data.
+ *  @param[in]      inSize        The size, in bytes, of the raw
+ *                                property list data.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in]      inOptions     An optional pointer to the read
+ *                                limits to enforce. If null, no limits
+ *                                are enforced.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error or limit
+ *                                violation. On failure, this is a
+ *                                reference to the error. The caller
+ *                                owns the reference and is
+ *                                responsible for releasing the
+ *                                object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @private
+ *
+ */
+static Boolean
+CFUPropertyListCreateWithBytesAndOptions(CFAllocatorRef                     inAllocator,
+                                         const UInt8 *                      inBytes,
+                                         size_t                             inSize,
+                                         CFOptionFlags                      inMutability,
+                                         const CFUPropertyListReadOptions * inOptions,
+                                         CFPropertyListRef *                outPlist,
+                                         CFStringRef *                      outError)
+{
+    static const char             kBinaryMagic[] = "bplist";
+    size_t                        theStart       = 0;
+    CFUPropertyListLimitsContext  theContext     = { inOptions, 0, 0, nullptr };
+    CFReadStreamRef               theDataStream  = nullptr;
+    Boolean                       status         = false;
+
+    // Dispatch to the format-specific scanner, if there are limits
+    // to enforce.
+
+    if ((inOptions == nullptr) ||
+        ((inOptions->mMaximumDepth   == 0) &&
+         (inOptions->mMaximumObjects == 0) &&
+         (inOptions->mMaximumBytes   == 0) &&
+         (inOptions->mMaximumLength  == 0)))
+    {
+        status = true;
+    }
+    else if ((inSize >= strlen(kBinaryMagic)) &&
+             (memcmp(inBytes, kBinaryMagic, strlen(kBinaryMagic)) == 0))
+    {
+        status = CFUPropertyListScanBinary(inBytes, inSize, theContext);
+    }
+    else
+    {
+        while ((theStart < inSize) && isspace(inBytes[theStart]))
+        {
+            theStart++;
+        }
+
+        if ((theStart < inSize) && (inBytes[theStart] == '<'))
+        {
+            status = CFUPropertyListScanXML(&inBytes[theStart],
+                                            inSize - theStart,
+                                            theContext);
+        }
+        else
+        {
+            // OpenStep-format property lists cannot be cheaply
+            // scanned; reject them rather than silently bypass the
+            // limits.
+
+            theContext.mViolation = "format";
+
+            status = false;
+        }
+    }
+
+    if (!status)
+    {
+        if ((outError != nullptr) && (theContext.mViolation != nullptr))
+        {
+            *outError = CFStringCreateWithFormat(kCFAllocatorDefault,
+                                                 nullptr,
+                                                 CFSTR("Property list exceeds the read limit for %s"),
+                                                 theContext.mViolation);
+        }
+
+        goto done;
+    }
+
+    // Within the limits; parse the buffered data.
+
+    theDataStream = CFReadStreamCreateWithBytesNoCopy(kCFAllocatorDefault,
+                                                      inBytes,
+                                                      static_cast<CFIndex>(inSize),
+                                                      kCFAllocatorNull);
+    __Require_Action(theDataStream != nullptr, done, status = false);
+
+    status = CFReadStreamOpen(theDataStream);
+    __Require(status, done);
+
+    status = CFUPropertyListCreateWithStream(inAllocator,
+                                             theDataStream,
+                                             inMutability,
+                                             outPlist,
+                                             outError);
+    __Require(status, done);
+
+    // Validate the property list against the schema, if any,
+    // discarding it on the first violation.
+
+    if ((inOptions != nullptr) && (inOptions->mSchema != nullptr))
+    {
+        status = CFUPropertyListSchemaValidate(inOptions->mSchema,
+                                               *outPlist,
+                                               outError);
+
+        if (!status)
+        {
+            CFRelease(*outPlist);
+
+            *outPlist = nullptr;
+        }
+    }
+
+ done:
+    if (theDataStream != nullptr) {
+        CFReadStreamClose(theDataStream);
+    }
+
+    CFURelease(theDataStream);
+
+    return (status);
+}
+
+/**
+ *  This routine reads all of the raw property list data from the
+ *  specified open stream, scans it against the specified read
+ *  limits and, only if it is within them, creates the property list
+ *  from it.
+ *
+ *  @param[in]      inStream      A CoreFoundation read stream
+ *                                reference to the open stream to read
+ *                                the property list data from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in]      inOptions     A pointer to the read limits to
+ *                                enforce.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error or limit
+ *                                violation. On failure, this is a
+ *                                reference to the error. The caller
+ *                                owns the reference and is
+ *                                responsible for releasing the
+ *                                object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @private
+ *
+ */
+static Boolean
+CFUPropertyListCreateWithStreamAndOptions(CFReadStreamRef                    inStream,
+                                          CFOptionFlags                      inMutability,
+                                          const CFUPropertyListReadOptions * inOptions,
+                                          CFPropertyListRef *                outPlist,
+                                          CFStringRef *                      outError)
+{
+    const size_t  theCapacity = CFUPropertyListLimitsGetInputCapacity(inOptions);
+    vector<UInt8> theBuffer;
+    size_t        theSize     = 0;
+    size_t        theRequest;
+    CFIndex       theRead;
+    Boolean       status      = false;
+
+    // Read the raw data in its entirety. This is no more memory than
+    // the parser itself would otherwise buffer. Stop, however, as
+    // soon as one byte more than the raw input limit has been read
+    // rather than buffering an unbounded stream.
+
+    do {
+        theRequest = min(kCFUPropertyListDefaultBufferSize, theCapacity - theSize);
+
+        theBuffer.resize(theSize + theRequest);
+
+        theRead = CFReadStreamRead(inStream,
+                                   &theBuffer[theSize],
+                                   static_cast<CFIndex>(theRequest));
+        __Require(theRead >= 0, done);
+
+        theSize += static_cast<size_t>(theRead);
+    } while ((theRead > 0) && (theSize < theCapacity));
+
+    status = CFUPropertyListLimitsCheckInput(theSize, inOptions, outError);
+    __Require_Quiet(status, done);
+
+    status = CFUPropertyListCreateWithBytesAndOptions(kCFAllocatorDefault,
+                                                      theBuffer.data(),
+                                                      theSize,
+                                                      inMutability,
+                                                      inOptions,
+                                                      outPlist,
+                                                      outError);
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data at the specified URL.
+ *
+ *  @param[in]      inURL         A CoreFoundation URL reference to the
+ *                                URL to read the property list data
+ *                                from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromURL(CFURLRef            inURL,
+                           CFOptionFlags       inMutability,
+                           CFPropertyListRef * outPlist,
+                           CFStringRef *       outError)
+{
+    return (CFUPropertyListReadFromURLWithOptions(inURL,
+                                                  inMutability,
+                                                  nullptr,
+                                                  outPlist,
+                                                  outError));
+}
+
+/**
+ *  @brief
+ *    Read a property list from a URL, subject to read limits.
+ *
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data at the specified URL, rejecting data
+ *  that exceeds any of the specified raw input, depth, object count,
+ *  total decoded byte, or single string or data length limits.
+ *
+ *  The raw input limit is enforced while reading, which stops as
+ *  soon as the limit is exceeded. The remaining limits are enforced
+ *  by scanning the raw data before any property list objects are
+ *  created, so pathological data is rejected without a corresponding
+ *  allocation storm. Because
+ *  OpenStep-format data cannot be scanned cheaply, it is rejected
+ *  when limits are specified.
+ *
+ *  @param[in]      inURL         A CoreFoundation URL reference to the
+ *                                URL to read the property list data
+ *                                from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in]      inOptions     An optional pointer to the read
+ *                                limits to enforce. If null, no limits
+ *                                are enforced. Any limit that is zero
+ *                                (0) is not enforced.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error or limit
+ *                                violation. On failure, this is a
+ *                                reference to the error. The caller
+ *                                owns the reference and is
+ *                                responsible for releasing the
+ *                                object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromURLWithOptions(CFURLRef                           inURL,
+                                      CFOptionFlags                      inMutability,
+                                      const CFUPropertyListReadOptions * inOptions,
+                                      CFPropertyListRef *                outPlist,
+                                      CFStringRef *                      outError)
+{
+    bool                 status    = false;
+    CFReadStreamRef      theStream = nullptr;
+    CFStreamStatus       streamStatus;
+
+    __Require(inURL != nullptr, done);
+    __Require(outPlist != nullptr, done);
+
+    // Attempt to create a CoreFoundation read file stream from the
+    // resulting URL.
+
+    theStream = CFReadStreamCreateWithFile(kCFAllocatorDefault, inURL);
+    __Require(theStream != nullptr, done);
+
+    // Attempt to open the stream.
+
+    status = CFReadStreamOpen(theStream);
+    __Require(status, done);
+
+    // Check the stream status.
+
+    streamStatus = CFReadStreamGetStatus(theStream);
+    __Require_Action(streamStatus == kCFStreamStatusOpen, done, status = false);
+
+    // Check that there are bytes available for reading.
+
+    status = CFReadStreamHasBytesAvailable(theStream);
+    __Require(status, done);
+
+    if (inOptions == nullptr)
+    {
+        status = CFUPropertyListCreateWithStream(kCFAllocatorDefault,
+                                                 theStream,
+                                                 inMutability,
+                                                 outPlist,
+                                                 outError);
+    }
+    else
+    {
+        status = CFUPropertyListCreateWithStreamAndOptions(theStream,
+                                                           inMutability,
+                                                           inOptions,
+                                                           outPlist,
+                                                           outError);
+    }
+    __Require(status, done);
+
+    // At this point, all operations were successful. Set the return
+    // status accordingly.
+
+    status = true;
+
+done:
+    if (theStream != nullptr) {
+        CFReadStreamClose(theStream);
+    }
+
+    CFURelease(theStream);
+
+    return (status);
+}
+
+/**
+ *  This routine attempts to write the property list data in the
+ *  specified format to the specified open stream.
+ *
+ *  @param[in]      inStream      A CoreFoundation write stream
+ *                                reference to the open stream to
+ *                                write the property list data to.
+ *  @param[in]      inFormat      Indicates the format of the property
+ *                                list data.
+ *  @param[in]      inPlist       The property list data to write.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @private
+ *
+ */
+static Boolean
+CFUPropertyListWriteToStream(CFWriteStreamRef     inStream,
+                             CFPropertyListFormat inFormat,
+                             CFPropertyListRef    inPlist,
+                             CFStringRef *        outError)
+{
+    Boolean status = false;
+    CFIndex theIndex;
+
+#if HAVE_CFPROPERTYLISTWRITE
+    {
+        CFErrorRef theError = nullptr;
+
+        theIndex = CFPropertyListWrite(inPlist,
+                                       inStream,
+                                       inFormat,
+                                       0,
+                                       &theError);
+
+        if (theError != nullptr) {
+            if (outError != nullptr) {
+                *outError = CFErrorCopyDescription(theError);
+            }
+
+            CFRelease(theError);
+        }
+
+        __Require_Action(theIndex != 0, done, status = false);
+    }
+#elif HAVE_CFPROPERTYLISTWRITETOSTREAM
+    theIndex = CFPropertyListWriteToStream(inPlist,
+                                           inStream,
+                                           inFormat,
+                                           outError);
+    __Require_Action(theIndex != 0, done, status = false);
+#else // !HAVE_CFPROPERTYLISTWRITE || !HAVE_CFPROPERTYLISTWRITETOSTREAM
+#error "One of 'CFPropertyListWrite' or 'CFPropertyListWriteToStream' must be available."
+#endif // HAVE_CFPROPERTYLISTWRITE
+
+    status = true;
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine attempts to write the property list data to a
+ *  property list file in the specified format at the specified
+ *  path.
+ *
+ *  @param[in]      inURL         A CoreFoundation URL reference to the
+ *                                URL to write the property list data to.
+ *  @param[in]      inFormat      Indicates the format of the property list
+ *                                file.
+ *  @param[in]      inPlist       The property list data to write.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListWriteToURL(CFURLRef             inURL,
+                          CFPropertyListFormat inFormat,
+                          CFPropertyListRef    inPlist,
+                          CFStringRef *        outError)
+{
+    bool             status    = false;
+    CFWriteStreamRef theStream = nullptr;
+    CFStreamStatus   streamStatus;
+
+    __Require(inURL != nullptr, done);
+    __Require(inPlist != nullptr, done);
+
+    // Attempt to create a CoreFoundation write file stream from the
+    // specified URL.
+
+    theStream = CFWriteStreamCreateWithFile(kCFAllocatorDefault, inURL);
+    __Require(theStream != nullptr, done);
+
+    // Attempt to open the stream.
+
+    status = CFWriteStreamOpen(theStream);
+    __Require(status, done);
+
+    // Check the stream status.
+
+    streamStatus = CFWriteStreamGetStatus(theStream);
+    __Require_Action(streamStatus == kCFStreamStatusOpen, done, status = false);
+
+    status = CFUPropertyListWriteToStream(theStream,
+                                          inFormat,
+                                          inPlist,
+                                          outError);
+    __Require(status, done);
+
+done:
+    if (theStream != nullptr) {
+        CFWriteStreamClose(theStream);
+    }
+
+    CFURelease(theStream);
+
+    return (status);
+}
+
+/**
+ *  This routine writes all of the specified data to the specified
+ *  file descriptor, resuming after partial writes and interruptions.
+ *
+ *  @param[in]  inDescriptor  The file descriptor to write to.
+ *  @param[in]  inBytes       A pointer to the data to write.
+ *  @param[in]  inSize        The size, in bytes, of the data to
+ *                            write.
+ *  @param[in]  inWriteSize   The maximum size, in bytes, of each
+ *                            write. If zero (0), each write is
+ *                            offered all of the remaining data.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @private
+ *
+ */
+static Boolean
+CFUPropertyListWriteAll(int           inDescriptor,
+                        const UInt8 * inBytes,
+                        size_t        inSize,
+                        size_t        inWriteSize)
+{
+    size_t  theOffset = 0;
+    size_t  theLength;
+    ssize_t theWritten;
+    Boolean status    = true;
+
+    while (theOffset < inSize)
+    {
+        theLength = inSize - theOffset;
+
+        if ((inWriteSize > 0) && (theLength > inWriteSize))
+        {
+            theLength = inWriteSize;
+        }
+
+        theWritten = write(inDescriptor, &inBytes[theOffset], theLength);
+
+        if ((theWritten < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+
+        __Require_Action(theWritten > 0, done, status = false);
+
+        theOffset += static_cast<size_t>(theWritten);
+    }
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Read a property list from a file descriptor.
+ *
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data read from the specified file
+ *  descriptor, optionally subject to read limits. Data is read until
+ *  end-of-file, so the descriptor may be a pipe, socket, or standard
+ *  input as well as a regular file. If a raw input limit is
+ *  specified, reading stops, and the routine fails, as soon as one
+ *  byte more than the limit has been read. The descriptor is not
+ *  closed.
+ *
+ *  @param[in]      inDescriptor  The file descriptor to read the
+ *                                property list data from.
+ *  @param[in]      inBufferSize  The size, in bytes, of each read from
+ *                                the descriptor. If zero (0), a
+ *                                default size is used.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in]      inOptions     An optional pointer to the read
+ *                                limits to enforce. If null, no limits
+ *                                are enforced.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error or limit
+ *                                violation. On failure, this is a
+ *                                reference to the error. The caller
+ *                                owns the reference and is
+ *                                responsible for releasing the
+ *                                object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @sa CFUPropertyListReadFromFDWithAllocator
+ *  @sa CFUPropertyListReadFromURLWithOptions
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromFD(int                                inDescriptor,
+                          size_t                             inBufferSize,
+                          CFOptionFlags                      inMutability,
+                          const CFUPropertyListReadOptions * inOptions,
+                          CFPropertyListRef *                outPlist,
+                          CFStringRef *                      outError)
+{
+    return (CFUPropertyListReadFromFDWithAllocator(kCFAllocatorDefault,
+                                                   inDescriptor,
+                                                   inBufferSize,
+                                                   inMutability,
+                                                   inOptions,
+                                                   outPlist,
+                                                   outError));
+}
+
+/**
+ *  @brief
+ *    Read a property list from a file descriptor with an allocator.
+ *
+ *  This routine attempts to create a property list, with the
+ *  specified allocator, from the XML or binary property list data
+ *  read from the specified file descriptor, optionally subject to
+ *  read limits. Data is read until end-of-file, so the descriptor
+ *  may be a pipe, socket, or standard input as well as a regular
+ *  file. If a raw input limit is specified, reading stops, and the
+ *  routine fails, as soon as one byte more than the limit has been
+ *  read. The descriptor is not closed.
+ *
+ *  @param[in]      inAllocator   The allocator to use to allocate
+ *                                memory for the property list.
+ *  @param[in]      inDescriptor  The file descriptor to read the
+ *                                property list data from.
+ *  @param[in]      inBufferSize  The size, in bytes, of each read from
+ *                                the descriptor. If zero (0), a
+ *                                default size is used.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in]      inOptions     An optional pointer to the read
+ *                                limits to enforce. If null, no limits
+ *                                are enforced.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error or limit
+ *                                violation. On failure, this is a
+ *                                reference to the error. The caller
+ *                                owns the reference and is
+ *                                responsible for releasing the
+ *                                object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @sa CFUPropertyListReadFromURLWithOptions
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromFDWithAllocator(CFAllocatorRef                     inAllocator,
+                                       int                                inDescriptor,
+                                       size_t                             inBufferSize,
+                                       CFOptionFlags                      inMutability,
+                                       const CFUPropertyListReadOptions * inOptions,
+                                       CFPropertyListRef *                outPlist,
+                                       CFStringRef *                      outError)
+{
+    const size_t  theBufferSize = ((inBufferSize == 0) ? kCFUPropertyListDefaultBufferSize : inBufferSize);
+    const size_t  theCapacity   = CFUPropertyListLimitsGetInputCapacity(inOptions);
+    vector<UInt8> theBuffer;
+    size_t        theSize       = 0;
+    size_t        theRequest;
+    ssize_t       theRead;
+    bool          status        = false;
+
+    __Require(inDescriptor >= 0, done);
+    __Require(outPlist != nullptr, done);
+
+    // Read the raw data in its entirety, until end-of-file or until
+    // one byte more than the raw input limit has been read, leaving
+    // the remainder of an oversized input unread.
+
+    do {
+        theRequest = min(theBufferSize, theCapacity - theSize);
+
+        theBuffer.resize(theSize + theRequest);
+
+        theRead = read(inDescriptor, &theBuffer[theSize], theRequest);
+
+        if ((theRead < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+
+        __Require(theRead >= 0, done);
+
+        theSize += static_cast<size_t>(theRead);
+    } while ((theRead != 0) && (theSize < theCapacity));
+
+    __Require(theSize > 0, done);
+
+    status = CFUPropertyListLimitsCheckInput(theSize, inOptions, outError);
+    __Require_Quiet(status, done);
+
+    status = CFUPropertyListCreateWithBytesAndOptions(inAllocator,
+                                                      theBuffer.data(),
+                                                      theSize,
+                                                      inMutability,
+                                                      inOptions,
+                                                      outPlist,
+                                                      outError);
+    __Require(status, done);
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Write a property list to a file descriptor.
+ *
+ *  This routine attempts to write the property list data in the
+ *  specified format to the specified file descriptor, which may be a
+ *  pipe, socket, or memory file as well as a regular file. The
+ *  property list is serialized in memory and then written directly
+ *  from that storage, resuming after partial writes and
+ *  interruptions. The descriptor is not closed.
+ *
+ *  @param[in]      inDescriptor  The file descriptor to write the
+ *                                property list data to.
+ *  @param[in]      inBufferSize  The maximum size, in bytes, of each
+ *                                write to the descriptor. If zero
+ *                                (0), each write is offered all of
+ *                                the remaining data.
+ *  @param[in]      inFormat      Indicates the format of the property
+ *                                list data.
+ *  @param[in]      inPlist       The property list data to write.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListWriteToFD(int                  inDescriptor,
+                         size_t               inBufferSize,
+                         CFPropertyListFormat inFormat,
+                         CFPropertyListRef    inPlist,
+                         CFStringRef *        outError)
+{
+    bool             status    = false;
+    CFWriteStreamRef theStream = nullptr;
+    CFDataRef        theData   = nullptr;
+
+    __Require(inDescriptor >= 0, done);
+    __Require(inPlist != nullptr, done);
+
+    // Serialize the property list to memory.
+
+    theStream = CFWriteStreamCreateWithAllocatedBuffers(kCFAllocatorDefault,
+                                                        kCFAllocatorDefault);
+    __Require(theStream != nullptr, done);
+
+    status = CFWriteStreamOpen(theStream);
+    __Require(status, done);
+
+    status = CFUPropertyListWriteToStream(theStream,
+                                          inFormat,
+                                          inPlist,
+                                          outError);
+    __Require(status, done);
+
+    theData = static_cast<CFDataRef>(CFWriteStreamCopyProperty(theStream,
+                                                               kCFStreamPropertyDataWritten));
+    __Require_Action(theData != nullptr, done, status = false);
+
+    // Write the serialized data directly from the stream's storage.
+
+    status = CFUPropertyListWriteAll(inDescriptor,
+                                     CFDataGetBytePtr(theData),
+                                     static_cast<size_t>(CFDataGetLength(theData)),
+                                     inBufferSize);
+    __Require(status, done);
+
+ done:
+    if (theStream != nullptr) {
+        CFWriteStreamClose(theStream);
+    }
+
+    CFURelease(theData);
+    CFURelease(theStream);
+
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Read a property list from a string representation of a file path.
+ *
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data at the specified path.
+ *
+ *  @param[in]      inPath        A CoreFoundation string reference to
+ *                                the path to read the property list
+ *                                data from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromFile(CFStringRef         inPath,
+                            CFOptionFlags       inMutability,
+                            CFPropertyListRef * outPlist,
+                            CFStringRef *       outError)
+{
+    return (CFUPropertyListReadFromFileWithOptions(inPath,
+                                                   inMutability,
+                                                   nullptr,
+                                                   outPlist,
+                                                   outError));
+}
+
+/**
+ *  @brief
+ *    Read a property list from a string representation of a file
+ *    path, subject to read limits.
+ *
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data at the specified path, rejecting data
+ *  that exceeds any of the specified limits.
+ *
+ *  @param[in]      inPath        A CoreFoundation string reference to
+ *                                the path to read the property list
+ *                                data from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in]      inOptions     An optional pointer to the read
+ *                                limits to enforce. If null, no limits
+ *                                are enforced.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error or limit
+ *                                violation. On failure, this is a
+ *                                reference to the error. The caller
+ *                                owns the reference and is
+ *                                responsible for releasing the
+ *                                object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @sa CFUPropertyListReadFromURLWithOptions
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromFileWithOptions(CFStringRef                        inPath,
+                                       CFOptionFlags                      inMutability,
+                                       const CFUPropertyListReadOptions * inOptions,
+                                       CFPropertyListRef *                outPlist,
+                                       CFStringRef *                      outError)
+{
+    bool     kIsDirectory = true;
+    bool     status       = false;
+    CFURLRef theURL       = nullptr;
+
+    __Require(inPath != nullptr, done);
+    __Require(outPlist != nullptr, done);
+
+    // Attempt to create a CoreFoundation URL for the specified file
+    // path.
+
+    theURL = CFURLCreateWithFileSystemPath(kCFAllocatorDefault,
+                                           inPath,
+                                           kCFURLPOSIXPathStyle,
+                                           !kIsDirectory);
+    __Require(theURL != nullptr, done);
+
+    // Attempt to read the property list from the URL.
+
+    status = CFUPropertyListReadFromURLWithOptions(theURL,
+                                                   inMutability,
+                                                   inOptions,
+                                                   outPlist,
+                                                   outError);
+    __Require(status, done);
+
+done:
+    CFURelease(theURL);
+
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Write a property list to a string representation of a file path.
+ *
+ *  This routine attempts to write the property list data to a
+ *  property list file in the specified format at the specified
+ *  path.
+ *
+ *  @param[in]      inPath        A CoreFoundation string reference to
+ *                                the file to write the property list
+ *                                data to.
+ *  @param[in]      inFormat      Indicates the format of the property list
+ *                                file.
+ *  @param[in]      inPlist       The property list data to write.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListWriteToFile(CFStringRef          inPath,
+                           CFPropertyListFormat inFormat,
+                           CFPropertyListRef    inPlist,
+                           CFStringRef *        outError)
+{
+    bool     kIsDirectory = true;
+    bool     status       = false;
+    CFURLRef theURL       = nullptr;
+
+    __Require(inPath != nullptr, done);
+    __Require(inPlist != nullptr, done);
+
+    // Attempt to create a CoreFoundation URL for the specified file
+    // path.
+
+    theURL = CFURLCreateWithFileSystemPath(kCFAllocatorDefault,
+                                           inPath,
+                                           kCFURLPOSIXPathStyle,
+                                           !kIsDirectory);
+    __Require(theURL != nullptr, done);
+
+    // Attempt to write the property list to the URL.
+
+    status = CFUPropertyListWriteToURL(theURL, inFormat, inPlist, outError);
+    __Require(status, done);
+
+done:
+    CFURelease(theURL);
+
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Read a property list from a string representation of a file path.
+ *
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data at the specified path.
+ *
+ *  @param[in]      inPath        A pointer to a C string containing the
+ *                                path to read the property list data
+ *                                from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromFile(const char *        inPath,
+                            CFOptionFlags       inMutability,
+                            CFPropertyListRef * outPlist,
+                            CFStringRef *       outError)
+{
+    return (CFUPropertyListReadFromFileWithOptions(inPath,
+                                                   inMutability,
+                                                   nullptr,
+                                                   outPlist,
+                                                   outError));
+}
+
+/**
+ *  @brief
+ *    Read a property list from a string representation of a file
+ *    path, subject to read limits.
+ *
+ *  This routine attempts to create a property list from the XML or
+ *  binary property list data at the specified path, rejecting data
+ *  that exceeds any of the specified limits.
+ *
+ *  @param[in]      inPath        A pointer to a C string containing the
+ *                                path to read the property list data
+ *                                from.
+ *  @param[in]      inMutability  Specifies the degree of mutability for
+ *                                the returned property list.
+ *  @param[in]      inOptions     An optional pointer to the read
+ *                                limits to enforce. If null, no limits
+ *                                are enforced.
+ *  @param[in,out]  outPlist      A pointer to storage for the returned
+ *                                property list object. On success,
+ *                                this is a pointer to the property
+ *                                list. The caller owns the reference
+ *                                and is responsible for releasing the
+ *                                object.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error or limit
+ *                                violation. On failure, this is a
+ *                                reference to the error. The caller
+ *                                owns the reference and is
+ *                                responsible for releasing the
+ *                                object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @sa CFUPropertyListReadFromURLWithOptions
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListReadFromFileWithOptions(const char *                       inPath,
+                                       CFOptionFlags                      inMutability,
+                                       const CFUPropertyListReadOptions * inOptions,
+                                       CFPropertyListRef *                outPlist,
+                                       CFStringRef *                      outError)
+{
+    bool        status  = false;
+    CFStringRef thePath = nullptr;
+
+    __Require(inPath != nullptr, done);
+    __Require(outPlist != nullptr, done);
+
+    // Convert the provided path name to a CoreFoundation string.
+
+    thePath = CFStringCreateWithCString(kCFAllocatorDefault,
+                                        inPath,
+                                        CFStringGetSystemEncoding());
+    __Require(thePath != nullptr, done);
+
+    // Attempt to read the property list from the file at the
+    // specified path.
+
+    status = CFUPropertyListReadFromFileWithOptions(thePath,
+                                                    inMutability,
+                                                    inOptions,
+                                                    outPlist,
+                                                    outError);
+    __Require(status, done);
+
+done:
+    CFURelease(thePath);
+
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Write a property list to a string representation of a file path.
+ *
+ *  This routine attempts to write the property list data to a
+ *  property list file in the specified format at the specified path.
+ *
+ *  @param[in]      inPath        A pointer to a C string containing the
+ *                                path to write the property list data
+ *                                to.
+ *  @param[in]      inWritable    Indicates whether the resulting file
+ *                                should be writable.
+ *  @param[in]      inFormat      Indicates the format of the property list
+ *                                file.
+ *  @param[in]      inPlist       The property list data to write.
+ *  @param[in,out]  outError      An optional pointer to storage for a
+ *                                returned string indicating the
+ *                                nature of the parsing error. On
+ *                                failure, this is a reference to the
+ *                                parsing error. The caller owns the
+ *                                reference and is responsible for
+ *                                releasing the object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListWriteToFile(const char *         inPath,
+                           bool                 inWritable,
+                           CFPropertyListFormat inFormat,
+                           CFPropertyListRef    inPlist,
+                           CFStringRef *        outError)
+{
+    int          error;
+    CFStringRef  thePath     = nullptr;
+    const mode_t kReadAll    = (S_IRUSR | S_IRGRP | S_IROTH);
+    const mode_t kWriteAll   = (S_IWUSR | S_IWGRP | S_IWOTH);
+    const mode_t permissions = inWritable ? (kReadAll | kWriteAll) : kReadAll;
+    bool         status      = false;
+
+    __Require(inPath != nullptr, done);
+    __Require(inPlist != nullptr, done);
+
+    // Convert the provided path name to a CoreFoundation string.
+
+    thePath = CFStringCreateWithCString(kCFAllocatorDefault,
+                                        inPath,
+                                        CFStringGetSystemEncoding());
+    __Require(thePath != nullptr, done);
+
+    // Attempt to write the property list to the file at the specified
+    // path.
+
+    status = CFUPropertyListWriteToFile(thePath, inFormat, inPlist, outError);
+    __Require(status, done);
+
+    // Update the permissions according to the writability flag specified.
+
+    error = chmod(inPath, permissions);
+    __Require_Action(error == 0, done, status = false);
+
+    // At this point, all operations were successful. Set the return
+    // status accordingly.
+
+    status = true;
+
+done:
+    CFURelease(thePath);
+
+    return (status);
+}
+
+/**
+ *  This routine returns the CoreFoundation type identifier
+ *  corresponding to the specified property list schema type.
+ *
+ *  @param[in]  inType  The property list schema type.
+ *
+ *  @returns
+ *    The CoreFoundation type identifier, or zero (0) for any type.
+ *
+ *  @private
+ *
+ */
+static CFTypeID
+CFUPropertyListSchemaGetTypeID(CFUPropertyListSchemaType inType)
+{
+    CFTypeID theTypeID = 0;
+
+    switch (inType)
+    {
+
+    case kCFUPropertyListSchemaTypeArray:
+        theTypeID = CFArrayGetTypeID();
+        break;
+
+    case kCFUPropertyListSchemaTypeBoolean:
+        theTypeID = CFBooleanGetTypeID();
+        break;
+
+    case kCFUPropertyListSchemaTypeData:
+        theTypeID = CFDataGetTypeID();
+        break;
+
+    case kCFUPropertyListSchemaTypeDate:
+        theTypeID = CFDateGetTypeID();
+        break;
+
+    case kCFUPropertyListSchemaTypeDictionary:
+        theTypeID = CFDictionaryGetTypeID();
+        break;
+
+    case kCFUPropertyListSchemaTypeNumber:
+        theTypeID = CFNumberGetTypeID();
+        break;
+
+    case kCFUPropertyListSchemaTypeString:
+        theTypeID = CFStringGetTypeID();
+        break;
+
+    case kCFUPropertyListSchemaTypeAny:
+    default:
+        break;
+
+    }
+
+    return (theTypeID);
+}
+
+/**
+ *  This routine returns a human-readable name for the specified
+ *  property list schema type.
+ *
+ *  @param[in]  inType  The property list schema type.
+ *
+ *  @returns
+ *    A pointer to the null-terminated type name, or "unknown" if the
+ *    type is out of range.
+ *
+ *  @private
+ *
+ */
+static const char *
+CFUPropertyListSchemaGetTypeName(CFUPropertyListSchemaType inType)
+{
+    static const char * const kNames[] = {
+        "any",
+        "array",
+        "boolean",
+        "data",
+        "date",
+        "dictionary",
+        "number",
+        "string"
+    };
+    const char *              theName  = "unknown";
+
+    if ((inType >= kCFUPropertyListSchemaTypeAny) &&
+        (inType <= kCFUPropertyListSchemaTypeString))
+    {
+        theName = kNames[inType];
+    }
+
+    return (theName);
+}
+
+/**
+ *  This routine sets the expected type of the specified compiled
+ *  schema node, failing if it conflicts with a type already
+ *  expected of it.
+ *
+ *  @param[in,out]  inOutNode  A reference to the schema node.
+ *  @param[in]      inType     The expected type.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on conflict.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListSchemaNodeSetType(CFUPropertyListSchemaNode & inOutNode,
+                                 CFUPropertyListSchemaType   inType)
+{
+    bool status = true;
+
+    if (inOutNode.mType == kCFUPropertyListSchemaTypeAny)
+    {
+        inOutNode.mType   = inType;
+        inOutNode.mTypeID = CFUPropertyListSchemaGetTypeID(inType);
+    }
+    else if (inType != kCFUPropertyListSchemaTypeAny)
+    {
+        status = (inOutNode.mType == inType);
+    }
+
+    return (status);
+}
+
+/**
+ *  This routine compiles a single declarative schema entry into the
+ *  specified schema, creating any nodes along its key path.
+ *
+ *  @param[in,out]  inOutSchema  A reference to the schema being
+ *                               compiled.
+ *  @param[in]      inEntry      A reference to the entry to compile.
+ *
+ *  @returns
+ *    True if OK; otherwise, false if the key path is malformed or
+ *    the entry conflicts with another.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListSchemaCompileEntry(__CFUPropertyListSchema &          inOutSchema,
+                                  const CFUPropertyListSchemaEntry & inEntry)
+{
+    const char * theComponent = inEntry.mKeyPath;
+    size_t       theNode      = 0;
+    bool         status       = true;
+
+    while (status && (*theComponent != '\0'))
+    {
+        const char * theEnd     = strchr(theComponent, '.');
+        const size_t theLength  = ((theEnd == nullptr) ? strlen(theComponent) : static_cast<size_t>(theEnd - theComponent));
+        const string theName(theComponent, theLength);
+        const bool   theElement = (theName == "[]");
+        size_t       theChild;
+
+        // Empty components, such as in "A..B" or a trailing ".", are
+        // malformed.
+
+        __Require_Action(theLength > 0, done, status = false);
+        __Require_Action((theEnd == nullptr) || (theEnd[1] != '\0'), done, status = false);
+
+        // The parent is implicitly a container of the kind the
+        // component addresses.
+
+        status = CFUPropertyListSchemaNodeSetType(inOutSchema.mNodes[theNode],
+                                                  (theElement ?
+                                                   kCFUPropertyListSchemaTypeArray :
+                                                   kCFUPropertyListSchemaTypeDictionary));
+        __Require(status, done);
+
+        for (theChild = 0; theChild < inOutSchema.mNodes[theNode].mChildren.size(); theChild++)
+        {
+            if (inOutSchema.mNodes[inOutSchema.mNodes[theNode].mChildren[theChild]].mName == theName)
+            {
+                break;
+            }
+        }
+
+        if (theChild < inOutSchema.mNodes[theNode].mChildren.size())
+        {
+            theNode = inOutSchema.mNodes[theNode].mChildren[theChild];
+        }
+        else
+        {
+            CFUPropertyListSchemaNode theNewNode = { theName, nullptr, kCFUPropertyListSchemaTypeAny, 0, 0, 0, 0, false, vector<size_t>() };
+
+            if (!theElement)
+            {
+                theNewNode.mKey = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                            theName.c_str(),
+                                                            kCFStringEncodingUTF8);
+                __Require_Action(theNewNode.mKey != nullptr, done, status = false);
+            }
+
+            inOutSchema.mNodes.push_back(theNewNode);
+            inOutSchema.mNodes[theNode].mChildren.push_back(inOutSchema.mNodes.size() - 1);
+
+            theNode = inOutSchema.mNodes.size() - 1;
+        }
+
+        theComponent += theLength + ((theEnd == nullptr) ? 0 : 1);
+    }
+
+    // Each key path may be declared only once.
+
+    __Require_Action(!inOutSchema.mNodes[theNode].mDeclared, done, status = false);
+
+    status = CFUPropertyListSchemaNodeSetType(inOutSchema.mNodes[theNode], inEntry.mType);
+    __Require(status, done);
+
+    inOutSchema.mNodes[theNode].mFlags    = inEntry.mFlags;
+    inOutSchema.mNodes[theNode].mMinimum  = inEntry.mMinimum;
+    inOutSchema.mNodes[theNode].mMaximum  = inEntry.mMaximum;
+    inOutSchema.mNodes[theNode].mDeclared = true;
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Compile a declarative property list schema.
+ *
+ *  This routine compiles the specified declarative schema entries
+ *  into a schema that may be reused to validate any number of
+ *  property lists, either directly with
+ *  CFUPropertyListSchemaValidate or as part of a read by way of the
+ *  read options.
+ *
+ *  Key paths are resolved to CoreFoundation keys and types once, at
+ *  compile time, so that validation consists only of dictionary
+ *  lookups and type comparisons for the keys the schema names. Keys
+ *  not named by the schema are neither visited nor rejected.
+ *
+ *  @param[in]      inEntries  A pointer to the schema entries.
+ *  @param[in]      inCount    The number of schema entries.
+ *  @param[in,out]  outError   An optional pointer to storage for a
+ *                             returned string indicating the entry
+ *                             that could not be compiled. On failure,
+ *                             this is a reference to the error. The
+ *                             caller owns the reference and is
+ *                             responsible for releasing the object.
+ *
+ *  @returns
+ *    A reference to the compiled schema on success, which must be
+ *    released with CFUPropertyListSchemaDestroy; otherwise, null on
+ *    error.
+ *
+ *  @ingroup plist
+ *
+ */
+CFUPropertyListSchemaRef
+CFUPropertyListSchemaCreate(const CFUPropertyListSchemaEntry * inEntries,
+                            size_t                             inCount,
+                            CFStringRef *                      outError)
+{
+    const CFUPropertyListSchemaNode theRoot    = { string(), nullptr, kCFUPropertyListSchemaTypeAny, 0, 0, 0, 0, false, vector<size_t>() };
+    CFUPropertyListSchemaRef        theSchema  = nullptr;
+    const char *                    theKeyPath = nullptr;
+    const char *                    theReason  = "entries are null";
+    bool                            status     = false;
+
+    __Require_Quiet((inEntries != nullptr) || (inCount == 0), done);
+
+    theSchema = new (std::nothrow) __CFUPropertyListSchema();
+    __Require(theSchema != nullptr, done);
+
+    theSchema->mNodes.push_back(theRoot);
+
+    for (size_t i = 0; i < inCount; i++)
+    {
+        theReason = "entry has a null key path";
+        __Require_Quiet(inEntries[i].mKeyPath != nullptr, done);
+
+        theKeyPath = inEntries[i].mKeyPath;
+
+        theReason = "has an unknown type";
+        __Require_Quiet((inEntries[i].mType >= kCFUPropertyListSchemaTypeAny) &&
+                        (inEntries[i].mType <= kCFUPropertyListSchemaTypeString), done);
+
+        theReason = "is malformed or conflicts with another entry";
+        status = CFUPropertyListSchemaCompileEntry(*theSchema, inEntries[i]);
+        __Require_Quiet(status, done);
+    }
+
+    status = true;
+
+ done:
+    if (!status)
+    {
+        // Every failure is reported, naming the offending entry's
+        // key path where there is one.
+
+        if ((outError != nullptr) && (theKeyPath != nullptr))
+        {
+            *outError = CFStringCreateWithFormat(kCFAllocatorDefault,
+                                                 nullptr,
+                                                 CFSTR("Property list schema entry '%s' %s"),
+                                                 theKeyPath,
+                                                 theReason);
+        }
+        else if (outError != nullptr)
+        {
+            *outError = CFStringCreateWithFormat(kCFAllocatorDefault,
+                                                 nullptr,
+                                                 CFSTR("Property list schema %s"),
+                                                 theReason);
+        }
+
+        CFUPropertyListSchemaDestroy(theSchema);
+
+        theSchema = nullptr;
+    }
+
+    return (theSchema);
+}
+
+/**
+ *  @brief
+ *    Destroy a compiled property list schema.
+ *
+ *  @param[in]  inSchema  A reference to the schema to destroy. Null
+ *                        is permitted and ignored.
+ *
+ *  @ingroup plist
+ *
+ */
+void
+CFUPropertyListSchemaDestroy(CFUPropertyListSchemaRef inSchema)
+{
+    __Require_Quiet(inSchema != nullptr, done);
+
+    for (size_t i = 0; i < inSchema->mNodes.size(); i++)
+    {
+        CFURelease(inSchema->mNodes[i].mKey);
+    }
+
+    delete inSchema;
+
+ done:
+    return;
+}
+
+/**
+ *  This routine validates the specified value against the specified
+ *  compiled schema node and, recursively, its children, stopping at
+ *  the first violation.
+ *
+ *  @param[in]      inSchema  A reference to the compiled schema.
+ *  @param[in]      inNode    The index of the schema node describing
+ *                            the value.
+ *  @param[in]      inValue   The value to validate.
+ *  @param[in,out]  ioPath    A reference to the key path of the
+ *                            value. On violation, this is the key
+ *                            path of the offending value.
+ *  @param[in,out]  outReason A reference to storage for a
+ *                            description of the violation, if any.
+ *
+ *  @returns
+ *    True if the value conforms; otherwise, false.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListSchemaValidateNode(const __CFUPropertyListSchema & inSchema,
+                                  size_t                          inNode,
+                                  CFPropertyListRef               inValue,
+                                  string &                        ioPath,
+                                  string &                        outReason)
+{
+    const CFUPropertyListSchemaNode & theNode = inSchema.mNodes[inNode];
+    const CFTypeID                    theType = CFGetTypeID(inValue);
+    bool                              status  = true;
+
+    if ((theNode.mTypeID != 0) && (theType != theNode.mTypeID))
+    {
+        outReason  = "expected ";
+        outReason += CFUPropertyListSchemaGetTypeName(theNode.mType);
+
+        status = false;
+        goto done;
+    }
+
+    if (theNode.mFlags & kCFUPropertyListSchemaRange)
+    {
+        double theMeasure = 0;
+        bool   theHave    = true;
+
+        if (theType == CFNumberGetTypeID())
+        {
+            CFNumberGetValue(static_cast<CFNumberRef>(inValue), kCFNumberDoubleType, &theMeasure);
+        }
+        else if (theType == CFStringGetTypeID())
+        {
+            theMeasure = static_cast<double>(CFStringGetLength(static_cast<CFStringRef>(inValue)));
+        }
+        else if (theType == CFDataGetTypeID())
+        {
+            theMeasure = static_cast<double>(CFDataGetLength(static_cast<CFDataRef>(inValue)));
+        }
+        else if (theType == CFArrayGetTypeID())
+        {
+            theMeasure = static_cast<double>(CFArrayGetCount(static_cast<CFArrayRef>(inValue)));
+        }
+        else if (theType == CFDictionaryGetTypeID())
+        {
+            theMeasure = static_cast<double>(CFDictionaryGetCount(static_cast<CFDictionaryRef>(inValue)));
+        }
+        else
+        {
+            theHave = false;
+        }
+
+        if (theHave && ((theMeasure < theNode.mMinimum) || (theMeasure > theNode.mMaximum)))
+        {
+            outReason = ((theType == CFNumberGetTypeID()) ? "value out of range" : "length or count out of range");
+
+            status = false;
+            goto done;
+        }
+    }
+
+    // Visit only the children the schema names. Compilation
+    // guarantees the value is a dictionary or array as appropriate.
+
+    for (size_t i = 0; status && (i < theNode.mChildren.size()); i++)
+    {
+        const CFUPropertyListSchemaNode & theChild  = inSchema.mNodes[theNode.mChildren[i]];
+        const size_t                      theLength = ioPath.size();
+
+        if (theChild.mKey != nullptr)
+        {
+            CFPropertyListRef theValue = CFDictionaryGetValue(static_cast<CFDictionaryRef>(inValue),
+                                                              theChild.mKey);
+
+            if (!ioPath.empty())
+            {
+                ioPath += '.';
+            }
+
+            ioPath += theChild.mName;
+
+            if (theValue == nullptr)
+            {
+                if (theChild.mFlags & kCFUPropertyListSchemaRequired)
+                {
+                    outReason = "missing required key";
+
+                    status = false;
+                }
+            }
+            else
+            {
+                status = CFUPropertyListSchemaValidateNode(inSchema,
+                                                           theNode.mChildren[i],
+                                                           theValue,
+                                                           ioPath,
+                                                           outReason);
+            }
+        }
+        else
+        {
+            const CFIndex theCount = CFArrayGetCount(static_cast<CFArrayRef>(inValue));
+
+            for (CFIndex j = 0; status && (j < theCount); j++)
+            {
+                ioPath.resize(theLength);
+                ioPath += '[';
+                ioPath += to_string(j);
+                ioPath += ']';
+
+                status = CFUPropertyListSchemaValidateNode(inSchema,
+                                                           theNode.mChildren[i],
+                                                           CFArrayGetValueAtIndex(static_cast<CFArrayRef>(inValue), j),
+                                                           ioPath,
+                                                           outReason);
+            }
+        }
+
+        if (status)
+        {
+            ioPath.resize(theLength);
+        }
+    }
+
+ done:
+    return (status);
+}
+
+/**
+ *  @brief
+ *    Validate a property list against a compiled schema.
+ *
+ *  This routine validates the specified property list against the
+ *  specified compiled schema, stopping at the first violation.
+ *
+ *  @param[in]      inSchema  A reference to the compiled schema.
+ *  @param[in]      inPlist   The property list to validate.
+ *  @param[in,out]  outError  An optional pointer to storage for a
+ *                            returned string indicating the key path
+ *                            and nature of the first violation. On
+ *                            failure, this is a reference to the
+ *                            error. The caller owns the reference and
+ *                            is responsible for releasing the object.
+ *
+ *  @returns
+ *    True if the property list conforms; otherwise, false.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListSchemaValidate(CFUPropertyListSchemaRef inSchema,
+                              CFPropertyListRef        inPlist,
+                              CFStringRef *            outError)
+{
+    string thePath;
+    string theReason = "missing schema or property list";
+    bool   status    = false;
+
+    __Require_Quiet(inSchema != nullptr, done);
+    __Require_Quiet(inPlist != nullptr, done);
+
+    status = CFUPropertyListSchemaValidateNode(*inSchema, 0, inPlist, thePath, theReason);
+
+ done:
+    if (!status && (outError != nullptr))
+    {
+        *outError = CFStringCreateWithFormat(kCFAllocatorDefault,
+                                             nullptr,
+                                             CFSTR("Property list schema violation at '%s': %s"),
+                                             thePath.c_str(),
+                                             theReason.c_str());
+    }
+
+    return (status);
+}
+
+#if HAVE_SYS_INOTIFY_H
+/**
+ *  This routine is a CoreFoundation dictionary applier function that
+ *  iterates on each key/value pair common to the old and new watched
+ *  property lists and retains, with the new value, only those pairs
+ *  whose values differ.
+ *
+ *  @param[in]      inKey      A pointer to the key of the current
+ *                             key/value pair being iterated upon.
+ *  @param[in]      inValue    A pointer to the old value of the
+ *                             current key/value pair being iterated
+ *                             upon.
+ *  @param[in,out]  inContext  A pointer to the iterator context. On
+ *                             completion, the context's changed
+ *                             dictionary will contain the key and new
+ *                             value if the values differ.
+ *
+ *  @private
+ *
+ */
+static void
+CFUPropertyListWatcherChangedApplier(const void * inKey,
+                                     const void * inValue,
+                                     void *       inContext)
+{
+    CFUPropertyListWatcherChangedContext * theContext =
+        static_cast<CFUPropertyListWatcherChangedContext *>(inContext);
+    const void *                           theProposedValue;
+
+    __Require(inKey      != nullptr, done);
+    __Require(inValue    != nullptr, done);
+    __Require(theContext != nullptr, done);
+
+    theProposedValue = CFDictionaryGetValue(theContext->mProposed, inKey);
+    __Require(theProposedValue != nullptr, done);
+
+    if (!CFEqual(inValue, theProposedValue))
+    {
+        CFDictionarySetValue(theContext->mChanged, inKey, theProposedValue);
+    }
+
+ done:
+    return;
+}
+
+/**
+ *  This routine returns the current monotonic time, in milliseconds.
+ *
+ *  @returns
+ *    The current monotonic time, in milliseconds.
+ *
+ *  @private
+ *
+ */
+static int64_t
+CFUPropertyListWatcherGetMilliseconds(void)
+{
+    struct timespec theTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &theTime);
+
+    return ((static_cast<int64_t>(theTime.tv_sec) * 1000) +
+            (static_cast<int64_t>(theTime.tv_nsec) / 1000000));
+}
+
+/**
+ *  This routine waits up to the specified timeout for an inotify
+ *  event on the watched file, draining and discarding events for
+ *  other entries in the same directory.
+ *
+ *  @param[in]   inWatcher   A reference to the watcher to wait on.
+ *  @param[in]   inTimeout   The maximum time, in milliseconds, to
+ *                           wait. A negative value waits
+ *                           indefinitely.
+ *  @param[out]  outChanged  A reference to storage set to true if an
+ *                           event for the watched file was observed;
+ *                           otherwise, false.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @private
+ *
+ */
+static bool
+CFUPropertyListWatcherWait(CFUPropertyListWatcherRef inWatcher,
+                           int                       inTimeout,
+                           bool &                    outChanged)
+{
+    const int64_t theDeadline = CFUPropertyListWatcherGetMilliseconds() + inTimeout;
+    int           theTimeout  = inTimeout;
+    bool          status      = true;
+
+    outChanged = false;
+
+    while (!outChanged)
+    {
+        struct pollfd theDescriptor = { inWatcher->mDescriptor, POLLIN, 0 };
+        alignas(struct inotify_event) char theBuffer[4096];
+        ssize_t       theSize;
+        int           theResult;
+
+        theResult = poll(&theDescriptor, 1, theTimeout);
+
+        if (theResult < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        __Require_Action(theResult >= 0, done, status = false);
+
+        if (theResult == 0)
+        {
+            break;
+        }
+
+        theSize = read(inWatcher->mDescriptor, theBuffer, sizeof (theBuffer));
+        __Require_Action(theSize > 0 || errno == EAGAIN || errno == EINTR,
+                         done,
+                         status = false);
+
+        for (ssize_t theOffset = 0; theOffset < theSize; )
+        {
+            const struct inotify_event * theEvent =
+                reinterpret_cast<const struct inotify_event *>(&theBuffer[theOffset]);
+
+            if ((theEvent->len > 0) &&
+                (inWatcher->mName.compare(theEvent->name) == 0))
+            {
+                outChanged = true;
+            }
+
+            theOffset += static_cast<ssize_t>(sizeof (struct inotify_event) + theEvent->len);
+        }
+
+        if (inTimeout >= 0)
+        {
+            const int64_t theRemaining = theDeadline - CFUPropertyListWatcherGetMilliseconds();
+
+            if (theRemaining <= 0)
+            {
+                break;
+            }
+
+            theTimeout = static_cast<int>(theRemaining);
+        }
+    }
+
+ done:
+    return (status);
+}
+
+/**
+ *  This routine re-reads the watched property list file, differences
+ *  it against the previously-read property list, and invokes the
+ *  watcher callback with any added, changed, or removed entries.
+ *
+ *  A watched file that no longer exists is treated as an empty
+ *  dictionary. A watched file that does not contain a dictionary is
+ *  an error.
+ *
+ *  @param[in]      inWatcher  A reference to the watcher to reload.
+ *  @param[in,out]  outError   An optional pointer to storage for a
+ *                             returned string indicating the nature
+ *                             of the parsing error. On failure, this
+ *                             is a reference to the parsing or type
+ *                             error. The caller owns the reference
+ *                             and is responsible for releasing the
+ *                             object.
+ *
+ *  @returns
+ *    True if OK; otherwise, false on error.
+ *
+ *  @private
+ *
+ */
+static Boolean
+CFUPropertyListWatcherReload(CFUPropertyListWatcherRef inWatcher,
+                             CFStringRef *             outError)
+{
+    int                                  theDescriptor;
+    CFPropertyListRef                    theProposed = nullptr;
+    CFMutableDictionaryRef               theBase     = nullptr;
+    CFMutableDictionaryRef               theAdded    = nullptr;
+    CFMutableDictionaryRef               theCommon   = nullptr;
+    CFMutableDictionaryRef               theChanged  = nullptr;
+    CFMutableDictionaryRef               theRemoved  = nullptr;
+    CFUPropertyListWatcherChangedContext theContext;
+    Boolean                              status      = false;
+
+    theDescriptor = open(inWatcher->mPath.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (theDescriptor >= 0)
+    {
+        // The file is always re-read: its size and modification time
+        // cannot reliably reveal a change, as a same-size rewrite
+        // within the timestamp granularity leaves both unchanged.
+
+        status = CFUPropertyListReadFromFDWithAllocator(inWatcher->mAllocator,
+                                                        theDescriptor,
+                                                        0,
+                                                        inWatcher->mMutability,
+                                                        nullptr,
+                                                        &theProposed,
+                                                        outError);
+        __Require(status, done);
+
+        status = CFUIsTypeID(theProposed, CFDictionaryGetTypeID());
+
+        if (!status && (outError != nullptr))
+        {
+            *outError = CFStringCreateWithFormat(kCFAllocatorDefault,
+                                                 nullptr,
+                                                 CFSTR("Property list '%s' is not a dictionary"),
+                                                 inWatcher->mPath.c_str());
+        }
+        __Require(status, done);
+    }
+    else
+    {
+        __Require_Action(errno == ENOENT, done, status = false);
+
+        theProposed = CFDictionaryCreate(inWatcher->mAllocator,
+                                         nullptr,
+                                         nullptr,
+                                         0,
+                                         &kCFTypeDictionaryKeyCallBacks,
+                                         &kCFTypeDictionaryValueCallBacks);
+        __Require_Action(theProposed != nullptr, done, status = false);
+    }
+
+    theAdded   = CFDictionaryCreateMutable(inWatcher->mAllocator,
+                                           0,
+                                           &kCFTypeDictionaryKeyCallBacks,
+                                           &kCFTypeDictionaryValueCallBacks);
+    theCommon  = CFDictionaryCreateMutable(inWatcher->mAllocator,
+                                           0,
+                                           &kCFTypeDictionaryKeyCallBacks,
+                                           &kCFTypeDictionaryValueCallBacks);
+    theChanged = CFDictionaryCreateMutable(inWatcher->mAllocator,
+                                           0,
+                                           &kCFTypeDictionaryKeyCallBacks,
+                                           &kCFTypeDictionaryValueCallBacks);
+    theRemoved = CFDictionaryCreateMutable(inWatcher->mAllocator,
+                                           0,
+                                           &kCFTypeDictionaryKeyCallBacks,
+                                           &kCFTypeDictionaryValueCallBacks);
+    __Require_Action(theAdded   != nullptr, done, status = false);
+    __Require_Action(theCommon  != nullptr, done, status = false);
+    __Require_Action(theChanged != nullptr, done, status = false);
+    __Require_Action(theRemoved != nullptr, done, status = false);
+
+    // The difference only ever reads a non-null base; the cast away
+    // from immutability is safe.
+
+    CFUReferenceSet(theBase,
+                    const_cast<CFMutableDictionaryRef>(inWatcher->mPropertyList));
+
+    status = CFUDictionaryDifference(inWatcher->mAllocator,
+                                     static_cast<CFDictionaryRef>(theProposed),
+                                     theBase,
+                                     theAdded,
+                                     theCommon,
+                                     theRemoved);
+    __Require(status, done);
+
+    // The common dictionary contains every shared key; filter it
+    // down to only those whose values actually changed.
+
+    theContext.mProposed = static_cast<CFDictionaryRef>(theProposed);
+    theContext.mChanged  = theChanged;
+
+    CFDictionaryApplyFunction(theCommon,
+                              CFUPropertyListWatcherChangedApplier,
+                              &theContext);
+
+    // Commit the new property list before invoking the callback such
+    // that the callback observes a consistent watcher.
+
+    CFUReferenceSet(inWatcher->mPropertyList,
+                    static_cast<CFDictionaryRef>(theProposed));
+
+    if ((inWatcher->mCallBack != nullptr) &&
+        ((CFDictionaryGetCount(theAdded)   > 0) ||
+         (CFDictionaryGetCount(theChanged) > 0) ||
+         (CFDictionaryGetCount(theRemoved) > 0)))
+    {
+        inWatcher->mCallBack(inWatcher,
+                             theAdded,
+                             theChanged,
+                             theRemoved,
+                             inWatcher->mContext);
+    }
+
+ done:
+    if (theDescriptor >= 0) {
+        close(theDescriptor);
+    }
+
+    CFURelease(theProposed);
+    CFURelease(theBase);
+    CFURelease(theAdded);
+    CFURelease(theCommon);
+    CFURelease(theChanged);
+    CFURelease(theRemoved);
+
+    return (status);
+}
+#endif // HAVE_SYS_INOTIFY_H
+
+/**
+ *  @brief
+ *    Create a watcher for a property list file.
+ *
+ *  This routine creates a watcher that observes, via inotify, the
+ *  property list file at the specified path and, on change, reloads
+ *  it, differences it against the previously-read version with
+ *  #CFUDictionaryDifference, and delivers only the added, changed,
+ *  and removed entries to the specified callback.
+ *
+ *  The parent directory, rather than the file itself, is observed
+ *  such that files replaced by an atomic rename, as many editors and
+ *  configuration management tools do, continue to be watched. The
+ *  file need not exist at creation; a nonexistent file is treated as
+ *  an empty dictionary.
+ *
+ *  The watcher does not create any threads. Clients either call
+ *  #CFUPropertyListWatcherProcess directly or add the descriptor
+ *  returned by #CFUPropertyListWatcherGetFileDescriptor to their own
+ *  event loop and call it when the descriptor is readable.
+ *
+ *  @param[in]  inPath                  A pointer to a C string
+ *                                      containing the path of the
+ *                                      property list file to watch.
+ *                                      The file must contain a
+ *                                      dictionary.
+ *  @param[in]  inMutability            Specifies the degree of
+ *                                      mutability for property lists
+ *                                      read by the watcher.
+ *  @param[in]  inDebounceMilliseconds  The period, in milliseconds,
+ *                                      during which no further writes
+ *                                      must be observed before a
+ *                                      burst of writes triggers a
+ *                                      reload.
+ *  @param[in]  inCallBack              The callback to invoke when
+ *                                      the watched property list
+ *                                      changes.
+ *  @param[in]  inContext               An optional pointer to
+ *                                      caller context passed to @a
+ *                                      inCallBack.
+ *
+ *  @returns
+ *    A reference to the watcher if OK; otherwise, null on error or if
+ *    inotify is unavailable on the target system. The caller owns the
+ *    watcher and is responsible for destroying it with
+ *    #CFUPropertyListWatcherDestroy.
+ *
+ *  @sa CFUPropertyListWatcherCreateWithAllocator
+ *
+ *  @ingroup plist
+ *
+ */
+CFUPropertyListWatcherRef
+CFUPropertyListWatcherCreate(const char *                   inPath,
+                             CFOptionFlags                  inMutability,
+                             unsigned int                   inDebounceMilliseconds,
+                             CFUPropertyListWatcherCallBack inCallBack,
+                             void *                         inContext)
+{
+    return (CFUPropertyListWatcherCreateWithAllocator(kCFAllocatorDefault,
+                                                      inPath,
+                                                      inMutability,
+                                                      inDebounceMilliseconds,
+                                                      inCallBack,
+                                                      inContext));
+}
+
+/**
+ *  @brief
+ *    Create a watcher for a property list file with an allocator.
+ *
+ *  This routine creates a watcher as with
+ *  #CFUPropertyListWatcherCreate, except that the property lists it
+ *  reads, and the dictionaries of added, changed, and removed
+ *  entries it delivers, are created with the specified allocator.
+ *
+ *  @param[in]  inAllocator             The allocator to use to
+ *                                      allocate memory for property
+ *                                      lists and their differences.
+ *  @param[in]  inPath                  A pointer to a C string
+ *                                      containing the path of the
+ *                                      property list file to watch.
+ *                                      The file must contain a
+ *                                      dictionary.
+ *  @param[in]  inMutability            Specifies the degree of
+ *                                      mutability for property lists
+ *                                      read by the watcher.
+ *  @param[in]  inDebounceMilliseconds  The period, in milliseconds,
+ *                                      during which no further writes
+ *                                      must be observed before a
+ *                                      burst of writes triggers a
+ *                                      reload.
+ *  @param[in]  inCallBack              The callback to invoke when
+ *                                      the watched property list
+ *                                      changes.
+ *  @param[in]  inContext               An optional pointer to
+ *                                      caller context passed to @a
+ *                                      inCallBack.
+ *
+ *  @returns
+ *    A reference to the watcher if OK; otherwise, null on error or if
+ *    inotify is unavailable on the target system. The caller owns the
+ *    watcher and is responsible for destroying it with
+ *    #CFUPropertyListWatcherDestroy.
+ *
+ *  @ingroup plist
+ *
+ */
+CFUPropertyListWatcherRef
+CFUPropertyListWatcherCreateWithAllocator(CFAllocatorRef                 inAllocator,
+                                          const char *                   inPath,
+                                          CFOptionFlags                  inMutability,
+                                          unsigned int                   inDebounceMilliseconds,
+                                          CFUPropertyListWatcherCallBack inCallBack,
+                                          void *                         inContext)
+{
+    CFUPropertyListWatcherRef theWatcher = nullptr;
+
+#if HAVE_SYS_INOTIFY_H
+    const uint32_t            kMask      = (IN_CLOSE_WRITE |
+                                            IN_CREATE      |
+                                            IN_DELETE      |
+                                            IN_MODIFY      |
+                                            IN_MOVED_FROM  |
+                                            IN_MOVED_TO);
+    string                    theDirectory;
+    string::size_type         theSeparator;
+    Boolean                   status     = false;
+
+    __Require(inPath != nullptr, done);
+    __Require(inCallBack != nullptr, done);
+
+    theWatcher = new (std::nothrow) __CFUPropertyListWatcher();
+    __Require(theWatcher != nullptr, done);
+
+    theWatcher->mDescriptor   = -1;
+    theWatcher->mWatch        = -1;
+    theWatcher->mPath         = inPath;
+    theWatcher->mMutability   = inMutability;
+    theWatcher->mDebounce     = inDebounceMilliseconds;
+    theWatcher->mCallBack     = nullptr;
+    theWatcher->mContext      = inContext;
+    theWatcher->mPropertyList = nullptr;
+    theWatcher->mAllocator    = ((inAllocator == nullptr) ?
+                                 nullptr :
+                                 static_cast<CFAllocatorRef>(CFRetain(inAllocator)));
+
+    // Split the path into the parent directory to watch and the name
+    // to filter events on.
+
+    theSeparator = theWatcher->mPath.find_last_of('/');
+
+    if (theSeparator == string::npos)
+    {
+        theDirectory      = ".";
+        theWatcher->mName = theWatcher->mPath;
+    }
+    else
+    {
+        theDirectory      = (theSeparator == 0) ? "/" : theWatcher->mPath.substr(0, theSeparator);
+        theWatcher->mName = theWatcher->mPath.substr(theSeparator + 1);
+    }
+
+    __Require(!theWatcher->mName.empty(), done);
+
+    theWatcher->mDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    __Require(theWatcher->mDescriptor >= 0, done);
+
+    theWatcher->mWatch = inotify_add_watch(theWatcher->mDescriptor,
+                                           theDirectory.c_str(),
+                                           kMask);
+    __Require(theWatcher->mWatch >= 0, done);
+
+    // Establish the initial property list as the base for subsequent
+    // differences. The callback is not yet set, so it is not invoked
+    // for the initial contents.
+
+    theWatcher->mPropertyList = CFDictionaryCreate(theWatcher->mAllocator,
+                                                   nullptr,
+                                                   nullptr,
+                                                   0,
+                                                   &kCFTypeDictionaryKeyCallBacks,
+                                                   &kCFTypeDictionaryValueCallBacks);
+    __Require(theWatcher->mPropertyList != nullptr, done);
+
+    status = CFUPropertyListWatcherReload(theWatcher, nullptr);
+    __Require(status, done);
+
+    theWatcher->mCallBack = inCallBack;
+
+ done:
+    if (!status) {
+        CFUPropertyListWatcherDestroy(theWatcher);
+
+        theWatcher = nullptr;
+    }
+
+    return (theWatcher);
+#else
+    (void)inAllocator;
+    (void)inPath;
+    (void)inMutability;
+    (void)inDebounceMilliseconds;
+    (void)inCallBack;
+    (void)inContext;
+
+    return (theWatcher);
+#endif // HAVE_SYS_INOTIFY_H
+}
+
+/**
+ *  @brief
+ *    Destroy a property list file watcher.
+ *
+ *  This routine stops watching and releases all resources associated
+ *  with the specified property list file watcher.
+ *
+ *  @param[in]  inWatcher  A reference to the watcher to destroy. A
+ *                         null reference results in no action being
+ *                         taken.
+ *
+ *  @ingroup plist
+ *
+ */
+void
+CFUPropertyListWatcherDestroy(CFUPropertyListWatcherRef inWatcher)
+{
+    __Require_Quiet(inWatcher != nullptr, done);
+
+    if (inWatcher->mDescriptor >= 0) {
+        close(inWatcher->mDescriptor);
+    }
+
+    CFURelease(inWatcher->mPropertyList);
+    CFURelease(inWatcher->mAllocator);
+
+    delete inWatcher;
+
+ done:
+    return;
+}
+
+/**
+ *  This routine returns the descriptor underlying the specified
+ *  property list file watcher, suitable for adding to a select,
+ *  poll, or epoll event loop. When the descriptor is readable,
+ *  clients should call #CFUPropertyListWatcherProcess.
+ *
+ *  @param[in]  inWatcher  A reference to the watcher for which to
+ *                         return the descriptor.
+ *
+ *  @returns
+ *    The descriptor if OK; otherwise, -1 on error.
+ *
+ *  @ingroup plist
+ *
+ */
+int
+CFUPropertyListWatcherGetFileDescriptor(CFUPropertyListWatcherRef inWatcher)
+{
+    return ((inWatcher == nullptr) ? -1 : inWatcher->mDescriptor);
+}
+
+/**
+ *  This routine returns the property list most-recently read by the
+ *  specified property list file watcher.
+ *
+ *  @param[in]  inWatcher  A reference to the watcher for which to
+ *                         return the property list.
+ *
+ *  @returns
+ *    A reference to the property list if OK; otherwise, null on
+ *    error. The caller owns the reference and is responsible for
+ *    releasing the object.
+ *
+ *  @ingroup plist
+ *
+ */
+CFDictionaryRef
+CFUPropertyListWatcherCopyPropertyList(CFUPropertyListWatcherRef inWatcher)
+{
+    CFDictionaryRef thePropertyList = nullptr;
+
+    __Require(inWatcher != nullptr, done);
+
+    thePropertyList = CFURetain(inWatcher->mPropertyList);
+
+ done:
+    return (thePropertyList);
+}
+
+/**
+ *  @brief
+ *    Process pending changes for a property list file watcher.
+ *
+ *  This routine waits up to the specified timeout for a change to the
+ *  watched property list file. On change, it continues to wait until
+ *  the watcher's debounce period elapses without further changes
+ *  and then reloads and differences the file, invoking the watcher
+ *  callback if any entries were added, changed, or removed. A file
+ *  that keeps changing is reloaded anyway once a few debounce
+ *  periods have elapsed, such that the caller is never blocked
+ *  indefinitely.
+ *
+ *  @param[in]      inWatcher              A reference to the watcher
+ *                                         to process.
+ *  @param[in]      inTimeoutMilliseconds  The maximum time, in
+ *                                         milliseconds, to wait for
+ *                                         an initial change. Zero
+ *                                         (0) does not wait; a
+ *                                         negative value waits
+ *                                         indefinitely.
+ *  @param[in,out]  outError               An optional pointer to
+ *                                         storage for a returned
+ *                                         string indicating the
+ *                                         nature of the parsing
+ *                                         error. On failure, this is
+ *                                         a reference to the parsing
+ *                                         error. The caller owns the
+ *                                         reference and is
+ *                                         responsible for releasing
+ *                                         the object.
+ *
+ *  @returns
+ *    True if OK, including if no change was observed; otherwise,
+ *    false on error. On error, the previously-read property list is
+ *    retained as the base for subsequent differences.
+ *
+ *  @ingroup plist
+ *
+ */
+Boolean
+CFUPropertyListWatcherProcess(CFUPropertyListWatcherRef inWatcher,
+                              int                       inTimeoutMilliseconds,
+                              CFStringRef *             outError)
+{
+    Boolean status = false;
+
+#if HAVE_SYS_INOTIFY_H
+    int64_t theDeadline;
+    int64_t theRemaining;
+    bool    theChanged;
+    bool    theSettling;
+
+    __Require(inWatcher != nullptr, done);
+
+    status = CFUPropertyListWatcherWait(inWatcher,
+                                        inTimeoutMilliseconds,
+                                        theChanged);
+    __Require(status, done);
+    __Require_Quiet(theChanged, done);
+
+    // Debounce: keep absorbing changes until the file has been quiet
+    // for the debounce period or until the maximum settle time has
+    // elapsed, whichever comes first.
+
+    theDeadline = (CFUPropertyListWatcherGetMilliseconds() +
+                   (static_cast<int64_t>(inWatcher->mDebounce) *
+                    kCFUPropertyListWatcherMaximumSettlePeriods));
+
+    do {
+        theRemaining = min(static_cast<int64_t>(inWatcher->mDebounce),
+                           theDeadline - CFUPropertyListWatcherGetMilliseconds());
+
+        status = CFUPropertyListWatcherWait(inWatcher,
+                                            static_cast<int>(max(theRemaining, static_cast<int64_t>(0))),
+                                            theSettling);
+        __Require(status, done);
+    } while (theSettling &&
+             (CFUPropertyListWatcherGetMilliseconds() < theDeadline));
+
+    status = CFUPropertyListWatcherReload(inWatcher, outError);
+    __Require(status, done);
+
+ done:
+#else
+    (void)inWatcher;
+    (void)inTimeoutMilliseconds;
+    (void)outError;
+#endif // HAVE_SYS_INOTIFY_H
+
     return (status);
 }
 
+/**
+ *  This routine determines whether the specified CoreFoundation set
+ *  is an empty set.
+ *
+ *  @param[in]  inSet  The reference to the set to check for an empty set.
+ *
+ *  @returns
+ *    True if the set is the empty set or the specified reference is
+ *    null; otherwise, false.
+ *
+ *  @ingroup set
+ *
+ */
+bool
+CFUSetIsEmptySet(CFSetRef inSet)
+{
+    return ((inSet == nullptr) ? true : (CFSetGetCount(inSet) == 0));
+}
+
+/**
+ *  This routine performs the real work of the CFUSetIntersectionSet
+ *  function by serving as the iterator call back for the destination
+ *  set.
+ *
+ *  If the object of the destination set does not exist in the souce
+ *  set, it is removed from the source set.
+ *
+ *  @param[in]  inValue    A pointer to the object being iterated from
+ *                         the destination set.
+ *  @param[in]  inContext  A pointer to the call back context.
+ *
+ */
+static void
+CFUSetIntersectionApplier(const void * inValue, void * inContext)
+{
+    CFUSetContext * theContext = static_cast<CFUSetContext *>(inContext);
+
+    if (!CFSetContainsValue(theContext->mSourceSet, inValue)) {
+        CFSetRemoveValue(theContext->mDestinationSet, inValue);
+    }
+}
+
+/**
+ *  @brief
+ *    Create the intersection between two CoreFoundation sets.
+ *
+ *  This routine removes from one set each object not contained in a
+ *  second set resulting in the first set forming the intersection
+ *  of the two sets.
+ *
+ *  @param[in,out]  inDestinationSet  The mutable set that serves as
+ *                                    the destination of the
+ *                                    intersection and whose values
+ *                                    are checked against the source
+ *                                    set. On success, this contains
+ *                                    the intersection of the
+ *                                    destination and source sets.
+ *  @param[in]      inSourceSet       The immutable set that serves as
+ *                                    the source of the intersection.
+ *
+ *  @sa CFUSetUnionSet
+ *
+ *  @ingroup set
+ *
+ */
+void
+CFUSetIntersectionSet(CFMutableSetRef inDestinationSet, CFSetRef inSourceSet)
+{
+    CFUSetContext theContext = { inDestinationSet, inSourceSet };
+
+    if (inDestinationSet != nullptr && inSourceSet != nullptr) {
+        CFSetApplyFunction(inDestinationSet,
+                           CFUSetIntersectionApplier,
+                           &theContext);
+    }
+
+    return;
+}
+
+/**
+ *  This routine performs the real work of the CFUSetUnionSet
+ *  function by serving as the iterator call back for the source
+ *  set.
+ *
+ *  If the object of the source set does not exist in the destination
+ *  set, it is added.
+ *
+ *  @param[in]  inValue    A pointer to the object being iterated from
+ *                         the destination set.
+ *  @param[in]  inContext  A pointer to the call back context.
+ *
+ */
+static void
+CFUSetUnionApplier(const void * inValue, void * inContext)
+{
+    CFUSetContext * theContext = static_cast<CFUSetContext *>(inContext);
+
+    CFSetAddValue(theContext->mDestinationSet, inValue);
+}
+
+/**
+ *  @brief
+ *    Create the union between two CoreFoundation sets.
+ *
+ *  This routine adds to one set each object contained in a second
+ *  set not already present in the first set resulting in the first
+ *  set forming the union of the two sets.
+ *
+ *  @param[in,out]  inDestinationSet  The mutable set that serves as the
+ *                                    destination of the union. On
+ *                                    success, this contains the
+ *                                    union of the destination and
+ *                                    source sets.
+ *  @param[in]      inSourceSet       The immutable set that serves as
+ *                                    the source of the union and
+ *                                    whose values are checked against
+ *
+ *  @sa CFUSetIntersectionSet
+ *
+ *  @ingroup set
+ *
+ */
+void
+CFUSetUnionSet(CFMutableSetRef inDestinationSet, CFSetRef inSourceSet)
+{
+    CFUSetContext theContext = { inDestinationSet, inSourceSet };
+
+    if (inDestinationSet != nullptr && inSourceSet != nullptr) {
+        CFSetApplyFunction(inSourceSet, CFUSetUnionApplier, &theContext);
+    }
+
+    return;
+}
+
+/**
+ *  This routine initializes the specified CoreFoundation tree
+ *  context to required values prior to first use with other
+ *  CoreFoundation tree interfaces.
+ *
+ *  @param[in,out]  inContext  A pointer to the CoreFoundation tree
+ *                             context to initialize. On success, a
+ *                             pointer to the initialized
+ *                             CoreFoundation tree context.
+ *
+ *  @ingroup tree
+ */
+void
+CFUTreeContextInit(CFTreeContext * inContext)
+{
+    if (inContext != nullptr) {
+        *inContext = kCFUTreeContextInitializer;
+    }
+}
+
+/**
+ *  This routine creates a new mutable CoreFoundation tree and
+ *  associates with it the specified CoreFoundation object.
+ *
+ *  @param[in,out]  inType  A CoreFoundation base reference to the
+ *                          object to be associated with the tree. On
+ *                          success, a CoreFoundation base reference
+ *                          to the object to be associated with the
+ *                          tree with its reference count increased
+ *                          by one.
+ *
+ *  @returns
+ *    A reference to the newly-created tree if OK; otherwise, null on
+ *    error.
+ *
+ *  @ingroup tree
+ *
+ */
+CFTreeRef
+CFUTreeCreate(CFTypeRef inType)
+{
+    CFTreeRef     tempTree = nullptr;
+    CFTreeContext theContext;
+
+    CFUTreeContextInit(&theContext);
+
+    theContext.info            = const_cast<void *>(inType);
+    theContext.retain          = CFRetain;
+    theContext.release         = CFRelease;
+    theContext.copyDescription = CFCopyDescription;
+
+    tempTree = CFTreeCreate(kCFAllocatorDefault, &theContext);
+    __Require(tempTree != nullptr, done);
+
+done:
+    return (tempTree);
+}
+
+/**
+ *  @brief
+ *    Remove a trailing newline, if present, from the specified
+ *    string.
+ *
+ *  This attempts to remove, if present, a trailing newline from the
+ *  specified string.
+ *
+ *  @param[in,out]  inOutString  A CoreFoundation mutable string
+ *                               reference from which to try to remove
+ *                               a trailing newline.
+ *  @param[in,out]  inOutLength  The length of @a inOutString, in
+ *                               characters, before and, if
+ *                               successful, after removal of any
+ *                               trailing newline. On success, the
+ *                               output value is expected to be one
+ *                               less than its input value.
+ *
+ *  @returns
+ *    True if a trailing newline was found and removed; otherwise,
+ *    false.
+ *
+ */
+bool
+CFUStringChomp(CFMutableStringRef inOutString, size_t &inOutLength)
+{
+    CFIndex  lReplacedInstances;
+    bool     lRetval = false;
+
+    __Require(inOutString != nullptr, done);
+
+    lReplacedInstances = CFStringFindAndReplace(inOutString,
+                                                CFSTR("\n"),
+                                                CFSTR(""),
+                                                CFRangeMake(static_cast<CFIndex>(inOutLength - 1),
+                                                            static_cast<CFIndex>(inOutLength)),
+                                                kCFCompareBackwards);
+
+    if (lReplacedInstances == 1)
+    {
+        inOutLength--;
+
+        lRetval = true;
+    }
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  @brief
+ *    Remove a trailing newline, if present, from the specified
+ *    string.
+ *
+ *  This attempts to remove, if present, a trailing newline from the
+ *  specified string.
+ *
+ *  @param[in,out]  inOutString  A CoreFoundation mutable string
+ *                               reference from which to try to remove
+ *                               a trailing newline.
+ *
+ *  @returns
+ *    True if a trailing newline was found and removed; otherwise,
+ *    false.
+ *
+ */
+bool
+CFUStringChomp(CFMutableStringRef inOutString)
+{
+    size_t  lLength;
+    bool    lRetval = false;
+
+    __Require(inOutString != nullptr, done);
+
+    lLength = static_cast<size_t>(CFStringGetLength(inOutString));
+
+    lRetval = CFUStringChomp(inOutString, lLength);
+
+ done:
+    return (lRetval);
+}
+
+/**
+ *  This routine returns the 64-bit FNV-1a hash of the specified
+ *  bytes.
+ *
+ *  @param[in]  inBytes   A pointer to the bytes to hash.
+ *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+ *
+ *  @returns
+ *    The hash of the bytes.
+ *
+ */
+static size_t
+CFUStringInternHash(const char * inBytes, size_t inLength)
+{
+    uint64_t theHash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < inLength; i++)
+    {
+        theHash ^= static_cast<unsigned char>(inBytes[i]);
+        theHash *= 1099511628211ULL;
+    }
+
+    return (static_cast<size_t>(theHash));
+}
+
+/**
+ *  This routine searches the specified bucket chain, from the first
+ *  entry up to but excluding the last entry, for an interned string
+ *  with the specified bytes.
+ *
+ *  @param[in]  inFirst   The first entry to search.
+ *  @param[in]  inLast    The entry at which to stop searching, or
+ *                        null to search the whole chain.
+ *  @param[in]  inHash    The hash of @a inBytes.
+ *  @param[in]  inBytes   A pointer to the UTF-8 bytes to find.
+ *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+ *
+ *  @returns
+ *    The interned string if found; otherwise, null.
+ *
+ */
+static CFStringRef
+CFUStringInternFind(const CFUStringInternEntry * inFirst,
+                    const CFUStringInternEntry * inLast,
+                    size_t                       inHash,
+                    const char *                 inBytes,
+                    size_t                       inLength)
+{
+    for (const CFUStringInternEntry * theEntry = inFirst; theEntry != inLast; theEntry = theEntry->mNext)
+    {
+        if ((theEntry->mHash == inHash) &&
+            (theEntry->mLength == inLength) &&
+            (memcmp(theEntry->mBytes, inBytes, inLength) == 0))
+        {
+            return (theEntry->mString);
+        }
+    }
+
+    return (nullptr);
+}
+
+/**
+ *  This routine returns the canonical string for the specified UTF-8
+ *  bytes with the specified hash, interning it if it has not yet
+ *  been.
+ *
+ *  @param[in]  inUTF8String  A pointer to the UTF-8 bytes to intern.
+ *  @param[in]  inLength      The length, in bytes, of @a
+ *                            inUTF8String.
+ *  @param[in]  inHash        The 64-bit FNV-1a hash of @a
+ *                            inUTF8String. The caller is responsible
+ *                            for its correctness; a wrong hash
+ *                            interns a duplicate.
+ *
+ *  @returns
+ *    The interned string on success, which the caller must not
+ *    release; otherwise, null if @a inUTF8String is null or is not
+ *    valid UTF-8.
+ *
+ *  @private
+ *
+ */
+static CFStringRef
+CFUStringInternGet(const char * inUTF8String, size_t inLength, size_t inHash)
+{
+    const bool                       kIsExternalRepresentation = true;
+    const size_t                     theHash   = inHash;
+    atomic<CFUStringInternEntry *> * theBucket;
+    CFUStringInternEntry *           theHead;
+    CFUStringInternEntry *           theEntry  = nullptr;
+    CFStringRef                      theString = nullptr;
+
+    __Require(inUTF8String != nullptr, done);
+
+    theBucket = &sCFUStringInternTable[theHash & (kCFUStringInternBuckets - 1)];
+    theHead   = theBucket->load(memory_order_acquire);
+
+    theString = CFUStringInternFind(theHead, nullptr, theHash, inUTF8String, inLength);
+    __Require_Quiet(theString == nullptr, done);
+
+    // The string has not yet been interned. Create an entry for it,
+    // with the string backed by the entry's own copy of the bytes.
+
+    theEntry = static_cast<CFUStringInternEntry *>(malloc(sizeof (CFUStringInternEntry) + inLength));
+    __Require(theEntry != nullptr, done);
+
+    memcpy(theEntry->mBytes, inUTF8String, inLength);
+
+    theEntry->mHash   = theHash;
+    theEntry->mLength = inLength;
+    theEntry->mString = CFStringCreateWithBytesNoCopy(kCFAllocatorDefault,
+                                                      reinterpret_cast<const UInt8 *>(theEntry->mBytes),
+                                                      static_cast<CFIndex>(inLength),
+                                                      kCFStringEncodingUTF8,
+                                                      !kIsExternalRepresentation,
+                                                      kCFAllocatorNull);
+    __Require(theEntry->mString != nullptr, done);
+
+    // Publish the entry unless another thread publishes the same
+    // bytes first, in which case its string wins and this entry is
+    // discarded. Only the entries published since the last attempt
+    // need be searched.
+
+    theEntry->mNext = theHead;
+
+    while (!theBucket->compare_exchange_weak(theEntry->mNext,
+                                             theEntry,
+                                             memory_order_release,
+                                             memory_order_acquire))
+    {
+        theString = CFUStringInternFind(theEntry->mNext, theHead, theHash, inUTF8String, inLength);
+
+        if (theString != nullptr)
+        {
+            CFRelease(theEntry->mString);
+
+            break;
+        }
+
+        theHead = theEntry->mNext;
+    }
+
+    if (theString == nullptr)
+    {
+        theString = theEntry->mString;
+        theEntry  = nullptr;
+    }
+
+done:
+    if (theEntry != nullptr)
+    {
+        free(theEntry);
+    }
+
+    return (theString);
+}
+
 /**
  *  @brief
- *    Apply a difference between the proposed and base dictionaries.
+ *    Return the canonical string for the specified UTF-8 bytes.
  *
- *  The attempts to apply a difference between the proposed and base
- *  dictionaries, returning, if requested by virtue of non-null
- *  mutable dictionary references, the entries between the proposed
- *  and base dictionaries that are unique to the proposed (that is,
- *  added relative to the base), unique to the proposed (that is,
- *  removed relative to the base), and common between them, though
- *  with potentially different values between the base and proposed in
- *  such case, the common dictionary will contain the base value.
+ *  This returns a canonical, immortal CoreFoundation string for the
+ *  specified UTF-8 byte sequence, creating it on first use. Every
+ *  call with the same bytes, from any thread, returns the very same
+ *  string reference. Interned strings may therefore be compared by
+ *  pointer, which both CoreFoundation collection probes and
+ *  #CFUStringsMatch check before comparing contents.
  *
- *  @param[in]      inProposed  A reference to the dictionary serving
- *                              as the focus of the difference.
- *  @param[in,out]  inOutBase   A pointer to a mutable dictionary
- *                              reference serving as the base of the
- *                              difference. The reference itself is
- *                              optional and may be null. If the
- *                              reference is null, a mutable
- *                              dictionary will be allocated on the
- *                              caller's behalf that becomes their
- *                              responsiblity to release on success.
- *  @param[out]     outAdded    An optional reference to the mutable
- *                              dictionary containing entries unique
- *                              to the proposed dictionary. If null,
- *                              no such entries will be enumerated and
- *                              populated.
- *  @param[out]     outCommon   An optional reference to the mutable
- *                              dictionary containing entries common
- *                              to both the base and current
- *                              dictionary but that may be changed
- *                              between them in terms of values. If
- *                              null, no such entries will be
- *                              enumerated and populated.
- *  @param[out]     outRemoved  A optional reference to the mutable
- *                              dictionary containing entries unique
- *                              to the base dictionary. If null, no
- *                              such entries will be enumerated and
- *                              populated.
+ *  Lookups are lock-free and, once a string has been interned,
+ *  allocation-free, making this suitable for dictionary keys
+ *  created repeatedly in hot paths.
+ *
+ *  @note
+ *    Interned strings live for the lifetime of the process and
+ *    should be reserved for a bounded set of keys, not for
+ *    arbitrary or untrusted input.
+ *
+ *  @param[in]  inUTF8String  A pointer to the UTF-8 bytes to intern.
+ *  @param[in]  inLength      The length, in bytes, of @a
+ *                            inUTF8String.
  *
  *  @returns
- *    True if the difference was successful; otherwise, false. False
- *    may be returned if an incorrect argument was supplied or if
- *    memory allocation was unsuccessful.
+ *    The interned string on success, which the caller must not
+ *    release; otherwise, null if @a inUTF8String is null or is not
+ *    valid UTF-8.
  *
- *  @ingroup dictionary
+ *  @ingroup string
  *
  */
-Boolean
-CFUDictionaryDifference(CFDictionaryRef inProposed,
-                        CFMutableDictionaryRef *inOutBase,
-                        CFMutableDictionaryRef outAdded,
-                        CFMutableDictionaryRef outCommon,
-                        CFMutableDictionaryRef outRemoved)
+CFStringRef
+CFUStringGetInterned(const char * inUTF8String, size_t inLength)
 {
-    Boolean status = true;
+    CFStringRef theString = nullptr;
 
-    __Require_Action(inOutBase != nullptr, done, status = false);
+    __Require(inUTF8String != nullptr, done);
 
-    status = CFUDictionaryDifference(inProposed,
-                                     *inOutBase,
-                                     outAdded,
-                                     outCommon,
-                                     outRemoved);
+    theString = CFUStringInternGet(inUTF8String,
+                                   inLength,
+                                   CFUStringInternHash(inUTF8String, inLength));
 
- done:
-    return (status);
+done:
+    return (theString);
+}
+
+/**
+ *  @brief
+ *    Return the canonical string for the specified null-terminated
+ *    UTF-8 C string.
+ *
+ *  @param[in]  inUTF8String  A pointer to the null-terminated UTF-8
+ *                            C string to intern.
+ *
+ *  @returns
+ *    The interned string on success, which the caller must not
+ *    release; otherwise, null.
+ *
+ *  @sa CFUStringGetInterned
+ *
+ *  @ingroup string
+ *
+ */
+CFStringRef
+CFUStringGetInternedCString(const char * inUTF8String)
+{
+    CFStringRef theString = nullptr;
+
+    __Require(inUTF8String != nullptr, done);
+
+    theString = CFUStringGetInterned(inUTF8String, strlen(inUTF8String));
+
+done:
+    return (theString);
+}
+
+/**
+ *  This routine returns the canonical string for the specified UTF-8
+ *  bytes with a precomputed hash, such that a lookup of a static
+ *  string need not examine its bytes more than once.
+ *
+ *  This is private to CFStaticString, which alone guarantees that
+ *  the hash matches the bytes.
+ *
+ *  @param[in]  inUTF8String  A pointer to the UTF-8 bytes to intern.
+ *  @param[in]  inLength      The length, in bytes, of @a
+ *                            inUTF8String.
+ *  @param[in]  inHash        The 64-bit FNV-1a hash of @a
+ *                            inUTF8String, as returned by
+ *                            CFStaticString::Hash.
+ *
+ *  @returns
+ *    The interned string on success, which the caller must not
+ *    release; otherwise, null if @a inUTF8String is null or is not
+ *    valid UTF-8.
+ *
+ */
+CFStringRef
+CFStaticString :: GetInterned(const char * inUTF8String, size_t inLength, size_t inHash)
+{
+    return (CFUStringInternGet(inUTF8String, inLength, inHash));
+}
+
+/**
+ *  A function returning the length of the leading run of ASCII bytes
+ *  in the specified bytes.
+ *
+ *  @private
+ */
+typedef size_t (*CFUStringASCIIPrefixLengthFunction)(const unsigned char * inBytes,
+                                                     size_t                inLength);
+
+/**
+ *  This routine returns the length of the leading run of ASCII bytes
+ *  in the specified bytes, examining eight (8) bytes at a time in a
+ *  general purpose register.
+ *
+ *  @param[in]  inBytes   A pointer to the bytes to examine.
+ *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+ *
+ *  @returns
+ *    The offset of the first non-ASCII byte, or @a inLength if every
+ *    byte is ASCII.
+ *
+ */
+static size_t
+CFUStringASCIIPrefixLengthScalar(const unsigned char * inBytes, size_t inLength)
+{
+    static const uint64_t kHighBits = 0x8080808080808080ULL;
+    uint64_t              theWord;
+    size_t                i         = 0;
+
+    for (; (i + sizeof (theWord)) <= inLength; i += sizeof (theWord))
+    {
+        memcpy(&theWord, &inBytes[i], sizeof (theWord));
+
+        if ((theWord & kHighBits) != 0)
+        {
+            break;
+        }
+    }
+
+    while ((i < inLength) && (inBytes[i] < 0x80))
+    {
+        i++;
+    }
+
+    return (i);
+}
+
+#if CFUTILITIES_STRING_X86_DISPATCH
+/**
+ *  This routine returns the length of the leading run of ASCII bytes
+ *  in the specified bytes, examining sixteen (16) bytes at a time
+ *  with SSE2.
+ *
+ *  @param[in]  inBytes   A pointer to the bytes to examine.
+ *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+ *
+ *  @returns
+ *    The offset of the first non-ASCII byte, or @a inLength if every
+ *    byte is ASCII.
+ *
+ */
+__attribute__((target("sse2")))
+static size_t
+CFUStringASCIIPrefixLengthSSE2(const unsigned char * inBytes, size_t inLength)
+{
+    __m128i theVector;
+    int     theMask = 0;
+    size_t  i       = 0;
+
+    for (; (i + sizeof (theVector)) <= inLength; i += sizeof (theVector))
+    {
+        theVector = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&inBytes[i]));
+        theMask   = _mm_movemask_epi8(theVector);
+
+        if (theMask != 0)
+        {
+            break;
+        }
+    }
+
+    if (theMask != 0)
+    {
+        i += static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(theMask)));
+    }
+    else
+    {
+        i += CFUStringASCIIPrefixLengthScalar(&inBytes[i], inLength - i);
+    }
+
+    return (i);
+}
+
+/**
+ *  This routine returns the length of the leading run of ASCII bytes
+ *  in the specified bytes, examining thirty-two (32) bytes at a time
+ *  with AVX2.
+ *
+ *  @param[in]  inBytes   A pointer to the bytes to examine.
+ *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+ *
+ *  @returns
+ *    The offset of the first non-ASCII byte, or @a inLength if every
+ *    byte is ASCII.
+ *
+ */
+__attribute__((target("avx2")))
+static size_t
+CFUStringASCIIPrefixLengthAVX2(const unsigned char * inBytes, size_t inLength)
+{
+    __m256i theVector;
+    int     theMask = 0;
+    size_t  i       = 0;
+
+    for (; (i + sizeof (theVector)) <= inLength; i += sizeof (theVector))
+    {
+        theVector = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&inBytes[i]));
+        theMask   = _mm256_movemask_epi8(theVector);
+
+        if (theMask != 0)
+        {
+            break;
+        }
+    }
+
+    if (theMask != 0)
+    {
+        i += static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(theMask)));
+    }
+    else
+    {
+        i += CFUStringASCIIPrefixLengthSSE2(&inBytes[i], inLength - i);
+    }
+
+    return (i);
+}
+#endif // CFUTILITIES_STRING_X86_DISPATCH
+
+/**
+ *  This routine selects, based on the capabilities of the CPU on
+ *  which it runs, the fastest available implementation for finding
+ *  the leading run of ASCII bytes.
+ *
+ *  @returns
+ *    The selected implementation.
+ *
+ */
+static CFUStringASCIIPrefixLengthFunction
+CFUStringASCIIPrefixLengthSelect(void)
+{
+    CFUStringASCIIPrefixLengthFunction theFunction = CFUStringASCIIPrefixLengthScalar;
+
+#if CFUTILITIES_STRING_X86_DISPATCH
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        theFunction = CFUStringASCIIPrefixLengthAVX2;
+    }
+    else if (__builtin_cpu_supports("sse2"))
+    {
+        theFunction = CFUStringASCIIPrefixLengthSSE2;
+    }
+#endif // CFUTILITIES_STRING_X86_DISPATCH
+
+    return (theFunction);
+}
+
+/**
+ *  This routine returns the length of the leading run of ASCII bytes
+ *  in the specified bytes, using the fastest implementation the CPU
+ *  supports, as selected on first use.
+ *
+ *  @param[in]  inBytes   A pointer to the bytes to examine.
+ *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+ *
+ *  @returns
+ *    The offset of the first non-ASCII byte, or @a inLength if every
+ *    byte is ASCII.
+ *
+ */
+static size_t
+CFUStringASCIIPrefixLength(const unsigned char * inBytes, size_t inLength)
+{
+    static const CFUStringASCIIPrefixLengthFunction sFunction = CFUStringASCIIPrefixLengthSelect();
+
+    return (sFunction(inBytes, inLength));
+}
+
+/**
+ *  This routine determines whether the specified byte is within the
+ *  specified inclusive range.
+ *
+ */
+static inline bool
+CFUStringByteIsInRange(unsigned char inByte, unsigned char inMinimum, unsigned char inMaximum)
+{
+    return ((inByte >= inMinimum) && (inByte <= inMaximum));
+}
+
+/**
+ *  This routine determines whether the specified bytes are well-formed
+ *  UTF-8, per Table 3-7 of the Unicode Standard, skipping runs of
+ *  ASCII with #CFUStringASCIIPrefixLength.
+ *
+ *  @param[in]  inBytes   A pointer to the bytes to validate.
+ *  @param[in]  inLength  The length, in bytes, of @a inBytes.
+ *
+ *  @returns
+ *    True if the bytes are well-formed UTF-8; otherwise, false.
+ *
+ */
+static bool
+CFUStringBytesAreUTF8(const unsigned char * inBytes, size_t inLength)
+{
+    unsigned char theLead;
+    size_t        theRemaining;
+    size_t        i = 0;
+    bool          theRetval = false;
+
+    while (i < inLength)
+    {
+        theLead = inBytes[i];
+
+        if (theLead < 0x80)
+        {
+            i += CFUStringASCIIPrefixLength(&inBytes[i], inLength - i);
+            continue;
+        }
+
+        theRemaining = inLength - i;
+
+        if (CFUStringByteIsInRange(theLead, 0xC2, 0xDF))
+        {
+            __Require_Quiet(theRemaining >= 2, done);
+            __Require_Quiet(CFUStringByteIsInRange(inBytes[i + 1], 0x80, 0xBF), done);
+
+            i += 2;
+        }
+        else if (CFUStringByteIsInRange(theLead, 0xE0, 0xEF))
+        {
+            __Require_Quiet(theRemaining >= 3, done);
+            __Require_Quiet(CFUStringByteIsInRange(inBytes[i + 1],
+                                                   (theLead == 0xE0) ? 0xA0 : 0x80,
+                                                   (theLead == 0xED) ? 0x9F : 0xBF), done);
+            __Require_Quiet(CFUStringByteIsInRange(inBytes[i + 2], 0x80, 0xBF), done);
+
+            i += 3;
+        }
+        else
+        {
+            __Require_Quiet(CFUStringByteIsInRange(theLead, 0xF0, 0xF4), done);
+            __Require_Quiet(theRemaining >= 4, done);
+            __Require_Quiet(CFUStringByteIsInRange(inBytes[i + 1],
+                                                   (theLead == 0xF0) ? 0x90 : 0x80,
+                                                   (theLead == 0xF4) ? 0x8F : 0xBF), done);
+            __Require_Quiet(CFUStringByteIsInRange(inBytes[i + 2], 0x80, 0xBF), done);
+            __Require_Quiet(CFUStringByteIsInRange(inBytes[i + 3], 0x80, 0xBF), done);
+
+            i += 4;
+        }
+    }
+
+    theRetval = true;
+
+done:
+    return (theRetval);
 }
 
 /**
- *  This routines returns the appropriate CoreFoundation number type
- *  for the specified parameters.
- *
- *  @note
- *    Clients are discouraged from calling this interface directly and
- *    should, instead, use the template function version.
- *
- *  @param[in]  inIntegral  A Boolean indicating whether the type is
- *                          integral (true) or floating point
- *                          (false).
- *  @param[in]  inBytes     The size, in bytes, of the number representation.
+ *  @brief
+ *    Create a string from UTF-8 bytes.
+ *
+ *  This routine creates a string from the specified UTF-8 bytes,
+ *  validating them first with a SIMD scan, selected at run time for
+ *  the CPU, for runs of ASCII. Bytes that are all ASCII are handed
+ *  to CoreFoundation as ASCII, which it stores directly in its
+ *  compact, eight-bit representation without transcoding. Bytes that
+ *  are not well-formed UTF-8 are rejected without involving
+ *  CoreFoundation at all.
+ *
+ *  @param[in]  inAllocator  The allocator to use to allocate memory
+ *                           for the string.
+ *  @param[in]  inBytes      A pointer to the UTF-8 bytes, which need
+ *                           not be null-terminated.
+ *  @param[in]  inLength     The length, in bytes, of @a inBytes.
  *
  *  @returns
- *    The corresponding CoreFoundation number type if a successful
- *    mapping was found; otherwise, false.
+ *    A reference to the string if OK; otherwise, NULL if @a inBytes
+ *    is null or not valid UTF-8. The caller owns the reference and
+ *    is responsible for releasing the object.
  *
- *  @ingroup number
+ *  @ingroup string
  *
  */
-CFNumberType
-CFUGetNumberType(bool inIntegral, size_t inBytes)
+CFStringRef
+CFUStringCreateWithUTF8Bytes(CFAllocatorRef inAllocator,
+                             const char *   inBytes,
+                             size_t         inLength)
 {
-    CFNumberType theType = static_cast<CFNumberType>(false);
-
-    if (inIntegral) {
-        if (inBytes == 1) {
-            theType = kCFNumberSInt8Type;
+    const unsigned char * const theBytes  = reinterpret_cast<const unsigned char *>(inBytes);
+    size_t                      theASCIILength;
+    CFStringEncoding            theEncoding;
+    CFStringRef                 theString = nullptr;
 
-        } else if (inBytes == 2) {
-            theType = kCFNumberSInt16Type;
-
-        } else if (inBytes == 4) {
-            theType = kCFNumberSInt32Type;
+    __Require(inBytes != nullptr, done);
 
-        } else if (inBytes == 8) {
-            theType = kCFNumberSInt64Type;
-        }
+    theASCIILength = CFUStringASCIIPrefixLength(theBytes, inLength);
 
-    } else {
-        if (inBytes == 4) {
-            theType = kCFNumberFloat32Type;
+    if (theASCIILength == inLength)
+    {
+        theEncoding = kCFStringEncodingASCII;
+    }
+    else
+    {
+        __Require_Quiet(CFUStringBytesAreUTF8(&theBytes[theASCIILength],
+                                              inLength - theASCIILength), done);
 
-        } else if (inBytes == 8) {
-            theType = kCFNumberFloat64Type;
-        }
+        theEncoding = kCFStringEncodingUTF8;
     }
 
-    return (theType);
+    theString = CFStringCreateWithBytes(inAllocator,
+                                        reinterpret_cast<const UInt8 *>(inBytes),
+                                        static_cast<CFIndex>(inLength),
+                                        theEncoding,
+                                        false);
+
+ done:
+    return (theString);
 }
 
 /**
- *  This routine attempts to create a property list from the XML or
- *  binary property list data at the specified URL.
- *
- *  @param[in]      inURL         A CoreFoundation URL reference to the
- *                                URL to read the property list data
- *                                from.
- *  @param[in]      inMutability  Specifies the degree of mutability for
- *                                the returned property list.
- *  @param[in,out]  outPlist      A pointer to storage for the returned
- *                                property list object. On success,
- *                                this is a pointer to the property
- *                                list. The caller owns the reference
- *                                and is responsible for releasing the
- *                                object.
- *  @param[in,out]  outError      An optional pointer to storage for a
- *                                returned string indicating the
- *                                nature of the parsing error. On
- *                                failure, this is a reference to the
- *                                parsing error. The caller owns the
- *                                reference and is responsible for
- *                                releasing the object.
+ *  This routine attempts to determine whether two strings of the
+ *  same length match by directly comparing their contiguous backing
+ *  stores, where CoreFoundation exposes them in O(1) time.
+ *
+ *  Since a literal comparison (that is, @a CFStringCompare with no
+ *  options) is an exact comparison of UTF-16 code units, two stores
+ *  in the same representation match if and only if their bytes do.
+ *
+ *  @param[in]   inFirst   A CoreFoundation string reference to the
+ *                         first string.
+ *  @param[in]   inSecond  A CoreFoundation string reference to the
+ *                         second string.
+ *  @param[in]   inLength  The length, in UTF-16 code units, of both
+ *                         strings.
+ *  @param[out]  outMatch  On success, whether the strings match.
  *
  *  @returns
- *    True if OK; otherwise, false on error.
- *
- *  @ingroup plist
+ *    True if a match could be determined from the backing stores;
+ *    otherwise, false, if the caller must fall back to a full
+ *    comparison.
  *
  */
-Boolean
-CFUPropertyListReadFromURL(CFURLRef            inURL,
-                           CFOptionFlags       inMutability,
-                           CFPropertyListRef * outPlist,
-                           CFStringRef *       outError)
+static bool
+CFUStringsMatchBackingStores(CFStringRef inFirst,
+                             CFStringRef inSecond,
+                             CFIndex     inLength,
+                             bool &      outMatch)
 {
-    bool                 status    = false;
-    CFReadStreamRef      theStream = nullptr;
-    CFStreamStatus       streamStatus;
-    CFPropertyListFormat theFormat;
+    const size_t          theLength           = static_cast<size_t>(inLength);
+    const UniChar * const theFirstCharacters  = CFStringGetCharactersPtr(inFirst);
+    const UniChar * const theSecondCharacters = CFStringGetCharactersPtr(inSecond);
+    const UniChar *       theCharacters;
+    const char *          theBytes;
+    bool                  theRetval           = false;
+
+    if ((theFirstCharacters != nullptr) && (theSecondCharacters != nullptr))
+    {
+        // Both strings are stored as UTF-16.
 
-    __Require(inURL != nullptr, done);
-    __Require(outPlist != nullptr, done);
+        outMatch  = (memcmp(theFirstCharacters,
+                            theSecondCharacters,
+                            theLength * sizeof (UniChar)) == 0);
+        theRetval = true;
+    }
+    else if ((theFirstCharacters == nullptr) && (theSecondCharacters == nullptr))
+    {
+        // Both strings may be stored with eight bits per character,
+        // which are only comparable bytewise in the same encoding.
 
-    // Attempt to create a CoreFoundation read file stream from the
-    // resulting URL.
+        const CFStringEncoding theEncoding = CFStringGetFastestEncoding(inFirst);
+        const char *           theFirstBytes;
+        const char *           theSecondBytes;
 
-    theStream = CFReadStreamCreateWithFile(kCFAllocatorDefault, inURL);
-    __Require(theStream != nullptr, done);
+        __Require_Quiet(theEncoding == CFStringGetFastestEncoding(inSecond), done);
 
-    // Attempt to open the stream.
+        theFirstBytes  = CFStringGetCStringPtr(inFirst, theEncoding);
+        __Require_Quiet(theFirstBytes != nullptr, done);
 
-    status = CFReadStreamOpen(theStream);
-    __Require(status, done);
+        theSecondBytes = CFStringGetCStringPtr(inSecond, theEncoding);
+        __Require_Quiet(theSecondBytes != nullptr, done);
 
-    // Check the stream status.
+        outMatch  = (memcmp(theFirstBytes, theSecondBytes, theLength) == 0);
+        theRetval = true;
+    }
+    else
+    {
+        // One string is stored as UTF-16 and the other, perhaps, with
+        // eight bits per character. If the latter is ASCII, widen it
+        // as it is compared.
 
-    streamStatus = CFReadStreamGetStatus(theStream);
-    __Require_Action(streamStatus == kCFStreamStatusOpen, done, status = false);
+        if (theFirstCharacters != nullptr)
+        {
+            theCharacters = theFirstCharacters;
+            theBytes      = CFStringGetCStringPtr(inSecond, kCFStringEncodingASCII);
+        }
+        else
+        {
+            theCharacters = theSecondCharacters;
+            theBytes      = CFStringGetCStringPtr(inFirst, kCFStringEncodingASCII);
+        }
 
-    // Check that there are bytes available for reading.
+        __Require_Quiet(theBytes != nullptr, done);
 
-    status = CFReadStreamHasBytesAvailable(theStream);
-    __Require(status, done);
+        outMatch = true;
 
-#if HAVE_CFPROPERTYLISTCREATEWITHSTREAM
-    {
-        CFErrorRef theError = nullptr;
+        for (size_t i = 0; i < theLength; i++)
+        {
+            const unsigned char theByte = static_cast<unsigned char>(theBytes[i]);
 
-        *outPlist = CFPropertyListCreateWithStream(kCFAllocatorDefault,
-                                                   theStream,
-                                                   0,
-                                                   inMutability,
-                                                   &theFormat,
-                                                   &theError);
+            __Require_Quiet(theByte < 0x80, done);
 
-        if (theError != nullptr) {
-            if (outError != nullptr) {
-                *outError = CFErrorCopyDescription(theError);
+            if (theByte != theCharacters[i])
+            {
+                outMatch = false;
+                break;
             }
-
-            CFRelease(theError);
         }
 
-        __Require_Action(*outPlist != nullptr, done, status = false);
+        theRetval = true;
     }
-#elif HAVE_CFPROPERTYLISTCREATEFROMSTREAM
-    *outPlist = CFPropertyListCreateFromStream(kCFAllocatorDefault,
-                                               theStream,
-                                               0,
-                                               inMutability,
-                                               &theFormat,
-                                               outError);
-    __Require_Action(*outPlist != nullptr, done, status = false);
-#else // !HAVE_CFPROPERTYLISTCREATEWITHSTREAM || !HAVE_CFPROPERTYLISTCREATEFROMSTREAM
-#error "One of 'CFPropertyListCreateWithStream' or 'CFPropertyListCreateFromStream' must be available."
-#endif // HAVE_CFPROPERTYLISTCREATEWITHSTREAM
-
-    // At this point, all operations were successful. Set the return
-    // status accordingly.
-
-    status = true;
 
 done:
-    if (theStream != nullptr) {
-        CFReadStreamClose(theStream);
-    }
-
-    CFURelease(theStream);
-
-    return (status);
+    return (theRetval);
 }
 
 /**
- *  This routine attempts to write the property list data to a
- *  property list file in the specified format at the specified
- *  path.
+ *  This is a helper function to do a quick string comparison between
+ *  two CFStringRefs
  *
- *  @param[in]      inURL         A CoreFoundation URL reference to the
- *                                URL to write the property list data to.
- *  @param[in]      inFormat      Indicates the format of the property list
- *                                file.
- *  @param[in]      inPlist       The property list data to write.
- *  @param[in,out]  outError      An optional pointer to storage for a
- *                                returned string indicating the
- *                                nature of the parsing error. On
- *                                failure, this is a reference to the
- *                                parsing error. The caller owns the
- *                                reference and is responsible for
- *                                releasing the object.
+ *  The comparison is a literal one, as with @a CFStringCompare with
+ *  no options; however, identical references and strings of
+ *  differing lengths are resolved in O(1) time and strings whose
+ *  contiguous backing stores are available are compared directly,
+ *  with @a CFStringCompare used only as a last resort.
+ *
+ *  @param[in]  aFirst   A CoreFoundation string reference to the first string
+ *  @param[in]  aSecond  A CoreFoundation string reference to the second string
  *
  *  @returns
- *    True if OK; otherwise, false on error.
+ *    A Boolean, true if the strings match; otherwise false
  *
- *  @ingroup plist
+ *  @ingroup string
  *
  */
-Boolean
-CFUPropertyListWriteToURL(CFURLRef             inURL,
-                          CFPropertyListFormat inFormat,
-                          CFPropertyListRef    inPlist,
-                          CFStringRef *        outError)
+bool
+CFUStringsMatch(CFStringRef aFirst, CFStringRef aSecond)
 {
-    bool             status    = false;
-    CFWriteStreamRef theStream = nullptr;
-    CFStreamStatus   streamStatus;
-    CFIndex          theIndex;
+    CFComparisonResult comparison;
+    CFIndex            length;
+    bool               match = false;
 
-    __Require(inURL != nullptr, done);
-    __Require(inPlist != nullptr, done);
+    if ((aFirst != nullptr) && (aFirst == aSecond)) {
+        // Identical references, such as interned strings, trivially
+        // match.
 
-    // Attempt to create a CoreFoundation write file stream from the
-    // specified URL.
+        match = true;
+    } else if ((aFirst != nullptr) && (aSecond != nullptr)) {
+        // Strings of differing lengths, in UTF-16 code units, can
+        // never literally match.
 
-    theStream = CFWriteStreamCreateWithFile(kCFAllocatorDefault, inURL);
-    __Require(theStream != nullptr, done);
+        length = CFStringGetLength(aFirst);
 
-    // Attempt to open the stream.
+        if (length == CFStringGetLength(aSecond)) {
+            if (!CFUStringsMatchBackingStores(aFirst, aSecond, length, match)) {
+                comparison = CFStringCompare(aFirst, aSecond, 0);
 
-    status = CFWriteStreamOpen(theStream);
-    __Require(status, done);
+                match = (comparison == kCFCompareEqualTo);
+            }
+        }
+    }
 
-    // Check the stream status.
+    return match;
+}
 
-    streamStatus = CFWriteStreamGetStatus(theStream);
-    __Require_Action(streamStatus == kCFStreamStatusOpen, done, status = false);
+/**
+ *  This routine folds the specified run of ASCII or UTF-16 code units
+ *  into a 64-bit FNV-1a hash, one code unit at a time, such that a
+ *  string hashes the same regardless of its backing store.
+ *
+ *  @param[in]  inUnits   A pointer to the run of code units to hash.
+ *  @param[in]  inLength  The length, in code units, of @a inUnits.
+ *  @param[in]  inHash    The hash of any preceding code units.
+ *
+ *  @returns
+ *    The hash of the preceding and specified code units.
+ *
+ */
+template <typename Unit>
+static inline uint64_t
+CFUStringHashUnits(const Unit * inUnits, size_t inLength, uint64_t inHash)
+{
+    uint64_t theHash = inHash;
 
-#if HAVE_CFPROPERTYLISTWRITE
+    for (size_t i = 0; i < inLength; i++)
     {
-        CFErrorRef theError = nullptr;
+        theHash ^= static_cast<uint16_t>(inUnits[i]);
+        theHash *= 1099511628211ULL;
+    }
 
-        theIndex = CFPropertyListWrite(inPlist,
-                                       theStream,
-                                       inFormat,
-                                       0,
-                                       &theError);
+    return (theHash);
+}
 
-        if (theError != nullptr) {
-            if (outError != nullptr) {
-                *outError = CFErrorCopyDescription(theError);
-            }
+/**
+ *  This routine returns a hash of the UTF-16 code units of the
+ *  specified string, consistent with #CFUStringsMatch, such that
+ *  strings may be used as keys in hashed containers.
+ *
+ *  Strings whose contiguous backing stores are available in O(1)
+ *  time are hashed in place; otherwise, the characters are copied
+ *  out in fixed-size chunks, without allocation.
+ *
+ *  @param[in]  aString  A CoreFoundation string reference to the
+ *                       string to hash.
+ *
+ *  @returns
+ *    The 64-bit FNV-1a hash of the UTF-16 code units of the string
+ *    if it is non-null; otherwise, zero (0).
+ *
+ *  @ingroup string
+ *
+ */
+size_t
+CFUStringGetHash(CFStringRef aString)
+{
+    static const CFIndex kChunkLength = 64;
+    const UniChar *      theCharacters;
+    const char *         theBytes;
+    CFIndex              theLength;
+    uint64_t             theHash   = 14695981039346656037ULL;
+    size_t               theRetval = 0;
 
-            CFRelease(theError);
-        }
+    __Require(aString != nullptr, done);
 
-        __Require_Action(theIndex != 0, done, status = false);
+    theLength = CFStringGetLength(aString);
+
+    theCharacters = CFStringGetCharactersPtr(aString);
+
+    if (theCharacters != nullptr)
+    {
+        theHash = CFUStringHashUnits(theCharacters,
+                                     static_cast<size_t>(theLength),
+                                     theHash);
     }
-#elif HAVE_CFPROPERTYLISTWRITETOSTREAM
-    theIndex = CFPropertyListWriteToStream(inPlist,
-                                           theStream,
-                                           inFormat,
-                                           outError);
-    __Require_Action(theIndex != 0, done, status = false);
-#else // !HAVE_CFPROPERTYLISTWRITE || !HAVE_CFPROPERTYLISTWRITETOSTREAM
-#error "One of 'CFPropertyListWrite' or 'CFPropertyListWriteToStream' must be available."
-#endif // HAVE_CFPROPERTYLISTWRITE
+    else
+    {
+        // An eight-bit store whose bytes are ISO Latin-1, of which
+        // ASCII is a subset, has bytes equal to its UTF-16 code
+        // units and may be widened as it is hashed.
 
-    // At this point, all operations were successful. Set the return
-    // status accordingly.
+        theBytes = CFStringGetCStringPtr(aString, kCFStringEncodingISOLatin1);
 
-    status = true;
+        if (theBytes != nullptr)
+        {
+            theHash = CFUStringHashUnits(reinterpret_cast<const unsigned char *>(theBytes),
+                                         static_cast<size_t>(theLength),
+                                         theHash);
+        }
+        else
+        {
+            UniChar theChunk[kChunkLength];
 
-done:
-    if (theStream != nullptr) {
-        CFWriteStreamClose(theStream);
+            for (CFIndex theIndex = 0; theIndex < theLength; theIndex += kChunkLength)
+            {
+                const CFIndex theChunkLength = std::min(kChunkLength, theLength - theIndex);
+
+                CFStringGetCharacters(aString, CFRangeMake(theIndex, theChunkLength), theChunk);
+
+                theHash = CFUStringHashUnits(theChunk,
+                                             static_cast<size_t>(theChunkLength),
+                                             theHash);
+            }
+        }
     }
 
-    CFURelease(theStream);
+    theRetval = static_cast<size_t>(theHash);
 
-    return (status);
+ done:
+    return (theRetval);
+}
+
+/**
+ *  This routine folds the specified code unit to lower case if, and
+ *  only if, it is an upper case ASCII letter.
+ *
+ *  It is written without branches such that loops of it may be
+ *  vectorized by the compiler.
+ *
+ */
+static inline unsigned
+CFUStringFoldASCII(unsigned inUnit)
+{
+    return (inUnit + (static_cast<unsigned>((inUnit - 'A') < 26) << 5));
 }
 
 /**
- *  @brief
- *    Read a property list from a string representation of a file path.
+ *  This routine compares two runs of ASCII or UTF-16 code units of
+ *  the same length, optionally folding ASCII case.
  *
- *  This routine attempts to create a property list from the XML or
- *  binary property list data at the specified path.
+ *  Both loops accumulate rather than exit early such that the
+ *  compiler may vectorize them.
  *
- *  @param[in]      inPath        A CoreFoundation string reference to
- *                                the path to read the property list
- *                                data from.
- *  @param[in]      inMutability  Specifies the degree of mutability for
- *                                the returned property list.
- *  @param[in,out]  outPlist      A pointer to storage for the returned
- *                                property list object. On success,
- *                                this is a pointer to the property
- *                                list. The caller owns the reference
- *                                and is responsible for releasing the
- *                                object.
- *  @param[in,out]  outError      An optional pointer to storage for a
- *                                returned string indicating the
- *                                nature of the parsing error. On
- *                                failure, this is a reference to the
- *                                parsing error. The caller owns the
- *                                reference and is responsible for
- *                                releasing the object.
+ *  @param[in]   inFirst       A pointer to the first run of code
+ *                             units.
+ *  @param[in]   inSecond      A pointer to the second run of code
+ *                             units.
+ *  @param[in]   inLength      The length, in code units, of both
+ *                             runs.
+ *  @param[in]   inIgnoreCase  Whether ASCII case is to be ignored.
+ *  @param[out]  outMatch      On success, whether the runs match.
  *
  *  @returns
- *    True if OK; otherwise, false on error.
- *
- *  @ingroup plist
+ *    True if a match could be determined; otherwise, false, if case
+ *    is to be ignored and either run contains a non-ASCII code unit,
+ *    requiring full Unicode case folding.
  *
  */
-Boolean
-CFUPropertyListReadFromFile(CFStringRef         inPath,
-                            CFOptionFlags       inMutability,
-                            CFPropertyListRef * outPlist,
-                            CFStringRef *       outError)
+template <typename FirstType, typename SecondType>
+static bool
+CFUStringUnitsMatch(const FirstType *  inFirst,
+                    const SecondType * inSecond,
+                    size_t             inLength,
+                    bool               inIgnoreCase,
+                    bool &             outMatch)
 {
-    bool     kIsDirectory = true;
-    bool     status       = false;
-    CFURLRef theURL       = nullptr;
-
-    __Require(inPath != nullptr, done);
-    __Require(outPlist != nullptr, done);
+    unsigned theDifference = 0;
+    unsigned theUnion      = 0;
+    bool     theRetval     = false;
 
-    // Attempt to create a CoreFoundation URL for the specified file
-    // path.
+    if (inIgnoreCase)
+    {
+        for (size_t i = 0; i < inLength; i++)
+        {
+            const unsigned theFirst  = inFirst[i];
+            const unsigned theSecond = inSecond[i];
 
-    theURL = CFURLCreateWithFileSystemPath(kCFAllocatorDefault,
-                                           inPath,
-                                           kCFURLPOSIXPathStyle,
-                                           !kIsDirectory);
-    __Require(theURL != nullptr, done);
+            theUnion      |= (theFirst | theSecond);
+            theDifference |= (CFUStringFoldASCII(theFirst) ^
+                              CFUStringFoldASCII(theSecond));
+        }
 
-    // Attempt to read the property list from the URL.
+        __Require_Quiet(theUnion < 0x80, done);
+    }
+    else
+    {
+        for (size_t i = 0; i < inLength; i++)
+        {
+            theDifference |= (static_cast<unsigned>(inFirst[i]) ^
+                              static_cast<unsigned>(inSecond[i]));
+        }
+    }
 
-    status = CFUPropertyListReadFromURL(theURL,
-                                        inMutability,
-                                        outPlist,
-                                        outError);
-    __Require(status, done);
+    outMatch  = (theDifference == 0);
+    theRetval = true;
 
 done:
-    CFURelease(theURL);
-
-    return (status);
+    return (theRetval);
 }
 
 /**
- *  @brief
- *    Write a property list to a string representation of a file path.
- *
- *  This routine attempts to write the property list data to a
- *  property list file in the specified format at the specified
- *  path.
- *
- *  @param[in]      inPath        A CoreFoundation string reference to
- *                                the file to write the property list
- *                                data to.
- *  @param[in]      inFormat      Indicates the format of the property list
- *                                file.
- *  @param[in]      inPlist       The property list data to write.
- *  @param[in,out]  outError      An optional pointer to storage for a
- *                                returned string indicating the
- *                                nature of the parsing error. On
- *                                failure, this is a reference to the
- *                                parsing error. The caller owns the
- *                                reference and is responsible for
- *                                releasing the object.
+ *  This routine attempts to determine whether the specified range of
+ *  a string matches a pattern string by directly comparing their
+ *  contiguous ASCII or UTF-16 backing stores, where CoreFoundation
+ *  exposes them in O(1) time.
+ *
+ *  @param[in]   inString      A CoreFoundation string reference to
+ *                             the string to match against.
+ *  @param[in]   inOffset      The offset, in UTF-16 code units,
+ *                             into @a inString at which to match.
+ *  @param[in]   inPattern     A CoreFoundation string reference to
+ *                             the pattern to match.
+ *  @param[in]   inLength      The length, in UTF-16 code units, of
+ *                             @a inPattern.
+ *  @param[in]   inIgnoreCase  Whether case is to be ignored.
+ *  @param[out]  outMatch      On success, whether the range and
+ *                             pattern match.
  *
  *  @returns
- *    True if OK; otherwise, false on error.
- *
- *  @ingroup plist
+ *    True if a match could be determined from the backing stores;
+ *    otherwise, false, if the caller must fall back to a full
+ *    comparison.
  *
  */
-Boolean
-CFUPropertyListWriteToFile(CFStringRef          inPath,
-                           CFPropertyListFormat inFormat,
-                           CFPropertyListRef    inPlist,
-                           CFStringRef *        outError)
+static bool
+CFUStringRangeMatchesBackingStores(CFStringRef inString,
+                                   CFIndex     inOffset,
+                                   CFStringRef inPattern,
+                                   CFIndex     inLength,
+                                   bool        inIgnoreCase,
+                                   bool &      outMatch)
 {
-    bool     kIsDirectory = true;
-    bool     status       = false;
-    CFURLRef theURL       = nullptr;
-
-    __Require(inPath != nullptr, done);
-    __Require(inPlist != nullptr, done);
-
-    // Attempt to create a CoreFoundation URL for the specified file
-    // path.
-
-    theURL = CFURLCreateWithFileSystemPath(kCFAllocatorDefault,
-                                           inPath,
-                                           kCFURLPOSIXPathStyle,
-                                           !kIsDirectory);
-    __Require(theURL != nullptr, done);
+    const size_t    theOffset            = static_cast<size_t>(inOffset);
+    const size_t    theLength            = static_cast<size_t>(inLength);
+    const UniChar * theStringCharacters  = CFStringGetCharactersPtr(inString);
+    const UniChar * thePatternCharacters = CFStringGetCharactersPtr(inPattern);
+    const char *    theStringBytes       = nullptr;
+    const char *    thePatternBytes      = nullptr;
+    bool            theRetval            = false;
+
+    if (theStringCharacters == nullptr)
+    {
+        theStringBytes = CFStringGetCStringPtr(inString, kCFStringEncodingASCII);
+        __Require_Quiet(theStringBytes != nullptr, done);
+    }
 
-    // Attempt to write the property list to the URL.
+    if (thePatternCharacters == nullptr)
+    {
+        thePatternBytes = CFStringGetCStringPtr(inPattern, kCFStringEncodingASCII);
+        __Require_Quiet(thePatternBytes != nullptr, done);
+    }
 
-    status = CFUPropertyListWriteToURL(theURL, inFormat, inPlist, outError);
-    __Require(status, done);
+    if ((theStringBytes != nullptr) && (thePatternBytes != nullptr))
+    {
+        if (inIgnoreCase)
+        {
+            theRetval = CFUStringUnitsMatch(reinterpret_cast<const unsigned char *>(theStringBytes + theOffset),
+                                            reinterpret_cast<const unsigned char *>(thePatternBytes),
+                                            theLength,
+                                            inIgnoreCase,
+                                            outMatch);
+        }
+        else
+        {
+            outMatch  = (memcmp(theStringBytes + theOffset,
+                                thePatternBytes,
+                                theLength) == 0);
+            theRetval = true;
+        }
+    }
+    else if ((theStringCharacters != nullptr) && (thePatternCharacters != nullptr))
+    {
+        if (inIgnoreCase)
+        {
+            theRetval = CFUStringUnitsMatch(theStringCharacters + theOffset,
+                                            thePatternCharacters,
+                                            theLength,
+                                            inIgnoreCase,
+                                            outMatch);
+        }
+        else
+        {
+            outMatch  = (memcmp(theStringCharacters + theOffset,
+                                thePatternCharacters,
+                                theLength * sizeof (UniChar)) == 0);
+            theRetval = true;
+        }
+    }
+    else if (theStringCharacters != nullptr)
+    {
+        theRetval = CFUStringUnitsMatch(theStringCharacters + theOffset,
+                                        reinterpret_cast<const unsigned char *>(thePatternBytes),
+                                        theLength,
+                                        inIgnoreCase,
+                                        outMatch);
+    }
+    else
+    {
+        theRetval = CFUStringUnitsMatch(reinterpret_cast<const unsigned char *>(theStringBytes + theOffset),
+                                        thePatternCharacters,
+                                        theLength,
+                                        inIgnoreCase,
+                                        outMatch);
+    }
 
 done:
-    CFURelease(theURL);
-
-    return (status);
+    return (theRetval);
 }
 
 /**
- *  @brief
- *    Read a property list from a string representation of a file path.
+ *  This routine determines whether the specified string is known, in
+ *  O(1) time, to consist entirely of ASCII characters.
  *
- *  This routine attempts to create a property list from the XML or
- *  binary property list data at the specified path.
+ */
+static inline bool
+CFUStringIsKnownASCII(CFStringRef inString)
+{
+    return (CFStringGetCStringPtr(inString, kCFStringEncodingASCII) != nullptr);
+}
+
+/**
+ *  This routine determines whether the specified string has the
+ *  specified prefix or suffix.
  *
- *  @param[in]      inPath        A pointer to a C string containing the
- *                                path to read the property list data
- *                                from.
- *  @param[in]      inMutability  Specifies the degree of mutability for
- *                                the returned property list.
- *  @param[in,out]  outPlist      A pointer to storage for the returned
- *                                property list object. On success,
- *                                this is a pointer to the property
- *                                list. The caller owns the reference
- *                                and is responsible for releasing the
- *                                object.
- *  @param[in,out]  outError      An optional pointer to storage for a
- *                                returned string indicating the
- *                                nature of the parsing error. On
- *                                failure, this is a reference to the
- *                                parsing error. The caller owns the
- *                                reference and is responsible for
- *                                releasing the object.
+ *  @param[in]  inString      A CoreFoundation string reference to the
+ *                            string to match against.
+ *  @param[in]  inAffix       A CoreFoundation string reference to the
+ *                            prefix or suffix to match.
+ *  @param[in]  inIgnoreCase  Whether case is to be ignored.
+ *  @param[in]  inSuffix      Whether @a inAffix is a suffix, rather
+ *                            than a prefix.
  *
  *  @returns
- *    True if OK; otherwise, false on error.
- *
- *  @ingroup plist
+ *    True if the string has the prefix or suffix; otherwise, false.
  *
  */
-Boolean
-CFUPropertyListReadFromFile(const char *        inPath,
-                            CFOptionFlags       inMutability,
-                            CFPropertyListRef * outPlist,
-                            CFStringRef *       outError)
+static bool
+CFUStringHasAffix(CFStringRef inString,
+                  CFStringRef inAffix,
+                  bool        inIgnoreCase,
+                  bool        inSuffix)
 {
-    bool        status  = false;
-    CFStringRef thePath = nullptr;
+    CFIndex       theStringLength;
+    CFIndex       theAffixLength;
+    CFOptionFlags theOptions;
+    bool          theRetval = false;
 
-    __Require(inPath != nullptr, done);
-    __Require(outPlist != nullptr, done);
+    __Require_Quiet(inString != nullptr, done);
+    __Require_Quiet(inAffix != nullptr, done);
 
-    // Convert the provided path name to a CoreFoundation string.
+    theStringLength = CFStringGetLength(inString);
+    theAffixLength  = CFStringGetLength(inAffix);
 
-    thePath = CFStringCreateWithCString(kCFAllocatorDefault,
-                                        inPath,
-                                        CFStringGetSystemEncoding());
-    __Require(thePath != nullptr, done);
+    if (theAffixLength <= theStringLength)
+    {
+        const CFIndex theOffset = (inSuffix ? (theStringLength - theAffixLength) : 0);
+
+        if (CFUStringRangeMatchesBackingStores(inString,
+                                               theOffset,
+                                               inAffix,
+                                               theAffixLength,
+                                               inIgnoreCase,
+                                               theRetval))
+        {
+            goto done;
+        }
+    }
+    else
+    {
+        // A longer affix never literally matches. Ignoring case, it
+        // still never matches if both strings are ASCII since ASCII
+        // case folding preserves length.
 
-    // Attempt to read the property list from the file at the
-    // specified path.
+        __Require_Quiet(inIgnoreCase, done);
+        __Require_Quiet(!CFUStringIsKnownASCII(inString) ||
+                        !CFUStringIsKnownASCII(inAffix), done);
+    }
 
-    status = CFUPropertyListReadFromFile(thePath,
-                                         inMutability,
-                                         outPlist,
-                                         outError);
-    __Require(status, done);
+    theOptions = (kCFCompareAnchored                             |
+                  (inIgnoreCase ? kCFCompareCaseInsensitive : 0) |
+                  (inSuffix     ? kCFCompareBackwards       : 0));
 
-done:
-    CFURelease(thePath);
+    theRetval = CFStringFindWithOptions(inString,
+                                        inAffix,
+                                        CFRangeMake(0, theStringLength),
+                                        theOptions,
+                                        nullptr);
 
-    return (status);
+done:
+    return (theRetval);
 }
 
 /**
- *  @brief
- *    Write a property list to a string representation of a file path.
+ *  This routine compares two strings, ignoring case.
  *
- *  This routine attempts to write the property list data to a
- *  property list file in the specified format at the specified path.
+ *  Where both strings are backed by contiguous ASCII or UTF-16
+ *  storage and contain only ASCII characters, they are compared
+ *  directly, folding ASCII case; otherwise, full Unicode case
+ *  folding, as with @a CFStringCompareWithOptions and @a
+ *  kCFCompareCaseInsensitive, is used.
  *
- *  @param[in]      inPath        A pointer to a C string containing the
- *                                path to write the property list data
- *                                to.
- *  @param[in]      inWritable    Indicates whether the resulting file
- *                                should be writable.
- *  @param[in]      inFormat      Indicates the format of the property list
- *                                file.
- *  @param[in]      inPlist       The property list data to write.
- *  @param[in,out]  outError      An optional pointer to storage for a
- *                                returned string indicating the
- *                                nature of the parsing error. On
- *                                failure, this is a reference to the
- *                                parsing error. The caller owns the
- *                                reference and is responsible for
- *                                releasing the object.
+ *  @param[in]  aFirst   A CoreFoundation string reference to the
+ *                       first string.
+ *  @param[in]  aSecond  A CoreFoundation string reference to the
+ *                       second string.
  *
  *  @returns
- *    True if OK; otherwise, false on error.
+ *    True if the strings match, ignoring case; otherwise, false.
  *
- *  @ingroup plist
+ *  @ingroup string
  *
  */
-Boolean
-CFUPropertyListWriteToFile(const char *         inPath,
-                           bool                 inWritable,
-                           CFPropertyListFormat inFormat,
-                           CFPropertyListRef    inPlist,
-                           CFStringRef *        outError)
+bool
+CFUStringsMatchIgnoringCase(CFStringRef aFirst, CFStringRef aSecond)
 {
-    int          error;
-    CFStringRef  thePath     = nullptr;
-    const mode_t kReadAll    = (S_IRUSR | S_IRGRP | S_IROTH);
-    const mode_t kWriteAll   = (S_IWUSR | S_IWGRP | S_IWOTH);
-    const mode_t permissions = inWritable ? (kReadAll | kWriteAll) : kReadAll;
-    bool         status      = false;
-
-    __Require(inPath != nullptr, done);
-    __Require(inPlist != nullptr, done);
+    CFIndex            theFirstLength;
+    CFIndex            theSecondLength;
+    CFComparisonResult theComparison;
+    bool               theRetval = false;
 
-    // Convert the provided path name to a CoreFoundation string.
-
-    thePath = CFStringCreateWithCString(kCFAllocatorDefault,
-                                        inPath,
-                                        CFStringGetSystemEncoding());
-    __Require(thePath != nullptr, done);
+    __Require_Quiet(aFirst != nullptr, done);
+    __Require_Quiet(aSecond != nullptr, done);
 
-    // Attempt to write the property list to the file at the specified
-    // path.
+    if (aFirst == aSecond)
+    {
+        theRetval = true;
+        goto done;
+    }
 
-    status = CFUPropertyListWriteToFile(thePath, inFormat, inPlist, outError);
-    __Require(status, done);
+    theFirstLength  = CFStringGetLength(aFirst);
+    theSecondLength = CFStringGetLength(aSecond);
 
-    // Update the permissions according to the writability flag specified.
+    if (theFirstLength == theSecondLength)
+    {
+        if (CFUStringRangeMatchesBackingStores(aFirst,
+                                               0,
+                                               aSecond,
+                                               theSecondLength,
+                                               true,
+                                               theRetval))
+        {
+            goto done;
+        }
+    }
+    else
+    {
+        // Full Unicode case folding may change length (for example,
+        // U+00DF folds to "ss"), but ASCII case folding never does.
 
-    error = chmod(inPath, permissions);
-    __Require_Action(error == 0, done, status = false);
+        __Require_Quiet(!CFUStringIsKnownASCII(aFirst) ||
+                        !CFUStringIsKnownASCII(aSecond), done);
+    }
 
-    // At this point, all operations were successful. Set the return
-    // status accordingly.
+    theComparison = CFStringCompareWithOptions(aFirst,
+                                               aSecond,
+                                               CFRangeMake(0, theFirstLength),
+                                               kCFCompareCaseInsensitive);
 
-    status = true;
+    theRetval = (theComparison == kCFCompareEqualTo);
 
 done:
-    CFURelease(thePath);
-
-    return (status);
+    return (theRetval);
 }
 
 /**
- *  This routine determines whether the specified CoreFoundation set
- *  is an empty set.
+ *  This routine determines whether a string begins with the
+ *  specified prefix.
  *
- *  @param[in]  inSet  The reference to the set to check for an empty set.
+ *  Where both strings are backed by contiguous ASCII or UTF-16
+ *  storage, they are compared directly, folding ASCII case if
+ *  requested; otherwise, or if case is to be ignored and a non-ASCII
+ *  character is seen, the comparison falls back to @a
+ *  CFStringFindWithOptions.
+ *
+ *  @param[in]  aString      A CoreFoundation string reference to the
+ *                           string to match against.
+ *  @param[in]  aPrefix      A CoreFoundation string reference to the
+ *                           prefix to match.
+ *  @param[in]  aIgnoreCase  Whether case is to be ignored.
  *
  *  @returns
- *    True if the set is the empty set or the specified reference is
- *    null; otherwise, false.
+ *    True if @a aString begins with @a aPrefix; otherwise, false.
  *
- *  @ingroup set
+ *  @ingroup string
  *
  */
 bool
-CFUSetIsEmptySet(CFSetRef inSet)
+CFUStringHasPrefix(CFStringRef aString, CFStringRef aPrefix, bool aIgnoreCase)
 {
-    return ((inSet == nullptr) ? true : (CFSetGetCount(inSet) == 0));
+    return (CFUStringHasAffix(aString, aPrefix, aIgnoreCase, false));
 }
 
 /**
- *  This routine performs the real work of the CFUSetIntersectionSet
- *  function by serving as the iterator call back for the destination
- *  set.
+ *  This routine determines whether a string ends with the specified
+ *  suffix.
  *
- *  If the object of the destination set does not exist in the souce
- *  set, it is removed from the source set.
+ *  Where both strings are backed by contiguous ASCII or UTF-16
+ *  storage, they are compared directly, folding ASCII case if
+ *  requested; otherwise, or if case is to be ignored and a non-ASCII
+ *  character is seen, the comparison falls back to @a
+ *  CFStringFindWithOptions.
  *
- *  @param[in]  inValue    A pointer to the object being iterated from
- *                         the destination set.
- *  @param[in]  inContext  A pointer to the call back context.
+ *  @param[in]  aString      A CoreFoundation string reference to the
+ *                           string to match against.
+ *  @param[in]  aSuffix      A CoreFoundation string reference to the
+ *                           suffix to match.
+ *  @param[in]  aIgnoreCase  Whether case is to be ignored.
+ *
+ *  @returns
+ *    True if @a aString ends with @a aSuffix; otherwise, false.
+ *
+ *  @ingroup string
  *
  */
-static void
-CFUSetIntersectionApplier(const void * inValue, void * inContext)
+bool
+CFUStringHasSuffix(CFStringRef aString, CFStringRef aSuffix, bool aIgnoreCase)
 {
-    CFUSetContext * theContext = static_cast<CFUSetContext *>(inContext);
-
-    if (!CFSetContainsValue(theContext->mSourceSet, inValue)) {
-        CFSetRemoveValue(theContext->mDestinationSet, inValue);
-    }
+    return (CFUStringHasAffix(aString, aSuffix, aIgnoreCase, true));
 }
 
 /**
- *  @brief
- *    Create the intersection between two CoreFoundation sets.
- *
- *  This routine removes from one set each object not contained in a
- *  second set resulting in the first set forming the intersection
- *  of the two sets.
+ *  This routine reads more bytes from the descriptor underlying the
+ *  specified line reader into its buffer, first compacting
+ *  unconsumed bytes to the front of the buffer and, if it is full,
+ *  growing it.
  *
- *  @param[in,out]  inDestinationSet  The mutable set that serves as
- *                                    the destination of the
- *                                    intersection and whose values
- *                                    are checked against the source
- *                                    set. On success, this contains
- *                                    the intersection of the
- *                                    destination and source sets.
- *  @param[in]      inSourceSet       The immutable set that serves as
- *                                    the source of the intersection.
- *
- *  @sa CFUSetUnionSet
+ *  @param[in,out]  inReader  A reference to the reader to fill.
  *
- *  @ingroup set
+ *  On error, the error is recorded in the reader. If the descriptor
+ *  is non-blocking and no data is available yet, EAGAIN or
+ *  EWOULDBLOCK is recorded, which, unlike other errors, does not end
+ *  reading.
  *
  */
-void
-CFUSetIntersectionSet(CFMutableSetRef inDestinationSet, CFSetRef inSourceSet)
+static void
+CFUStringLineReaderFill(CFUStringLineReaderRef inReader)
 {
-    CFUSetContext theContext = { inDestinationSet, inSourceSet };
+    vector<UInt8> & theBuffer = inReader->mBuffer;
+    ssize_t         theRead;
 
-    if (inDestinationSet != nullptr && inSourceSet != nullptr) {
-        CFSetApplyFunction(inDestinationSet,
-                           CFUSetIntersectionApplier,
-                           &theContext);
+    if (inReader->mStart > 0)
+    {
+        memmove(&theBuffer[0],
+                &theBuffer[inReader->mStart],
+                inReader->mEnd - inReader->mStart);
+
+        inReader->mScan  -= inReader->mStart;
+        inReader->mEnd   -= inReader->mStart;
+        inReader->mStart  = 0;
+    }
+
+    if (inReader->mEnd == theBuffer.size())
+    {
+        theBuffer.resize(theBuffer.size() * 2);
     }
 
+    do {
+        theRead = read(inReader->mDescriptor,
+                       &theBuffer[inReader->mEnd],
+                       theBuffer.size() - inReader->mEnd);
+    } while ((theRead < 0) && (errno == EINTR));
+
+    __Require_Action_Quiet(theRead >= 0, done, inReader->mError = errno);
+
+    inReader->mEnd   += static_cast<size_t>(theRead);
+    inReader->mAtEnd  = (theRead == 0);
+
+ done:
     return;
 }
 
 /**
- *  This routine performs the real work of the CFUSetUnionSet
- *  function by serving as the iterator call back for the source
- *  set.
+ *  @brief
+ *    Create a line reader for a file descriptor.
+ *
+ *  This routine creates a buffered reader that splits the data read
+ *  from the specified descriptor into lines terminated by a line
+ *  feed or a carriage return and line feed pair. Each line is
+ *  returned without its terminator, such that no subsequent chomp
+ *  is needed. The descriptor is not closed when the reader is
+ *  destroyed.
+ *
+ *  @param[in]  inDescriptor  The file descriptor to read lines from,
+ *                            which may be a pipe or socket as well
+ *                            as a regular file.
+ *  @param[in]  inBufferSize  The initial size, in bytes, of the read
+ *                            buffer, which grows as needed to hold
+ *                            the longest line. If zero (0), a default
+ *                            size is used.
  *
- *  If the object of the source set does not exist in the destination
- *  set, it is added.
+ *  @returns
+ *    A reference to the reader if OK; otherwise, null on error. The
+ *    caller owns the reader and is responsible for destroying it with
+ *    #CFUStringLineReaderDestroy.
  *
- *  @param[in]  inValue    A pointer to the object being iterated from
- *                         the destination set.
- *  @param[in]  inContext  A pointer to the call back context.
+ *  @ingroup string
  *
  */
-static void
-CFUSetUnionApplier(const void * inValue, void * inContext)
+CFUStringLineReaderRef
+CFUStringLineReaderCreateWithFD(int inDescriptor, size_t inBufferSize)
 {
-    CFUSetContext * theContext = static_cast<CFUSetContext *>(inContext);
+    const size_t           theBufferSize = ((inBufferSize == 0) ? kCFUStringLineReaderDefaultBufferSize : inBufferSize);
+    CFUStringLineReaderRef theReader     = nullptr;
 
-    CFSetAddValue(theContext->mDestinationSet, inValue);
+    __Require(inDescriptor >= 0, done);
+
+    theReader = new (std::nothrow) __CFUStringLineReader();
+    __Require(theReader != nullptr, done);
+
+    theReader->mDescriptor     = inDescriptor;
+    theReader->mOwnsDescriptor = false;
+    theReader->mAtEnd          = false;
+    theReader->mError          = 0;
+    theReader->mStart          = 0;
+    theReader->mScan           = 0;
+    theReader->mEnd            = 0;
+
+    theReader->mBuffer.resize(theBufferSize);
+
+ done:
+    return (theReader);
 }
 
 /**
  *  @brief
- *    Create the union between two CoreFoundation sets.
+ *    Create a line reader for a file.
  *
- *  This routine adds to one set each object contained in a second
- *  set not already present in the first set resulting in the first
- *  set forming the union of the two sets.
+ *  This routine opens the file at the specified path and creates a
+ *  buffered reader that splits its contents into lines, as with
+ *  #CFUStringLineReaderCreateWithFD. The file is closed when the
+ *  reader is destroyed.
  *
- *  @param[in,out]  inDestinationSet  The mutable set that serves as the
- *                                    destination of the union. On
- *                                    success, this contains the
- *                                    union of the destination and
- *                                    source sets.
- *  @param[in]      inSourceSet       The immutable set that serves as
- *                                    the source of the union and
- *                                    whose values are checked against
+ *  @param[in]  inPath        A pointer to a C string containing the
+ *                            path of the file to read lines from.
+ *  @param[in]  inBufferSize  The initial size, in bytes, of the read
+ *                            buffer. If zero (0), a default size is
+ *                            used.
  *
- *  @sa CFUSetIntersectionSet
+ *  @returns
+ *    A reference to the reader if OK; otherwise, null on error. The
+ *    caller owns the reader and is responsible for destroying it with
+ *    #CFUStringLineReaderDestroy.
  *
- *  @ingroup set
+ *  @ingroup string
  *
  */
-void
-CFUSetUnionSet(CFMutableSetRef inDestinationSet, CFSetRef inSourceSet)
+CFUStringLineReaderRef
+CFUStringLineReaderCreateWithFile(const char * inPath, size_t inBufferSize)
 {
-    CFUSetContext theContext = { inDestinationSet, inSourceSet };
+    int                    theDescriptor = -1;
+    CFUStringLineReaderRef theReader     = nullptr;
 
-    if (inDestinationSet != nullptr && inSourceSet != nullptr) {
-        CFSetApplyFunction(inSourceSet, CFUSetUnionApplier, &theContext);
+    __Require(inPath != nullptr, done);
+
+    theDescriptor = open(inPath, O_RDONLY | O_CLOEXEC);
+    __Require(theDescriptor >= 0, done);
+
+    theReader = CFUStringLineReaderCreateWithFD(theDescriptor, inBufferSize);
+    __Require(theReader != nullptr, done);
+
+    theReader->mOwnsDescriptor = true;
+
+ done:
+    if ((theReader == nullptr) && (theDescriptor >= 0)) {
+        close(theDescriptor);
     }
 
-    return;
+    return (theReader);
 }
 
 /**
- *  This routine initializes the specified CoreFoundation tree
- *  context to required values prior to first use with other
- *  CoreFoundation tree interfaces.
+ *  @brief
+ *    Destroy a line reader.
  *
- *  @param[in,out]  inContext  A pointer to the CoreFoundation tree
- *                             context to initialize. On success, a
- *                             pointer to the initialized
- *                             CoreFoundation tree context.
+ *  This routine releases all resources associated with the specified
+ *  line reader, closing its descriptor if the reader opened it.
+ *
+ *  @param[in]  inReader  A reference to the reader to destroy. A null
+ *                        reference results in no action being taken.
+ *
+ *  @ingroup string
  *
- *  @ingroup tree
  */
 void
-CFUTreeContextInit(CFTreeContext * inContext)
+CFUStringLineReaderDestroy(CFUStringLineReaderRef inReader)
 {
-    if (inContext != nullptr) {
-        *inContext = kCFUTreeContextInitializer;
+    __Require_Quiet(inReader != nullptr, done);
+
+    if (inReader->mOwnsDescriptor) {
+        close(inReader->mDescriptor);
     }
+
+    delete inReader;
+
+ done:
+    return;
 }
 
 /**
- *  This routine creates a new mutable CoreFoundation tree and
- *  associates with it the specified CoreFoundation object.
- *
- *  @param[in,out]  inType  A CoreFoundation base reference to the
- *                          object to be associated with the tree. On
- *                          success, a CoreFoundation base reference
- *                          to the object to be associated with the
- *                          tree with its reference count increased
- *                          by one.
+ *  @brief
+ *    Read the next line as borrowed bytes.
+ *
+ *  This routine returns the next line from the specified reader,
+ *  without its line feed or carriage return and line feed
+ *  terminator, as a slice of the reader's buffer. No bytes are
+ *  copied and the line is located with a single @a memchr over bytes
+ *  not previously searched. A final line without a terminator is
+ *  returned as is.
+ *
+ *  @param[in]   inReader   A reference to the reader to read from.
+ *  @param[out]  outBytes   A pointer to storage for a pointer to the
+ *                          bytes of the line. The bytes are borrowed
+ *                          and remain valid only until the next read
+ *                          from, or destruction of, the reader.
+ *  @param[out]  outLength  A pointer to storage for the length, in
+ *                          bytes, of the line.
  *
  *  @returns
- *    A reference to the newly-created tree if OK; otherwise, null on
- *    error.
+ *    True if a line was read; otherwise, false at end-of-file or on
+ *    error, which may be distinguished with
+ *    #CFUStringLineReaderGetError. If the descriptor is non-blocking
+ *    and a complete line is not yet available, the error is EAGAIN
+ *    or EWOULDBLOCK; any partial line is retained and a later read
+ *    may succeed.
  *
- *  @ingroup tree
+ *  @ingroup string
  *
  */
-CFTreeRef
-CFUTreeCreate(CFTypeRef inType)
+bool
+CFUStringLineReaderReadBytes(CFUStringLineReaderRef inReader,
+                             const UInt8 **         outBytes,
+                             size_t *               outLength)
 {
-    CFTreeRef     tempTree = nullptr;
-    CFTreeContext theContext;
+    const UInt8 * theBytes;
+    const UInt8 * theLineFeed;
+    size_t        theLength;
+    bool          theRetval = false;
+
+    __Require(inReader != nullptr, done);
+    __Require(outBytes != nullptr, done);
+    __Require(outLength != nullptr, done);
+
+    // Neither an invalid line reported by
+    // CFUStringLineReaderCopyLine nor a non-blocking descriptor with
+    // no data yet ends reading.
+
+    if ((inReader->mError == EILSEQ) ||
+        (inReader->mError == EAGAIN) ||
+        (inReader->mError == EWOULDBLOCK))
+    {
+        inReader->mError = 0;
+    }
 
-    CFUTreeContextInit(&theContext);
+    while (true)
+    {
+        theBytes    = &inReader->mBuffer[0];
+        theLineFeed = static_cast<const UInt8 *>(memchr(theBytes + inReader->mScan,
+                                                        '\n',
+                                                        inReader->mEnd - inReader->mScan));
 
-    theContext.info            = const_cast<void *>(inType);
-    theContext.retain          = CFRetain;
-    theContext.release         = CFRelease;
-    theContext.copyDescription = CFCopyDescription;
+        if (theLineFeed != nullptr)
+        {
+            theLength = static_cast<size_t>(theLineFeed - theBytes) - inReader->mStart;
 
-    tempTree = CFTreeCreate(kCFAllocatorDefault, &theContext);
-    __Require(tempTree != nullptr, done);
+            if ((theLength > 0) && (theBytes[inReader->mStart + theLength - 1] == '\r'))
+            {
+                theLength--;
+            }
 
-done:
-    return (tempTree);
+            *outBytes  = theBytes + inReader->mStart;
+            *outLength = theLength;
+
+            inReader->mStart = inReader->mScan = static_cast<size_t>(theLineFeed - theBytes) + 1;
+
+            theRetval = true;
+            break;
+        }
+
+        inReader->mScan = inReader->mEnd;
+
+        __Require_Quiet(inReader->mError == 0, done);
+
+        if (inReader->mAtEnd)
+        {
+            // Return any final, unterminated line.
+
+            __Require_Quiet(inReader->mStart < inReader->mEnd, done);
+
+            *outBytes  = theBytes + inReader->mStart;
+            *outLength = inReader->mEnd - inReader->mStart;
+
+            inReader->mStart = inReader->mEnd;
+
+            theRetval = true;
+            break;
+        }
+
+        CFUStringLineReaderFill(inReader);
+    }
+
+ done:
+    return (theRetval);
 }
 
 /**
  *  @brief
- *    Remove a trailing newline, if present, from the specified
- *    string.
+ *    Read the next line as a string.
  *
- *  This attempts to remove, if present, a trailing newline from the
- *  specified string.
+ *  This routine returns the next line from the specified reader,
+ *  without its terminator, as a newly-created string. The bytes are
+ *  converted directly from the reader's buffer with no intervening
+ *  search and replace.
  *
- *  @param[in,out]  inOutString  A CoreFoundation mutable string
- *                               reference from which to try to remove
- *                               a trailing newline.
- *  @param[in,out]  inOutLength  The length of @a inOutString, in
- *                               characters, before and, if
- *                               successful, after removal of any
- *                               trailing newline. On success, the
- *                               output value is expected to be one
- *                               less than its input value.
+ *  @param[in]   inReader    A reference to the reader to read from.
+ *  @param[in]   inEncoding  The encoding of the bytes read.
+ *  @param[out]  outLine     A pointer to storage for the line. On
+ *                           success, the caller owns the reference
+ *                           and is responsible for releasing the
+ *                           object.
  *
  *  @returns
- *    True if a trailing newline was found and removed; otherwise,
- *    false.
+ *    True if a line was read; otherwise, false at end-of-file or on
+ *    error, which may be distinguished with
+ *    #CFUStringLineReaderGetError. A line that is invalid in @a
+ *    inEncoding is an error, EILSEQ, though it is consumed and
+ *    reading may continue.
+ *
+ *  @sa CFUStringLineReaderCopyLineWithAllocator
+ *
+ *  @ingroup string
  *
  */
 bool
-CFUStringChomp(CFMutableStringRef inOutString, size_t &inOutLength)
+CFUStringLineReaderCopyLine(CFUStringLineReaderRef inReader,
+                            CFStringEncoding       inEncoding,
+                            CFStringRef *          outLine)
 {
-    CFIndex  lReplacedInstances;
-    bool     lRetval = false;
-
-    __Require(inOutString != nullptr, done);
-
-    lReplacedInstances = CFStringFindAndReplace(inOutString,
-                                                CFSTR("\n"),
-                                                CFSTR(""),
-                                                CFRangeMake(static_cast<CFIndex>(inOutLength - 1),
-                                                            static_cast<CFIndex>(inOutLength)),
-                                                kCFCompareBackwards);
-
-    if (lReplacedInstances == 1)
-    {
-        inOutLength--;
-
-        lRetval = true;
-    }
-
- done:
-    return (lRetval);
+    return (CFUStringLineReaderCopyLineWithAllocator(kCFAllocatorDefault,
+                                                     inReader,
+                                                     inEncoding,
+                                                     outLine));
 }
 
 /**
  *  @brief
- *    Remove a trailing newline, if present, from the specified
- *    string.
- *
- *  This attempts to remove, if present, a trailing newline from the
- *  specified string.
- *
- *  @param[in,out]  inOutString  A CoreFoundation mutable string
- *                               reference from which to try to remove
- *                               a trailing newline.
+ *    Read the next line as a string created with an allocator.
+ *
+ *  This routine returns the next line from the specified reader,
+ *  without its terminator, as a string newly created with the
+ *  specified allocator. The bytes are converted directly from the
+ *  reader's buffer with no intervening search and replace.
+ *
+ *  @param[in]   inAllocator  The allocator to use to allocate
+ *                            memory for the string.
+ *  @param[in]   inReader     A reference to the reader to read from.
+ *  @param[in]   inEncoding   The encoding of the bytes read.
+ *  @param[out]  outLine      A pointer to storage for the line. On
+ *                            success, the caller owns the reference
+ *                            and is responsible for releasing the
+ *                            object.
  *
  *  @returns
- *    True if a trailing newline was found and removed; otherwise,
- *    false.
+ *    True if a line was read; otherwise, false at end-of-file or on
+ *    error, which may be distinguished with
+ *    #CFUStringLineReaderGetError. A line that is invalid in @a
+ *    inEncoding is an error, EILSEQ, though it is consumed and
+ *    reading may continue.
+ *
+ *  @ingroup string
  *
  */
 bool
-CFUStringChomp(CFMutableStringRef inOutString)
+CFUStringLineReaderCopyLineWithAllocator(CFAllocatorRef         inAllocator,
+                                         CFUStringLineReaderRef inReader,
+                                         CFStringEncoding       inEncoding,
+                                         CFStringRef *          outLine)
 {
-    size_t  lLength;
-    bool    lRetval = false;
+    const UInt8 * theBytes;
+    size_t        theLength;
+    bool          theRetval = false;
 
-    __Require(inOutString != nullptr, done);
+    __Require(outLine != nullptr, done);
 
-    lLength = static_cast<size_t>(CFStringGetLength(inOutString));
+    theRetval = CFUStringLineReaderReadBytes(inReader, &theBytes, &theLength);
+    __Require_Quiet(theRetval, done);
 
-    lRetval = CFUStringChomp(inOutString, lLength);
+    *outLine = CFStringCreateWithBytes(inAllocator,
+                                       theBytes,
+                                       static_cast<CFIndex>(theLength),
+                                       inEncoding,
+                                       false);
+
+    if (*outLine == nullptr)
+    {
+        inReader->mError = EILSEQ;
+    }
+    __Require_Action(*outLine != nullptr, done, theRetval = false);
 
  done:
-    return (lRetval);
+    return (theRetval);
 }
 
 /**
- *  This is a helper function to do a quick string comparison between
- *  two CFStringRefs
+ *  This routine returns the error, if any, that caused the most
+ *  recent read from the specified line reader to fail.
  *
- *  @param[in]  aFirst   A CoreFoundation string reference to the first string
- *  @param[in]  aSecond  A CoreFoundation string reference to the second string
+ *  @param[in]  inReader  A reference to the reader for which to
+ *                        return the error.
  *
  *  @returns
- *    A Boolean, true if the strings match; otherwise false
+ *    Zero (0) if no error has occurred, such as when reading ended
+ *    at end-of-file; otherwise, the @a errno value of the error, or
+ *    EINVAL for a null reader.
  *
  *  @ingroup string
  *
  */
-bool
-CFUStringsMatch(CFStringRef aFirst, CFStringRef aSecond)
+int
+CFUStringLineReaderGetError(CFUStringLineReaderRef inReader)
 {
-    CFComparisonResult comparison;
-    bool               match = false;
-
-    if ((aFirst != nullptr) && (aSecond != nullptr)) {
-        comparison = CFStringCompare(aFirst, aSecond, 0);
-
-        match = (comparison == kCFCompareEqualTo);
-    }
-
-    return match;
+    return ((inReader == nullptr) ? EINVAL : inReader->mError);
 }
@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a minimal harness for the CFUtilities
+ *      benchmarks, which are built but not run by the 'check'
+ *      target.
+ */
+
+#ifndef CFUTILITIES_TESTS_BENCHMARK_HPP
+#define CFUTILITIES_TESTS_BENCHMARK_HPP
+
+#include <chrono>
+#include <vector>
+
+#include <stddef.h>
+
+/**
+ *  A benchmark case, which reports one or more measurements, each
+ *  timing some number of operations.
+ *
+ *  Cases register themselves, much as CppUnit test suites do, with a
+ *  file-scope Benchmark::Registration object.
+ *
+ */
+class Benchmark
+{
+public:
+    typedef void (*Function)(Benchmark & inBenchmark);
+
+    class Registration
+    {
+    public:
+        Registration(const char * inName, Function inFunction);
+    };
+
+    /**
+     *  Time the specified operation, which itself performs the
+     *  specified number of operations, and report the time, and any
+     *  allocations made through an accounting allocator, per
+     *  operation under the specified label.
+     *
+     */
+    template <typename Operation>
+    void Measure(const char * inLabel, size_t inOperations, Operation inOperation)
+    {
+        Start();
+
+        inOperation();
+
+        Stop(inLabel, inOperations);
+    }
+
+    static int Run(const char * inFilter);
+
+private:
+    struct Case
+    {
+        const char * mName;
+        Function     mFunction;
+    };
+
+    explicit Benchmark(const char * inName);
+
+    void Start(void);
+    void Stop(const char * inLabel, size_t inOperations);
+
+    static std::vector<Case> & GetCases(void);
+
+    const char *                          mName;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+#endif // CFUTILITIES_TESTS_BENCHMARK_HPP
@@ -0,0 +1,197 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks for the CFString wrapper.
+ */
+
+#include <CFUtilities/CFString.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+
+#include "Benchmark.hpp"
+
+
+/*
+ * A non-ASCII string is used so that CoreFoundation is unlikely to
+ * have an O(1) representation for it and the encoding buffer cache
+ * is exercised.
+ */
+static const UInt8  kUTF8Bytes[]     = { 'T', 'e', 's', 't',
+                                         's', 't', 'r',
+                                         0xc3, 0xa4,
+                                         'n', 'g' };
+static const size_t kMaximumThreads  = 8;
+static const size_t kReadsPerThread  = 1000000;
+static const size_t kCopiesPerThread = 100000;
+
+static void
+SharedReader(const CFString * inString, size_t inReads)
+{
+    for (size_t i = 0; i < inReads; i++)
+    {
+        inString->GetCString(kCFStringEncodingISOLatin1);
+    }
+}
+
+static void
+CopyingReader(const CFString * inString, size_t inReads)
+{
+    // The pre-existing workaround: a private copy of the wrapper per
+    // use, which retains and releases and re-encodes every time.
+
+    for (size_t i = 0; i < inReads; i++)
+    {
+        const CFString lCopy(*inString);
+
+        lCopy.GetCString(kCFStringEncodingISOLatin1);
+    }
+}
+
+template <typename Reader>
+static void
+MeasureReaders(Benchmark &      inBenchmark,
+               const char *     inName,
+               const CFString & inString,
+               size_t           inReads,
+               Reader           inReader)
+{
+    char lLabel[64];
+
+    // Times are wall-clock time over the reads of all threads
+    // combined, so readers that scale perfectly halve the time per
+    // read each time the thread count doubles.
+
+    for (size_t lThreads = 1; lThreads <= kMaximumThreads; lThreads *= 2)
+    {
+        snprintf(lLabel, sizeof (lLabel), "%s, %zu threads", inName, lThreads);
+
+        inBenchmark.Measure(lLabel, inReads * lThreads, [&]() {
+            std::vector<std::thread> lWorkers;
+
+            for (size_t i = 0; i < lThreads; i++)
+            {
+                lWorkers.push_back(std::thread(inReader, &inString, inReads));
+            }
+
+            for (size_t i = 0; i < lThreads; i++)
+            {
+                lWorkers[i].join();
+            }
+        });
+    }
+}
+
+static void
+BenchmarkConcurrentGetCString(Benchmark & inBenchmark)
+{
+    const bool  kIsExternalRepresentation = true;
+    CFStringRef lCFString;
+
+    lCFString = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                        &kUTF8Bytes[0],
+                                        sizeof (kUTF8Bytes),
+                                        kCFStringEncodingUTF8,
+                                        !kIsExternalRepresentation);
+
+    {
+        const CFString lString(lCFString);
+
+        // Populate the cache such that the shared readers measure the
+        // steady-state, published lookup.
+
+        lString.GetCString(kCFStringEncodingISOLatin1);
+
+        MeasureReaders(inBenchmark, "shared GetCString", lString, kReadsPerThread, SharedReader);
+        MeasureReaders(inBenchmark, "per-use copy GetCString", lString, kCopiesPerThread, CopyingReader);
+    }
+
+    CFRelease(lCFString);
+}
+
+/*
+ * A wrapper that declares only copy operations, which suppresses the
+ * implicit move operations, such that a vector of them grows by
+ * copying, as a vector of CFString did before it gained move
+ * operations.
+ */
+struct CopyOnlyString
+{
+    CopyOnlyString(CFStringRef inString) :
+        mString(inString)
+    {
+        return;
+    }
+
+    CopyOnlyString(const CopyOnlyString & inString) :
+        mString(inString.mString)
+    {
+        return;
+    }
+
+    CopyOnlyString & operator =(const CopyOnlyString & inString)
+    {
+        mString = inString.mString;
+
+        return (*this);
+    }
+
+    CFString mString;
+};
+
+template <typename Element>
+static void
+GrowVector(CFStringRef inString, size_t inElements)
+{
+    std::vector<Element> lVector;
+
+    // Deliberately do not reserve, such that the vector reallocates
+    // and relocates its elements as it grows.
+
+    for (size_t i = 0; i < inElements; i++)
+    {
+        lVector.push_back(Element(inString));
+    }
+}
+
+static void
+BenchmarkVectorGrowth(Benchmark & inBenchmark)
+{
+    const size_t kElements    = 100000;
+    const size_t kRepetitions = 10;
+
+    inBenchmark.Measure("vector growth, copy only", kElements * kRepetitions, [&]() {
+        for (size_t i = 0; i < kRepetitions; i++)
+        {
+            GrowVector<CopyOnlyString>(CFSTR("String"), kElements);
+        }
+    });
+
+    inBenchmark.Measure("vector growth, move", kElements * kRepetitions, [&]() {
+        for (size_t i = 0; i < kRepetitions; i++)
+        {
+            GrowVector<CFString>(CFSTR("String"), kElements);
+        }
+    });
+}
+
+static Benchmark::Registration sConcurrentGetCString("CFString", BenchmarkConcurrentGetCString);
+static Benchmark::Registration sVectorGrowth("CFString", BenchmarkVectorGrowth);
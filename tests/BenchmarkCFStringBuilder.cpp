@@ -0,0 +1,97 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks comparing CFStringBuilder
+ *      against assembling a string with CFMutableString appends or
+ *      a single format.
+ */
+
+#include <CFUtilities/CFStringBuilder.hpp>
+#include <CFUtilities/CFUtilities.h>
+
+#include "Benchmark.hpp"
+
+
+static const size_t kIterations = 100000;
+
+/*
+ * A log line, short enough to be built entirely within the builder's
+ * inline buffer, from a mix of literals, integers, a floating-point
+ * number and a string.
+ */
+static CFStringRef const kHostName = CFSTR("gateway.example.net");
+static const unsigned    kPackets  = 1048576;
+static const double      kSeconds  = 2.718;
+
+static void
+BenchmarkLogLine(Benchmark & inBenchmark)
+{
+    inBenchmark.Measure("CFMutableString, appends", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFMutableStringRef lString = CFStringCreateMutable(kCFAllocatorDefault, 0);
+
+            CFStringAppendCString(lString, "Received ", kCFStringEncodingUTF8);
+            CFStringAppendFormat(lString, NULL, CFSTR("%u"), kPackets);
+            CFStringAppendCString(lString, " packets from ", kCFStringEncodingUTF8);
+            CFStringAppend(lString, kHostName);
+            CFStringAppendCString(lString, " in ", kCFStringEncodingUTF8);
+            CFStringAppendFormat(lString, NULL, CFSTR("%g"), kSeconds);
+            CFStringAppendCString(lString, " s", kCFStringEncodingUTF8);
+
+            CFRelease(lString);
+        }
+    });
+
+    inBenchmark.Measure("CFStringCreateWithFormat", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringRef lString = CFStringCreateWithFormat(kCFAllocatorDefault,
+                                                           NULL,
+                                                           CFSTR("Received %u packets from %@ in %g s"),
+                                                           kPackets,
+                                                           kHostName,
+                                                           kSeconds);
+
+            CFRelease(lString);
+        }
+    });
+
+    inBenchmark.Measure("CFStringBuilder", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringBuilder lBuilder;
+            CFStringRef     lString;
+
+            lBuilder.Append("Received ");
+            lBuilder.AppendInteger(kPackets);
+            lBuilder.Append(" packets from ");
+            lBuilder.Append(kHostName);
+            lBuilder.Append(" in ");
+            lBuilder.AppendFloat(kSeconds);
+            lBuilder.Append(" s");
+
+            lString = lBuilder.CreateString();
+
+            CFRelease(lString);
+        }
+    });
+}
+
+static Benchmark::Registration sLogLine("CFStringBuilder", BenchmarkLogLine);
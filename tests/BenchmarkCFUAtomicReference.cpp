@@ -0,0 +1,154 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a reader-scaling benchmark comparing
+ *      CFUAtomicReference snapshots against a mutex-protected,
+ *      retained reference.
+ */
+
+#include <CFUtilities/CFUAtomicReference.hpp>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+
+#include "Benchmark.hpp"
+
+
+static const size_t      kMaximumThreads = 64;
+static const size_t      kReadsPerThread = 100000;
+static CFStringRef const kTimeoutKey     = CFSTR("Timeout");
+
+typedef CFUAtomicReference<CFDictionaryRef> Configuration;
+
+/*
+ * The pre-existing pattern: a dictionary reference guarded by a
+ * mutex, retained under the lock for each read.
+ */
+struct LockedConfiguration
+{
+    std::mutex      mMutex;
+    CFDictionaryRef mDictionary;
+};
+
+static void
+SnapshotReader(const Configuration * inConfiguration, size_t inReads)
+{
+    for (size_t i = 0; i < inReads; i++)
+    {
+        const Configuration::Snapshot lSnapshot(*inConfiguration);
+
+        CFDictionaryGetValue(lSnapshot, kTimeoutKey);
+    }
+}
+
+static void
+LockedReader(LockedConfiguration * inConfiguration, size_t inReads)
+{
+    for (size_t i = 0; i < inReads; i++)
+    {
+        CFDictionaryRef lDictionary;
+
+        {
+            std::lock_guard<std::mutex> lLock(inConfiguration->mMutex);
+
+            lDictionary = static_cast<CFDictionaryRef>(CFRetain(inConfiguration->mDictionary));
+        }
+
+        CFDictionaryGetValue(lDictionary, kTimeoutKey);
+
+        CFRelease(lDictionary);
+    }
+}
+
+template <typename Reader, typename Holder>
+static void
+MeasureReaders(Benchmark &  inBenchmark,
+               const char * inName,
+               Holder *     inConfiguration,
+               Reader       inReader)
+{
+    char lLabel[64];
+
+    // Times are wall-clock time over the reads of all threads
+    // combined, so readers that scale perfectly halve the time per
+    // read each time the thread count doubles, up to the number of
+    // processors.
+
+    for (size_t lThreads = 1; lThreads <= kMaximumThreads; lThreads *= 2)
+    {
+        snprintf(lLabel, sizeof (lLabel), "%s, %zu threads", inName, lThreads);
+
+        inBenchmark.Measure(lLabel, kReadsPerThread * lThreads, [&]() {
+            std::vector<std::thread> lWorkers;
+
+            for (size_t i = 0; i < lThreads; i++)
+            {
+                lWorkers.push_back(std::thread(inReader, inConfiguration, kReadsPerThread));
+            }
+
+            for (size_t i = 0; i < lThreads; i++)
+            {
+                lWorkers[i].join();
+            }
+        });
+    }
+}
+
+static void
+BenchmarkReaderScaling(Benchmark & inBenchmark)
+{
+    const int           lTimeout = 30;
+    CFNumberRef         lNumber;
+    const void *        lKeys[1];
+    const void *        lValues[1];
+    CFDictionaryRef     lDictionary;
+    LockedConfiguration lLocked;
+
+    lNumber     = CFNumberCreate(kCFAllocatorDefault, kCFNumberIntType, &lTimeout);
+
+    lKeys[0]    = kTimeoutKey;
+    lValues[0]  = lNumber;
+
+    lDictionary = CFDictionaryCreate(kCFAllocatorDefault,
+                                     lKeys,
+                                     lValues,
+                                     1,
+                                     &kCFTypeDictionaryKeyCallBacks,
+                                     &kCFTypeDictionaryValueCallBacks);
+
+    lLocked.mDictionary = lDictionary;
+
+    {
+        // The default 128 hazard slots cover every reader thread, so
+        // no reader waits for a slot.
+
+        Configuration lConfiguration(lDictionary);
+
+        MeasureReaders(inBenchmark, "mutex and retain", &lLocked, LockedReader);
+        MeasureReaders(inBenchmark, "snapshot", &lConfiguration, SnapshotReader);
+    }
+
+    CFRelease(lDictionary);
+    CFRelease(lNumber);
+}
+
+static Benchmark::Registration sReaderScaling("CFUAtomicReference", BenchmarkReaderScaling);
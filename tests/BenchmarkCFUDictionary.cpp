@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks for the CFUDictionaryMerge and
+ *      CFUDictionaryDifference families, reporting the allocations
+ *      each makes alongside its time.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include "Benchmark.hpp"
+
+
+static const size_t  kIterations = 1000;
+static const CFIndex kEntries    = 1000;
+
+static CFMutableDictionaryRef
+CreateDictionary(void)
+{
+    return (CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                      0,
+                                      &kCFTypeDictionaryKeyCallBacks,
+                                      &kCFTypeDictionaryValueCallBacks));
+}
+
+/*
+ * A dictionary of kEntries numbers keyed by their decimal strings,
+ * starting at the specified first key.
+ */
+static CFMutableDictionaryRef
+CreateDictionary(CFIndex inFirst)
+{
+    CFMutableDictionaryRef lDictionary = CreateDictionary();
+
+    for (CFIndex i = inFirst; i < inFirst + kEntries; i++)
+    {
+        CFStringRef lKey = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("%ld"), static_cast<long>(i));
+
+        CFUDictionarySetNumber(lDictionary, lKey, static_cast<int>(i));
+
+        CFRelease(lKey);
+    }
+
+    return (lDictionary);
+}
+
+static void
+BenchmarkMerge(Benchmark & inBenchmark)
+{
+    CFMutableDictionaryRef lSource  = CreateDictionary(0);
+    CFMutableDictionaryRef lPresent = CreateDictionary(0);
+
+    inBenchmark.Measure("all keys new", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFMutableDictionaryRef lDestination = CreateDictionary();
+
+            CFUDictionaryMerge(lDestination, lSource, false);
+
+            CFRelease(lDestination);
+        }
+    });
+
+    inBenchmark.Measure("all keys present", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFUDictionaryMerge(lPresent, lSource, false);
+        }
+    });
+
+    inBenchmark.Measure("all keys present, replaced", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFUDictionaryMerge(lPresent, lSource, true);
+        }
+    });
+
+    CFRelease(lPresent);
+    CFRelease(lSource);
+}
+
+static void
+BenchmarkDifference(Benchmark & inBenchmark)
+{
+    CFMutableDictionaryRef lProposed = CreateDictionary(0);
+    CFMutableDictionaryRef lEqual    = CreateDictionary(0);
+    CFMutableDictionaryRef lShifted  = CreateDictionary(kEntries / 2);
+
+    inBenchmark.Measure("equal", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFMutableDictionaryRef lAdded   = CreateDictionary();
+            CFMutableDictionaryRef lRemoved = CreateDictionary();
+
+            CFUDictionaryDifference(lProposed, &lEqual, lAdded, NULL, lRemoved);
+
+            CFRelease(lRemoved);
+            CFRelease(lAdded);
+        }
+    });
+
+    inBenchmark.Measure("half added, half removed", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFMutableDictionaryRef lAdded   = CreateDictionary();
+            CFMutableDictionaryRef lCommon  = CreateDictionary();
+            CFMutableDictionaryRef lRemoved = CreateDictionary();
+
+            CFUDictionaryDifference(lProposed, &lShifted, lAdded, lCommon, lRemoved);
+
+            CFRelease(lRemoved);
+            CFRelease(lCommon);
+            CFRelease(lAdded);
+        }
+    });
+
+    CFRelease(lShifted);
+    CFRelease(lEqual);
+    CFRelease(lProposed);
+}
+
+static Benchmark::Registration sMerge("CFUDictionaryMerge", BenchmarkMerge);
+static Benchmark::Registration sDifference("CFUDictionaryDifference", BenchmarkDifference);
@@ -0,0 +1,127 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark comparing a full deep copy of
+ *      a large property list tree against a copy-on-write working
+ *      copy that mutates a single path.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include "Benchmark.hpp"
+
+
+/*
+ * The tree has kBranches dictionaries of kLeaves numbers each, or
+ * roughly 100,000 nodes.
+ */
+static const CFIndex kBranches = 100;
+static const CFIndex kLeaves   = 1000;
+
+static CFMutableDictionaryRef
+CreateDictionary(void)
+{
+    return (CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                      0,
+                                      &kCFTypeDictionaryKeyCallBacks,
+                                      &kCFTypeDictionaryValueCallBacks));
+}
+
+static CFDictionaryRef
+CreateTree(void)
+{
+    CFMutableDictionaryRef lTree = CreateDictionary();
+
+    for (CFIndex i = 0; i < kBranches; i++)
+    {
+        CFMutableDictionaryRef lBranch = CreateDictionary();
+        CFStringRef            lKey;
+
+        for (CFIndex j = 0; j < kLeaves; j++)
+        {
+            lKey = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("%ld"), static_cast<long>(j));
+
+            CFUDictionarySetNumber(lBranch, lKey, static_cast<int>(j));
+
+            CFRelease(lKey);
+        }
+
+        lKey = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("%ld"), static_cast<long>(i));
+
+        CFDictionarySetValue(lTree, lKey, lBranch);
+
+        CFRelease(lKey);
+        CFRelease(lBranch);
+    }
+
+    return (lTree);
+}
+
+static void
+BenchmarkCopyOnWrite(Benchmark & inBenchmark)
+{
+    const size_t    kDeepCopies = 10;
+    const size_t    kSnapshots  = 10000;
+    CFDictionaryRef lTree       = CreateTree();
+    CFStringRef     lBranch     = CFSTR("42");
+    CFArrayRef      lKeyPath;
+
+    lKeyPath = CFArrayCreate(kCFAllocatorDefault,
+                             reinterpret_cast<const void **>(&lBranch),
+                             1,
+                             &kCFTypeArrayCallBacks);
+
+    inBenchmark.Measure("CFPropertyListCreateDeepCopy", kDeepCopies, [&]() {
+        for (size_t i = 0; i < kDeepCopies; i++)
+        {
+            CFPropertyListRef lCopy;
+
+            lCopy = CFPropertyListCreateDeepCopy(kCFAllocatorDefault,
+                                                 lTree,
+                                                 kCFPropertyListMutableContainersAndLeaves);
+
+            CFRelease(lCopy);
+        }
+    });
+
+    inBenchmark.Measure("copy-on-write, one path mutated", kSnapshots, [&]() {
+        for (size_t i = 0; i < kSnapshots; i++)
+        {
+            CFUDictionaryCopyOnWriteRef lCopy;
+            CFMutableDictionaryRef      lMutable;
+            CFDictionaryRef             lSnapshot;
+
+            lCopy    = CFUDictionaryCopyOnWriteCreate(lTree);
+            lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, lKeyPath);
+
+            CFDictionarySetValue(lMutable, CFSTR("0"), kCFBooleanTrue);
+
+            lSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(lCopy);
+
+            CFRelease(lSnapshot);
+
+            CFUDictionaryCopyOnWriteDestroy(lCopy);
+        }
+    });
+
+    CFRelease(lKeyPath);
+    CFRelease(lTree);
+}
+
+static Benchmark::Registration sRegistration("CFUDictionaryCopyOnWrite", BenchmarkCopyOnWrite);
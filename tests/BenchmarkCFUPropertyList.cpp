@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks for reading and writing
+ *      property lists through a file descriptor, reporting the
+ *      allocations each makes alongside its time.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "Benchmark.hpp"
+
+
+static const size_t  kIterations = 1000;
+static const CFIndex kEntries    = 1000;
+
+/*
+ * A dictionary of kEntries numbers keyed by their decimal strings.
+ */
+static CFDictionaryRef
+CreateDictionary(void)
+{
+    CFMutableDictionaryRef lDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                                                   0,
+                                                                   &kCFTypeDictionaryKeyCallBacks,
+                                                                   &kCFTypeDictionaryValueCallBacks);
+
+    for (CFIndex i = 0; i < kEntries; i++)
+    {
+        CFStringRef lKey = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("%ld"), static_cast<long>(i));
+
+        CFUDictionarySetNumber(lDictionary, lKey, static_cast<int>(i));
+
+        CFRelease(lKey);
+    }
+
+    return (lDictionary);
+}
+
+static void
+BenchmarkFormat(Benchmark &          inBenchmark,
+                CFPropertyListFormat inFormat,
+                const char *         inWriteLabel,
+                const char *         inReadLabel)
+{
+    char            lPath[] = "/tmp/cfu-benchmark-plistXXXXXX";
+    CFDictionaryRef lDictionary;
+    int             lDescriptor;
+
+    lDescriptor = mkstemp(lPath);
+    if (lDescriptor < 0)
+    {
+        return;
+    }
+
+    unlink(lPath);
+
+    lDictionary = CreateDictionary();
+
+    inBenchmark.Measure(inWriteLabel, kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            lseek(lDescriptor, 0, SEEK_SET);
+
+            CFUPropertyListWriteToFD(lDescriptor, 0, inFormat, lDictionary, NULL);
+        }
+    });
+
+    inBenchmark.Measure(inReadLabel, kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFPropertyListRef lPlist = NULL;
+
+            lseek(lDescriptor, 0, SEEK_SET);
+
+            CFUPropertyListReadFromFD(lDescriptor,
+                                      0,
+                                      kCFPropertyListImmutable,
+                                      NULL,
+                                      &lPlist,
+                                      NULL);
+
+            if (lPlist != NULL)
+            {
+                CFRelease(lPlist);
+            }
+        }
+    });
+
+    CFRelease(lDictionary);
+
+    close(lDescriptor);
+}
+
+static void
+BenchmarkFD(Benchmark & inBenchmark)
+{
+    BenchmarkFormat(inBenchmark,
+                    kCFPropertyListXMLFormat_v1_0,
+                    "CFUPropertyListWriteToFD, XML",
+                    "CFUPropertyListReadFromFD, XML");
+
+    BenchmarkFormat(inBenchmark,
+                    kCFPropertyListBinaryFormat_v1_0,
+                    "CFUPropertyListWriteToFD, binary",
+                    "CFUPropertyListReadFromFD, binary");
+}
+
+static Benchmark::Registration sFD("CFUPropertyList", BenchmarkFD);
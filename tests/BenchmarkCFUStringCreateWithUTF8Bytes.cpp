@@ -0,0 +1,94 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks comparing
+ *      CFUStringCreateWithUTF8Bytes against CFStringCreateWithCString,
+ *      which it replaces, for the short strings typical of ingested
+ *      network data.
+ */
+
+#include <CFUtilities/CFUtilities.h>
+
+#include <string.h>
+
+#include "Benchmark.hpp"
+
+
+static const size_t kIterations = 1000000;
+
+/*
+ * A ASCII key key, an ASCII line long enough to exercise the wide
+ * scan, and a short key with a two-byte sequence near its end.
+ */
+static const char kShortASCII[]    = "interface.eth0.mtu";
+static const char kLongASCII[]     = "GET /api/v1/devices/0123456789abcdef/status?fields=uptime,"
+                                     "temperature,firmware,interfaces,addresses,routes HTTP/1.1";
+static const char kShortNonASCII[] = "zone.K\xc3\xbc" "che.setpoint";
+
+static void
+MeasureCreation(Benchmark &  inBenchmark,
+                const char * inCoreFoundationLabel,
+                const char * inCFUtilitiesLabel,
+                const char * inBytes)
+{
+    const size_t lLength = strlen(inBytes);
+
+    inBenchmark.Measure(inCoreFoundationLabel, kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringRef lString = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                            inBytes,
+                                                            kCFStringEncodingUTF8);
+
+            CFRelease(lString);
+        }
+    });
+
+    inBenchmark.Measure(inCFUtilitiesLabel, kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringRef lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault,
+                                                               inBytes,
+                                                               lLength);
+
+            CFRelease(lString);
+        }
+    });
+}
+
+static void
+BenchmarkShortStrings(Benchmark & inBenchmark)
+{
+    MeasureCreation(inBenchmark,
+                    "CFStringCreateWithCString, ASCII key",
+                    "CFUStringCreateWithUTF8Bytes, ASCII key",
+                    kShortASCII);
+
+    MeasureCreation(inBenchmark,
+                    "CFStringCreateWithCString, ASCII line",
+                    "CFUStringCreateWithUTF8Bytes, ASCII line",
+                    kLongASCII);
+
+    MeasureCreation(inBenchmark,
+                    "CFStringCreateWithCString, UTF-8 key",
+                    "CFUStringCreateWithUTF8Bytes, UTF-8 key",
+                    kShortNonASCII);
+}
+
+static Benchmark::Registration sShortStrings("CFUStringCreateWithUTF8Bytes", BenchmarkShortStrings);
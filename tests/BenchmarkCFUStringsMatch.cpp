@@ -0,0 +1,143 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements benchmarks comparing the CFUStringsMatch
+ *      family against the CoreFoundation comparisons they replace.
+ */
+
+#include <CFUtilities/CFUtilities.h>
+
+#include "Benchmark.hpp"
+
+
+static const size_t kIterations = 1000000;
+
+/*
+ * HTTP-like header names: an ASCII-backed pair differing only in
+ * case, and a non-ASCII pair that requires full Unicode folding.
+ */
+static CFStringRef const kHeader       = CFSTR("Content-Type-Options-Extended");
+static CFStringRef const kHeaderFolded = CFSTR("content-type-options-extended");
+static CFStringRef const kPrefix       = CFSTR("content-type");
+static CFStringRef const kSuffix       = CFSTR("OPTIONS-EXTENDED");
+
+static void
+BenchmarkIgnoringCase(Benchmark & inBenchmark)
+{
+    CFStringRef lNonASCII       = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                            "Stra\xc3\x9f" "e-Gr\xc3\x96\xc3\x9f" "e",
+                                                            kCFStringEncodingUTF8);
+    CFStringRef lNonASCIIFolded = CFStringCreateWithCString(kCFAllocatorDefault,
+                                                            "stra\xc3\x9f" "e-gr\xc3\xb6\xc3\x9f" "e",
+                                                            kCFStringEncodingUTF8);
+
+    inBenchmark.Measure("CFStringCompareWithOptions, ASCII", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringCompareWithOptions(kHeader,
+                                       kHeaderFolded,
+                                       CFRangeMake(0, CFStringGetLength(kHeader)),
+                                       kCFCompareCaseInsensitive);
+        }
+    });
+
+    inBenchmark.Measure("CFUStringsMatchIgnoringCase, ASCII", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFUStringsMatchIgnoringCase(kHeader, kHeaderFolded);
+        }
+    });
+
+    inBenchmark.Measure("CFStringCompareWithOptions, non-ASCII", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringCompareWithOptions(lNonASCII,
+                                       lNonASCIIFolded,
+                                       CFRangeMake(0, CFStringGetLength(lNonASCII)),
+                                       kCFCompareCaseInsensitive);
+        }
+    });
+
+    inBenchmark.Measure("CFUStringsMatchIgnoringCase, non-ASCII", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFUStringsMatchIgnoringCase(lNonASCII, lNonASCIIFolded);
+        }
+    });
+
+    CFRelease(lNonASCIIFolded);
+    CFRelease(lNonASCII);
+}
+
+static void
+BenchmarkAffixes(Benchmark & inBenchmark)
+{
+    inBenchmark.Measure("CFStringHasPrefix", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringHasPrefix(kHeaderFolded, kPrefix);
+        }
+    });
+
+    inBenchmark.Measure("CFUStringHasPrefix", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFUStringHasPrefix(kHeaderFolded, kPrefix, false);
+        }
+    });
+
+    inBenchmark.Measure("CFStringFind, case-insensitive prefix", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringFindWithOptions(kHeader,
+                                    kPrefix,
+                                    CFRangeMake(0, CFStringGetLength(kHeader)),
+                                    kCFCompareCaseInsensitive | kCFCompareAnchored,
+                                    NULL);
+        }
+    });
+
+    inBenchmark.Measure("CFUStringHasPrefix, ignoring case", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFUStringHasPrefix(kHeader, kPrefix, true);
+        }
+    });
+
+    inBenchmark.Measure("CFStringFind, case-insensitive suffix", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFStringFindWithOptions(kHeader,
+                                    kSuffix,
+                                    CFRangeMake(0, CFStringGetLength(kHeader)),
+                                    kCFCompareCaseInsensitive | kCFCompareAnchored | kCFCompareBackwards,
+                                    NULL);
+        }
+    });
+
+    inBenchmark.Measure("CFUStringHasSuffix, ignoring case", kIterations, [&]() {
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            CFUStringHasSuffix(kHeader, kSuffix, true);
+        }
+    });
+}
+
+static Benchmark::Registration sIgnoringCase("CFUStringsMatch", BenchmarkIgnoringCase);
+static Benchmark::Registration sAffixes("CFUStringsMatch", BenchmarkAffixes);
@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the benchmark harness and driver for the
+ *      CFUtilities benchmarks.
+ *
+ *      Run with no arguments, every registered benchmark case is
+ *      run. Otherwise, only those cases whose names contain the
+ *      first argument are run.
+ *
+ *      Every case runs with an accounting allocator as the default
+ *      allocator, such that, where a measurement allocates on the
+ *      measuring thread, the allocations and bytes allocated per
+ *      operation are reported alongside its time.
+ */
+
+#include "Benchmark.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <CFUtilities/CFUtilities.h>
+
+
+Benchmark :: Registration :: Registration(const char * inName,
+                                          Function     inFunction)
+{
+    const Case lCase = { inName, inFunction };
+
+    GetCases().push_back(lCase);
+}
+
+Benchmark :: Benchmark(const char * inName) :
+    mName(inName),
+    mStart()
+{
+    return;
+}
+
+std::vector<Benchmark::Case> &
+Benchmark :: GetCases(void)
+{
+    static std::vector<Case> sCases;
+
+    return (sCases);
+}
+
+void
+Benchmark :: Start(void)
+{
+    CFUAllocatorAccountingResetThreadStatistics();
+
+    mStart = std::chrono::steady_clock::now();
+}
+
+void
+Benchmark :: Stop(const char * inLabel, size_t inOperations)
+{
+    const std::chrono::steady_clock::time_point lStop = std::chrono::steady_clock::now();
+    const double                                lNanoseconds =
+        std::chrono::duration<double, std::nano>(lStop - mStart).count();
+    const double                                lOperations =
+        static_cast<double>((inOperations == 0) ? 1 : inOperations);
+    CFUAllocatorStatistics                      lStatistics;
+
+    CFUAllocatorAccountingGetThreadStatistics(&lStatistics);
+
+    printf("%-28s %-40s %14.1f ns/op",
+           mName,
+           inLabel,
+           lNanoseconds / lOperations);
+
+    // Reallocations are counted with allocations, since each may
+    // move and copy the allocation.
+
+    if ((lStatistics.mAllocations + lStatistics.mReallocations) > 0)
+    {
+        printf(" %10.2f allocs/op %12.1f B/op",
+               static_cast<double>(lStatistics.mAllocations + lStatistics.mReallocations) / lOperations,
+               static_cast<double>(lStatistics.mBytesAllocated) / lOperations);
+    }
+
+    printf("\n");
+}
+
+int
+Benchmark :: Run(const char * inFilter)
+{
+    const std::vector<Case> & lCases = GetCases();
+    CFAllocatorRef            lAccounting;
+    CFAllocatorRef            lPrevious;
+
+    // Made the default, the accounting allocator counts every
+    // allocation CoreFoundation and CFUtilities make on behalf of
+    // the default allocator, whether or not a case passes an
+    // allocator explicitly.
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, NULL);
+    if (lAccounting == NULL)
+    {
+        return (EXIT_FAILURE);
+    }
+
+    lPrevious = static_cast<CFAllocatorRef>(CFRetain(CFAllocatorGetDefault()));
+
+    CFAllocatorSetDefault(lAccounting);
+
+    for (size_t i = 0; i < lCases.size(); i++)
+    {
+        if ((inFilter == NULL) || (strstr(lCases[i].mName, inFilter) != NULL))
+        {
+            Benchmark lBenchmark(lCases[i].mName);
+
+            lCases[i].mFunction(lBenchmark);
+        }
+    }
+
+    CFAllocatorSetDefault(lPrevious);
+
+    CFRelease(lPrevious);
+    CFRelease(lAccounting);
+
+    return (EXIT_SUCCESS);
+}
+
+int main(int argc, char * argv[])
+{
+    return (Benchmark::Run((argc > 1) ? argv[1] : NULL));
+}
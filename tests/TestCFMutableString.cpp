@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2021 Nuovation System Designs, LLC
+ *    Copyright (c) 2021-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -37,6 +37,10 @@ class TestCFMutableString :
     CPPUNIT_TEST(TestCFMutableStringAssignment);
     CPPUNIT_TEST(TestEquality);
     CPPUNIT_TEST(TestSwap);
+    CPPUNIT_TEST(TestAppend);
+    CPPUNIT_TEST(TestReplace);
+    CPPUNIT_TEST(TestChomp);
+    CPPUNIT_TEST(TestHash);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -47,8 +51,16 @@ public:
     void TestCFMutableStringAssignment(void);
     void TestEquality(void);
     void TestSwap(void);
+    void TestAppend(void);
+    void TestReplace(void);
+    void TestChomp(void);
+    void TestHash(void);
 
 private:
+    static CFMutableStringRef CreateNonASCIIString(void);
+    static CFStringRef CreateCharacterString(UniChar aCharacter);
+    static void TestEncodings(const CFMutableString & aString);
+
     void Test(const CFMutableString & aString,
               CFMutableStringRef      aCFString,
               const char *            aCString);
@@ -270,3 +282,280 @@ TestCFMutableString :: TestSwap(void)
         CFRelease(lCFMutableStringInput);
     }
 }
+
+/*
+ * Create the mutable non-ASCII string "Teststräng", for which
+ * CoreFoundation is unlikely to have an O(1) representation in any
+ * encoding, such that the encoding buffer cache is exercised.
+ */
+CFMutableStringRef
+TestCFMutableString :: CreateNonASCIIString(void)
+{
+    const bool         kIsExternalRepresentation = true;
+    const UInt8        lUTF8Bytes[]              = { 'T', 'e', 's', 't',
+                                                     's', 't', 'r',
+                                                     0xc3, 0xa4,
+                                                     'n', 'g' };
+    CFStringRef        lCFString;
+    CFMutableStringRef lRetval;
+
+    lCFString = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                        &lUTF8Bytes[0],
+                                        sizeof (lUTF8Bytes),
+                                        kCFStringEncodingUTF8,
+                                        !kIsExternalRepresentation);
+    CPPUNIT_ASSERT(lCFString != NULL);
+
+    lRetval = CFStringCreateMutableCopy(kCFAllocatorDefault, 0, lCFString);
+    CPPUNIT_ASSERT(lRetval != NULL);
+
+    CFRelease(lCFString);
+
+    return (lRetval);
+}
+
+CFStringRef
+TestCFMutableString :: CreateCharacterString(UniChar aCharacter)
+{
+    CFStringRef lRetval;
+
+    lRetval = CFStringCreateWithCharacters(kCFAllocatorDefault, &aCharacter, 1);
+    CPPUNIT_ASSERT(lRetval != NULL);
+
+    return (lRetval);
+}
+
+/*
+ * Check that the cached encodings of the specified string match
+ * those freshly converted by CoreFoundation.
+ */
+void
+TestCFMutableString :: TestEncodings(const CFMutableString & aString)
+{
+    const CFStringEncoding lEncodings[] = { kCFStringEncodingUTF8,
+                                            kCFStringEncodingISOLatin1,
+                                            kCFStringEncodingMacRoman };
+
+    for (size_t i = 0; i < sizeof (lEncodings) / sizeof (lEncodings[0]); i++)
+    {
+        char         lExpected[256];
+        const char * lCString;
+        bool         lStatus;
+        int          l3WayComparison;
+
+        lStatus = CFStringGetCString(aString.GetString(),
+                                     &lExpected[0],
+                                     sizeof (lExpected),
+                                     lEncodings[i]);
+
+        lCString = aString.GetCString(lEncodings[i]);
+
+        if (!lStatus)
+        {
+            CPPUNIT_ASSERT(lCString == NULL);
+        }
+        else
+        {
+            CPPUNIT_ASSERT(lCString != NULL);
+
+            l3WayComparison = strcmp(lCString, &lExpected[0]);
+            CPPUNIT_ASSERT(l3WayComparison == 0);
+        }
+    }
+}
+
+void
+TestCFMutableString :: TestAppend(void)
+{
+    CFMutableStringRef lCFMutableStringInput = CreateNonASCIIString();
+    CFMutableString    lString(lCFMutableStringInput);
+    CFStringRef        lEuroSign;
+    const char *       lCString;
+
+    CFRelease(lCFMutableStringInput);
+
+    // 1: Populate the cache, then append to the string. The cached
+    //    encodings must reflect the appended content.
+
+    TestEncodings(lString);
+
+    lString.Append(CFSTR(" and more"));
+
+    TestEncodings(lString);
+
+    // 2: Appending enough to outgrow the inline buffer.
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        lString.Append(CFSTR(" and more"));
+
+        TestEncodings(lString);
+    }
+
+    // 3: Appending content that cannot be represented in an
+    //    encoding, here ISO Latin 1, must not leave a stale buffer
+    //    for it.
+
+    lEuroSign = CreateCharacterString(0x20AC);
+
+    lString.Append(lEuroSign);
+
+    CFRelease(lEuroSign);
+
+    lCString = lString.GetCString(kCFStringEncodingISOLatin1);
+    CPPUNIT_ASSERT(lCString == NULL);
+
+    TestEncodings(lString);
+
+    // 4: A null string has nothing to append to; a null append is
+    //    ignored.
+
+    lString.Append(NULL);
+
+    TestEncodings(lString);
+
+    {
+        CFMutableString lNullString;
+
+        lNullString.Append(CFSTR("Test"));
+        CPPUNIT_ASSERT(lNullString.GetString() == NULL);
+    }
+}
+
+void
+TestCFMutableString :: TestReplace(void)
+{
+    CFMutableStringRef lCFMutableStringInput = CreateNonASCIIString();
+    CFMutableString    lString(lCFMutableStringInput);
+    CFStringRef        lUDiaeresis;
+
+    CFRelease(lCFMutableStringInput);
+
+    TestEncodings(lString);
+
+    // 1: Replace at the beginning, in the middle, after the non-ASCII
+    //    character, and at the end.
+
+    lString.Replace(CFRangeMake(0, 4), CFSTR("Best"));
+
+    TestEncodings(lString);
+
+    lUDiaeresis = CreateCharacterString(0x00FC);
+
+    lString.Replace(CFRangeMake(4, 3), lUDiaeresis);
+
+    CFRelease(lUDiaeresis);
+
+    TestEncodings(lString);
+
+    lString.Replace(CFRangeMake(lString.GetLength() - 2, 2), CFSTR("ngs"));
+
+    TestEncodings(lString);
+
+    // 2: Replacement by an empty string deletes the range.
+
+    lString.Replace(CFRangeMake(1, 3), CFSTR(""));
+
+    TestEncodings(lString);
+}
+
+void
+TestCFMutableString :: TestChomp(void)
+{
+    CFMutableStringRef lCFMutableStringInput = CreateNonASCIIString();
+    CFMutableString    lString(lCFMutableStringInput);
+    const char *       lUTF8String;
+    const char *       lCString;
+    bool               lStatus;
+
+    CFRelease(lCFMutableStringInput);
+
+    lString.Append(CFSTR("\n"));
+
+    lUTF8String = lString.GetUTF8String();
+    CPPUNIT_ASSERT(lUTF8String != NULL);
+
+    TestEncodings(lString);
+
+    // 1: A trailing newline is removed and the cached encoding is
+    //    trimmed in place rather than re-created.
+
+    lStatus = lString.Chomp();
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lCString = lString.GetUTF8String();
+    CPPUNIT_ASSERT(lCString == lUTF8String);
+
+    TestEncodings(lString);
+
+    // 2: Without a trailing newline, nothing is removed.
+
+    lStatus = lString.Chomp();
+    CPPUNIT_ASSERT(lStatus == false);
+
+    TestEncodings(lString);
+
+    // 3: A trailing carriage return and line feed pair is removed
+    //    as one and the cached encoding is again trimmed in place.
+
+    lString.Append(CFSTR("\r\n"));
+
+    lUTF8String = lString.GetUTF8String();
+    CPPUNIT_ASSERT(lUTF8String != NULL);
+
+    lStatus = lString.Chomp();
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lCString = lString.GetUTF8String();
+    CPPUNIT_ASSERT(lCString == lUTF8String);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString.GetString(), lString.GetLength() - 1) != '\r');
+
+    TestEncodings(lString);
+
+    // 4: A lone trailing carriage return is not removed.
+
+    lString.Append(CFSTR("\r"));
+
+    lStatus = lString.Chomp();
+    CPPUNIT_ASSERT(lStatus == false);
+
+    TestEncodings(lString);
+
+    // 5: A null string has nothing to chomp.
+
+    {
+        CFMutableString lNullString;
+
+        lStatus = lNullString.Chomp();
+        CPPUNIT_ASSERT(lStatus == false);
+    }
+}
+
+void
+TestCFMutableString :: TestHash(void)
+{
+    CFMutableStringRef lCFMutableStringInput = CreateNonASCIIString();
+    CFMutableString    lString(lCFMutableStringInput);
+    size_t             lHash;
+
+    CFRelease(lCFMutableStringInput);
+
+    lHash = lString.GetHash();
+    CPPUNIT_ASSERT(lHash == CFUStringGetHash(lString.GetString()));
+
+    // Mutating the string through the object discards the memoized
+    // hash.
+
+    lString.Append(CFSTR("\n"));
+    CPPUNIT_ASSERT(lString.GetHash() != lHash);
+    CPPUNIT_ASSERT(lString.GetHash() == CFUStringGetHash(lString.GetString()));
+
+    lString.Chomp();
+    CPPUNIT_ASSERT(lString.GetHash() == lHash);
+
+    lString.Replace(CFRangeMake(0, 4), CFSTR("Best"));
+    CPPUNIT_ASSERT(lString.GetHash() != lHash);
+    CPPUNIT_ASSERT(lString.GetHash() == CFUStringGetHash(lString.GetString()));
+
+    CPPUNIT_ASSERT(std::hash<CFMutableString>()(lString) == lString.GetHash());
+}
@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFStaticString.
+ */
+
+#include <CFUtilities/CFString.hpp>
+
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+static constexpr CFStaticString kEmptyKey("");
+static constexpr CFStaticString kNumberKey("Number");
+static constexpr CFStaticString kBooleanKey("Boolean");
+static constexpr CFStaticString kNonASCIIKey("Gr\xc3\xb6\xc3\x9f" "e \xe2\x82\xac \xf0\x9f\x98\x80");
+static constexpr CFStaticString kStrideKey("Hash across a stride boundary");
+
+/*
+ * A two (2) kibibyte literal, deeper than a compiler's default
+ * constant-expression nesting limit if it were validated and hashed
+ * a byte per level.
+ */
+#define SIXTY_FOUR_BYTES "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef"
+#define KIBIBYTE         SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES \
+                         SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES \
+                         SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES \
+                         SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES SIXTY_FOUR_BYTES
+
+static constexpr CFStaticString kLongKey(KIBIBYTE KIBIBYTE);
+
+// Each of these is evaluated entirely at compile time.
+
+static_assert(kNumberKey.GetLength() == 6, "unexpected length");
+static_assert(kEmptyKey.GetHash() == CFStaticString::Hash("", 0), "unexpected hash");
+static_assert(kNumberKey.GetHash() != kBooleanKey.GetHash(), "unexpected hash collision");
+static_assert(kStrideKey.GetHash() == static_cast<size_t>(0x814850eaeef3fa90ULL), "unexpected hash");
+static_assert(kLongKey.GetLength() == 2048, "unexpected length");
+
+class TestCFStaticString :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFStaticString);
+    CPPUNIT_TEST(TestAccessors);
+    CPPUNIT_TEST(TestInterned);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST(TestInvalid);
+    CPPUNIT_TEST(TestDictionary);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestAccessors(void);
+    void TestInterned(void);
+    void TestNonASCII(void);
+    void TestInvalid(void);
+    void TestDictionary(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFStaticString);
+
+void
+TestCFStaticString :: TestAccessors(void)
+{
+    int l3WayComparison;
+
+    l3WayComparison = strcmp(kNumberKey.GetCString(), "Number");
+    CPPUNIT_ASSERT(l3WayComparison == 0);
+
+    CPPUNIT_ASSERT(kEmptyKey.GetLength() == 0);
+    CPPUNIT_ASSERT(kNonASCIIKey.GetLength() == 16);
+}
+
+void
+TestCFStaticString :: TestInterned(void)
+{
+    CFStringRef lString;
+
+    // The string has the expected content.
+
+    lString = kNumberKey.GetString();
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringCompare(lString, CFSTR("Number"), 0) == kCFCompareEqualTo);
+
+    // It is the same interned string on every use, and the same as
+    // that interned at run time from the same bytes, which also
+    // demonstrates that the compile-time and run-time hashes agree.
+
+    CPPUNIT_ASSERT(kNumberKey.GetString() == lString);
+    CPPUNIT_ASSERT(CFUStringGetInternedCString("Number") == lString);
+
+    lString = kEmptyKey;
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringGetLength(lString) == 0);
+
+    // Likewise for literals hashed a stride at a time.
+
+    CPPUNIT_ASSERT(CFUStringGetInternedCString(kStrideKey.GetCString()) == kStrideKey.GetString());
+    CPPUNIT_ASSERT(CFUStringGetInternedCString(kLongKey.GetCString()) == kLongKey.GetString());
+}
+
+void
+TestCFStaticString :: TestNonASCII(void)
+{
+    CFStringRef lString;
+
+    lString = kNonASCIIKey.GetString();
+    CPPUNIT_ASSERT(lString != NULL);
+
+    // "Größe € " is eight (8) UTF-16 code units and the emoji two
+    // (2) more.
+
+    CPPUNIT_ASSERT(CFStringGetLength(lString) == 10);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, 2) == 0x00f6);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, 6) == 0x20ac);
+
+    CPPUNIT_ASSERT(CFUStringGetInternedCString(kNonASCIIKey.GetCString()) == lString);
+}
+
+void
+TestCFStaticString :: TestInvalid(void)
+{
+    // Declared constexpr, each of these would fail to compile. At run
+    // time, they yield no string.
+
+    const CFStaticString lOverlong("\xc0\xaf");
+    const CFStaticString lSurrogate("\xed\xa0\x80");
+    const CFStaticString lTruncated("\xe2\x82");
+    const CFStaticString lContinuation("\x80");
+
+    CPPUNIT_ASSERT(lOverlong.GetString() == NULL);
+    CPPUNIT_ASSERT(lSurrogate.GetString() == NULL);
+    CPPUNIT_ASSERT(lTruncated.GetString() == NULL);
+    CPPUNIT_ASSERT(lContinuation.GetString() == NULL);
+}
+
+void
+TestCFStaticString :: TestDictionary(void)
+{
+    CFMutableDictionaryRef lDictionary;
+    int                    lNumber  = 0;
+    bool                   lBoolean = false;
+    Boolean                lStatus;
+
+    lDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                            0,
+                                            &kCFTypeDictionaryKeyCallBacks,
+                                            &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lDictionary != NULL);
+
+    // Static strings may be used directly as dictionary keys.
+
+    lStatus = CFUDictionarySetNumber(lDictionary, kNumberKey, 42);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lStatus = CFUDictionarySetBoolean(lDictionary, kBooleanKey, true);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lStatus = CFUDictionaryGetNumber(lDictionary, kNumberKey, lNumber);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lNumber == 42);
+
+    lStatus = CFUDictionaryGetBoolean(lDictionary, kBooleanKey, lBoolean);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lBoolean == true);
+
+    // And match keys created otherwise.
+
+    lNumber = 0;
+
+    lStatus = CFUDictionaryGetNumber(lDictionary, CFSTR("Number"), lNumber);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lNumber == 42);
+
+    CFRelease(lDictionary);
+}
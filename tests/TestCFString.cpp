@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2021 Nuovation System Designs, LLC
+ *    Copyright (c) 2021-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -22,10 +22,78 @@
 
 #include <CFUtilities/CFString.hpp>
 
+#include <atomic>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stdlib.h>
+
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
 
 
+/*
+ * Replacements for the global allocation functions that count every
+ * heap allocation made through operator new or operator new[], such
+ * that the encoding cache may be shown not to allocate for short
+ * strings.
+ */
+static std::atomic<size_t> sAllocations(0);
+
+void *
+operator new(std::size_t inSize)
+{
+    void * lPointer;
+
+    sAllocations++;
+
+    lPointer = malloc((inSize == 0) ? 1 : inSize);
+    if (lPointer == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    return (lPointer);
+}
+
+void *
+operator new[](std::size_t inSize)
+{
+    return (operator new(inSize));
+}
+
+void
+operator delete(void * inPointer) noexcept
+{
+    free(inPointer);
+}
+
+void
+operator delete[](void * inPointer) noexcept
+{
+    free(inPointer);
+}
+
+#if defined(__cpp_sized_deallocation)
+void
+operator delete(void * inPointer, std::size_t inSize) noexcept
+{
+    (void)inSize;
+
+    free(inPointer);
+}
+
+void
+operator delete[](void * inPointer, std::size_t inSize) noexcept
+{
+    (void)inSize;
+
+    free(inPointer);
+}
+#endif
+
 class TestCFString :
     public CppUnit::TestFixture
 {
@@ -37,7 +105,16 @@ class TestCFString :
     CPPUNIT_TEST(TestCFStringAssignment);
     CPPUNIT_TEST(TestEquality);
     CPPUNIT_TEST(TestSwap);
+    CPPUNIT_TEST(TestMove);
+    CPPUNIT_TEST(TestVectorGrowth);
     CPPUNIT_TEST(TestEncodingCache);
+    CPPUNIT_TEST(TestEncodingCacheSizes);
+    CPPUNIT_TEST(TestEncodingCacheAllocations);
+    CPPUNIT_TEST(TestLength);
+    CPPUNIT_TEST(TestHash);
+#if __cplusplus >= 201703L
+    CPPUNIT_TEST(TestViews);
+#endif
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -48,9 +125,20 @@ public:
     void TestCFStringAssignment(void);
     void TestEquality(void);
     void TestSwap(void);
+    void TestMove(void);
+    void TestVectorGrowth(void);
     void TestEncodingCache(void);
+    void TestEncodingCacheSizes(void);
+    void TestEncodingCacheAllocations(void);
+    void TestLength(void);
+    void TestHash(void);
+#if __cplusplus >= 201703L
+    void TestViews(void);
+#endif
 
 private:
+    static CFStringRef CreateLongString(void);
+
     void Test(const CFString & aString,
               CFStringRef      aCFString,
               const char *     aCString);
@@ -235,6 +323,131 @@ TestCFString :: TestSwap(void)
     CPPUNIT_ASSERT(lStringRef == NULL);
 }
 
+/*
+ * Create a non-ASCII string whose UTF-8 encoding is too long to be
+ * held inline by the encoding buffer cache, such that the address of
+ * its cached UTF-8 buffer is stable for the lifetime of the cache.
+ */
+CFStringRef
+TestCFString :: CreateLongString(void)
+{
+    static const size_t kRepeat = 40;
+    const bool          kIsExternalRepresentation = true;
+    UInt8               lUTF8Bytes[kRepeat * 2];
+    CFStringRef         lRetval;
+
+    for (size_t i = 0; i < kRepeat; i++)
+    {
+        lUTF8Bytes[(i * 2) + 0] = 0xc3;
+        lUTF8Bytes[(i * 2) + 1] = 0xa4;
+    }
+
+    lRetval = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                      &lUTF8Bytes[0],
+                                      sizeof (lUTF8Bytes),
+                                      kCFStringEncodingUTF8,
+                                      !kIsExternalRepresentation);
+    CPPUNIT_ASSERT(lRetval != NULL);
+
+    return (lRetval);
+}
+
+void
+TestCFString :: TestMove(void)
+{
+    CFStringRef  lCFStringInput = CreateLongString();
+    CFIndex      lRetainCount   = CFGetRetainCount(lCFStringInput);
+    CFString     lFirstString(lCFStringInput);
+    const char * lUTF8String;
+    const char * lCString;
+
+    lUTF8String = lFirstString.GetUTF8String();
+    CPPUNIT_ASSERT(lUTF8String != NULL);
+
+    // 1: Move construction transfers both the reference, without
+    //    retaining it, and the encoding buffer cache.
+
+    CFString lSecondString(std::move(lFirstString));
+
+    CPPUNIT_ASSERT(lFirstString.GetString() == NULL);
+    CPPUNIT_ASSERT(lSecondString.GetString() == lCFStringInput);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFStringInput) == lRetainCount + 1);
+
+    lCString = lSecondString.GetUTF8String();
+    CPPUNIT_ASSERT(lCString == lUTF8String);
+
+    // 2: As does move assignment, which releases the reference
+    //    previously held.
+
+    CFString lThirdString(CFSTR("Test String"));
+
+    lThirdString = std::move(lSecondString);
+
+    CPPUNIT_ASSERT(lSecondString.GetString() == NULL);
+    CPPUNIT_ASSERT(lThirdString.GetString() == lCFStringInput);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFStringInput) == lRetainCount + 1);
+
+    lCString = lThirdString.GetUTF8String();
+    CPPUNIT_ASSERT(lCString == lUTF8String);
+
+    // 3: Swap exchanges the encoding buffer caches, too.
+
+    lFirstString.Swap(lThirdString);
+
+    CPPUNIT_ASSERT(lFirstString.GetString() == lCFStringInput);
+    CPPUNIT_ASSERT(lThirdString.GetString() == NULL);
+
+    lCString = lFirstString.GetUTF8String();
+    CPPUNIT_ASSERT(lCString == lUTF8String);
+
+    // 4: Self-move assignment is benign.
+
+    CFString & lSelf = lFirstString;
+
+    lFirstString = std::move(lSelf);
+
+    CPPUNIT_ASSERT(lFirstString.GetString() == lCFStringInput);
+
+    CFRelease(lCFStringInput);
+}
+
+void
+TestCFString :: TestVectorGrowth(void)
+{
+    static const size_t   kCount         = 1000;
+    CFStringRef           lCFStringInput = CreateLongString();
+    CFIndex               lRetainCount   = CFGetRetainCount(lCFStringInput);
+    std::vector<CFString> lStrings;
+    const char *          lFirstUTF8String;
+    const char *          lCString;
+
+    lStrings.push_back(CFString(lCFStringInput));
+
+    lFirstUTF8String = lStrings[0].GetUTF8String();
+    CPPUNIT_ASSERT(lFirstUTF8String != NULL);
+
+    // Grow the vector through many reallocations. Were elements
+    // copied rather than moved, their encoding buffer caches would
+    // be discarded and the cached buffer would be re-created at a
+    // different address.
+
+    for (size_t i = 1; i < kCount; i++)
+    {
+        lStrings.push_back(CFString(lCFStringInput));
+    }
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFStringInput) == lRetainCount + static_cast<CFIndex>(kCount));
+
+    lCString = lStrings[0].GetUTF8String();
+    CPPUNIT_ASSERT(lCString == lFirstUTF8String);
+
+    lStrings.clear();
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFStringInput) == lRetainCount);
+
+    CFRelease(lCFStringInput);
+}
+
 void
 TestCFString :: TestEncodingCache(void)
 {
@@ -363,3 +576,273 @@ TestCFString :: TestEncodingCache(void)
                              static_cast<size_t>(lNonASCIIMacRomanLength));
     CPPUNIT_ASSERT(l3WayComparison == 0);
 }
+
+void
+TestCFString :: TestEncodingCacheSizes(void)
+{
+    static const size_t kRepeat = 40;
+    const bool          kIsExternalRepresentation = true;
+    UInt8               lUTF8Bytes[kRepeat * 2];
+    char                lMacRomanExpected[kRepeat + 1];
+    char                lLatin1Expected[kRepeat + 1];
+    CFStringRef         lCFStringInput;
+    CFString            lString;
+    const char *        lUTF8String;
+    const char *        lMacRomanString;
+    const char *        lLatin1String;
+    const char *        lCString;
+    int                 l3WayComparison;
+
+    // Build a non-ASCII string of forty (40) 'ä' characters, which
+    // is eighty (80) bytes in UTF-8, too long to be held inline, but
+    // only forty (40) bytes in single-byte encodings, short enough
+    // to be held inline.
+
+    for (size_t i = 0; i < kRepeat; i++)
+    {
+        lUTF8Bytes[(i * 2) + 0] = 0xc3;
+        lUTF8Bytes[(i * 2) + 1] = 0xa4;
+        lMacRomanExpected[i]    = static_cast<char>(0x8a);
+        lLatin1Expected[i]      = static_cast<char>(0xe4);
+    }
+
+    lMacRomanExpected[kRepeat] = '\0';
+    lLatin1Expected[kRepeat]   = '\0';
+
+    lCFStringInput = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                             &lUTF8Bytes[0],
+                                             sizeof (lUTF8Bytes),
+                                             kCFStringEncodingUTF8,
+                                             !kIsExternalRepresentation);
+    CPPUNIT_ASSERT(lCFStringInput != NULL);
+
+    lString = lCFStringInput;
+
+    // 1: An encoding too long to be held inline.
+
+    lUTF8String = lString.GetCString(kCFStringEncodingUTF8);
+    CPPUNIT_ASSERT(lUTF8String != NULL);
+    CPPUNIT_ASSERT(strlen(lUTF8String) == sizeof (lUTF8Bytes));
+
+    l3WayComparison = memcmp(lUTF8String, &lUTF8Bytes[0], sizeof (lUTF8Bytes));
+    CPPUNIT_ASSERT(l3WayComparison == 0);
+
+    // 2: The first encoding short enough to be held inline.
+
+    lMacRomanString = lString.GetCString(kCFStringEncodingMacRoman);
+    CPPUNIT_ASSERT(lMacRomanString != NULL);
+
+    l3WayComparison = strcmp(lMacRomanString, lMacRomanExpected);
+    CPPUNIT_ASSERT(l3WayComparison == 0);
+
+    // 3: A second encoding short enough to be held inline, but
+    //    which must be held elsewhere.
+
+    lLatin1String = lString.GetCString(kCFStringEncodingISOLatin1);
+    CPPUNIT_ASSERT(lLatin1String != NULL);
+
+    l3WayComparison = strcmp(lLatin1String, lLatin1Expected);
+    CPPUNIT_ASSERT(l3WayComparison == 0);
+
+    // 4: An encoding in which the string cannot be represented.
+
+    lCString = lString.GetCString(kCFStringEncodingASCII);
+    CPPUNIT_ASSERT(lCString == NULL);
+
+    // 5: Subsequent requests return the same, stable buffers.
+
+    lCString = lString.GetCString(kCFStringEncodingUTF8);
+    CPPUNIT_ASSERT(lCString == lUTF8String);
+
+    lCString = lString.GetCString(kCFStringEncodingMacRoman);
+    CPPUNIT_ASSERT(lCString == lMacRomanString);
+
+    lCString = lString.GetCString(kCFStringEncodingISOLatin1);
+    CPPUNIT_ASSERT(lCString == lLatin1String);
+
+    CFRelease(lCFStringInput);
+}
+
+void
+TestCFString :: TestEncodingCacheAllocations(void)
+{
+    static const size_t kIterations = 1000;
+    static const UInt8  kShort[]    = { 'S', 't', 'r', 'a', 0xc3, 0x9f, 'e' };
+    const bool          kIsExternalRepresentation = true;
+    CFStringRef         lCFShortInput;
+    CFStringRef         lCFLongInput;
+    const char *        lCString;
+    size_t              lBefore;
+    size_t              lAllocations = 0;
+
+    lCFShortInput = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                            &kShort[0],
+                                            sizeof (kShort),
+                                            kCFStringEncodingUTF8,
+                                            !kIsExternalRepresentation);
+    CPPUNIT_ASSERT(lCFShortInput != NULL);
+
+    lCFLongInput = CreateLongString();
+    CPPUNIT_ASSERT(lCFLongInput != NULL);
+
+    // 1: A conversion too long to be held inline allocates, showing
+    //    that allocations are being counted.
+
+    {
+        CFString lString(lCFLongInput);
+
+        lBefore = sAllocations;
+
+        lCString = lString.GetCString(kCFStringEncodingUTF8);
+        CPPUNIT_ASSERT(lCString != NULL);
+
+        CPPUNIT_ASSERT(sAllocations > lBefore);
+    }
+
+    // 2: Neither the first conversion of a short, non-ASCII string,
+    //    held inline, nor any repeated conversion allocates.
+
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        CFString lString(lCFShortInput);
+
+        lBefore = sAllocations;
+
+        lCString = lString.GetCString(kCFStringEncodingUTF8);
+        CPPUNIT_ASSERT(lCString != NULL);
+
+        lCString = lString.GetCString(kCFStringEncodingUTF8);
+        CPPUNIT_ASSERT(lCString != NULL);
+
+        lAllocations += sAllocations - lBefore;
+    }
+
+    CPPUNIT_ASSERT(lAllocations == 0);
+
+    CFRelease(lCFLongInput);
+    CFRelease(lCFShortInput);
+}
+
+void
+TestCFString :: TestLength(void)
+{
+    CFStringRef  lCFStringASCIIInput = CFSTR("Test String");
+    CFStringRef  lCFStringLongInput  = CreateLongString();
+    CFString     lDefaultString;
+    CFString     lASCIIString(lCFStringASCIIInput);
+    CFString     lLongString(lCFStringLongInput);
+    const char * lCString;
+    CFIndex      lLength;
+
+    // 1: A null string is empty.
+
+    lCString = lDefaultString.GetCString(kCFStringEncodingUTF8, lLength);
+    CPPUNIT_ASSERT(lCString != NULL);
+    CPPUNIT_ASSERT(lLength == 0);
+
+    // 2: An ASCII string, possibly in O(1) time from CoreFoundation
+    //    itself.
+
+    lCString = lASCIIString.GetCString(kCFStringEncodingUTF8, lLength);
+    CPPUNIT_ASSERT(lCString != NULL);
+    CPPUNIT_ASSERT(lLength == 11);
+    CPPUNIT_ASSERT(strlen(lCString) == 11);
+
+    // 3: A non-ASCII string, from the encoding buffer cache, whose
+    //    length in UTF-8 exceeds its length in characters, on both
+    //    a miss and a hit.
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        lCString = lLongString.GetCString(kCFStringEncodingUTF8, lLength);
+        CPPUNIT_ASSERT(lCString != NULL);
+        CPPUNIT_ASSERT(lLength == lLongString.GetLength() * 2);
+        CPPUNIT_ASSERT(strlen(lCString) == static_cast<size_t>(lLength));
+
+        lCString = lLongString.GetCString(kCFStringEncodingISOLatin1, lLength);
+        CPPUNIT_ASSERT(lCString != NULL);
+        CPPUNIT_ASSERT(lLength == lLongString.GetLength());
+    }
+
+    // 4: A string that cannot be decoded.
+
+    lCString = lLongString.GetCString(kCFStringEncodingASCII, lLength);
+    CPPUNIT_ASSERT(lCString == NULL);
+    CPPUNIT_ASSERT(lLength == 0);
+
+    CFRelease(lCFStringLongInput);
+}
+
+#if __cplusplus >= 201703L
+void
+TestCFString :: TestViews(void)
+{
+    CFStringRef         lCFStringLongInput = CreateLongString();
+    CFString            lASCIIString(CFSTR("Test String"));
+    CFString            lLongString(lCFStringLongInput);
+    std::string_view    lView;
+    std::u16string_view lCharacters;
+
+    lView = lASCIIString.GetUTF8StringView();
+    CPPUNIT_ASSERT(lView == "Test String");
+
+    lView = lLongString.GetUTF8StringView();
+    CPPUNIT_ASSERT(lView.data() == lLongString.GetUTF8String());
+    CPPUNIT_ASSERT(lView.size() == static_cast<size_t>(lLongString.GetLength() * 2));
+
+    lView = lLongString.GetStringView(kCFStringEncodingASCII);
+    CPPUNIT_ASSERT(lView.data() == NULL);
+    CPPUNIT_ASSERT(lView.empty());
+
+    // A view of the characters is only available when
+    // CoreFoundation has them, but must agree with them when it is.
+
+    lCharacters = lLongString.GetCharactersView();
+
+    if (lCharacters.data() != NULL)
+    {
+        CPPUNIT_ASSERT(lCharacters.size() == static_cast<size_t>(lLongString.GetLength()));
+        CPPUNIT_ASSERT(lCharacters[0] == 0x00e4);
+    }
+
+    CFRelease(lCFStringLongInput);
+}
+#endif
+
+void
+TestCFString :: TestHash(void)
+{
+    CFString                          lFirst(CFSTR("Key"));
+    CFString                          lSecond;
+    std::unordered_map<CFString, int> lIndex;
+    size_t                            lHash;
+
+    // The memoized hash agrees with that of the string reference,
+    // and survives copying and moving.
+
+    lHash = lFirst.GetHash();
+    CPPUNIT_ASSERT(lHash == CFUStringGetHash(CFSTR("Key")));
+    CPPUNIT_ASSERT(lFirst.GetHash() == lHash);
+
+    lSecond = lFirst;
+    CPPUNIT_ASSERT(lSecond.GetHash() == lHash);
+
+    lSecond = std::move(lFirst);
+    CPPUNIT_ASSERT(lSecond.GetHash() == lHash);
+    CPPUNIT_ASSERT(lFirst.GetHash() == CFUStringGetHash(NULL));
+
+    // Reassignment discards it.
+
+    lSecond = CFSTR("Other Key");
+    CPPUNIT_ASSERT(lSecond.GetHash() == CFUStringGetHash(CFSTR("Other Key")));
+
+    // String objects may be used directly as keys.
+
+    lIndex[CFString(CFSTR("Key"))]       = 1;
+    lIndex[CFString(CFSTR("Other Key"))] = 2;
+
+    CPPUNIT_ASSERT(lIndex.size() == 2);
+    CPPUNIT_ASSERT(lIndex[CFString(CFSTR("Key"))] == 1);
+    CPPUNIT_ASSERT(lIndex[lSecond] == 2);
+    CPPUNIT_ASSERT(lIndex.find(CFString(CFSTR("Missing Key"))) == lIndex.end());
+}
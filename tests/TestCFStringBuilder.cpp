@@ -0,0 +1,245 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements a unit test for CFStringBuilder.
+ */
+
+#include <CFUtilities/CFString.hpp>
+
+#include <string>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFStringBuilder :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFStringBuilder);
+    CPPUNIT_TEST(TestEmpty);
+    CPPUNIT_TEST(TestBytes);
+    CPPUNIT_TEST(TestCharacters);
+    CPPUNIT_TEST(TestStrings);
+    CPPUNIT_TEST(TestIntegers);
+    CPPUNIT_TEST(TestFloats);
+    CPPUNIT_TEST(TestLong);
+    CPPUNIT_TEST(TestReuse);
+    CPPUNIT_TEST(TestInvalid);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestEmpty(void);
+    void TestBytes(void);
+    void TestCharacters(void);
+    void TestStrings(void);
+    void TestIntegers(void);
+    void TestFloats(void);
+    void TestLong(void);
+    void TestReuse(void);
+    void TestInvalid(void);
+
+private:
+    static void Test(CFStringBuilder & inBuilder, const char * inExpected);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFStringBuilder);
+
+void
+TestCFStringBuilder :: Test(CFStringBuilder & inBuilder, const char * inExpected)
+{
+    const size_t lLength = strlen(inExpected);
+    CFStringRef  lExpected;
+    CFStringRef  lString;
+
+    CPPUNIT_ASSERT(inBuilder.GetLength() == lLength);
+    CPPUNIT_ASSERT(memcmp(inBuilder.GetBytes(), inExpected, lLength) == 0);
+
+    lExpected = CFStringCreateWithCString(kCFAllocatorDefault,
+                                          inExpected,
+                                          kCFStringEncodingUTF8);
+    CPPUNIT_ASSERT(lExpected != NULL);
+
+    lString = inBuilder.CreateString();
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringCompare(lString, lExpected, 0) == kCFCompareEqualTo);
+
+    // Creating the string empties the builder.
+
+    CPPUNIT_ASSERT(inBuilder.GetLength() == 0);
+
+    CFRelease(lString);
+    CFRelease(lExpected);
+}
+
+void
+TestCFStringBuilder :: TestEmpty(void)
+{
+    CFStringBuilder lBuilder;
+
+    Test(lBuilder, "");
+}
+
+void
+TestCFStringBuilder :: TestBytes(void)
+{
+    CFStringBuilder lBuilder;
+
+    lBuilder.Append("Gr\xc3\xb6\xc3\x9f" "e").Append(':').Append(" and more", 4);
+
+    Test(lBuilder, "Gr\xc3\xb6\xc3\x9f" "e: and");
+}
+
+void
+TestCFStringBuilder :: TestCharacters(void)
+{
+    // An unpaired surrogate is replaced with U+FFFD.
+
+    static const UniChar kCharacters[] = { 'a', 0x00E4, 0x20AC, 0xD83D, 0xDE00, 0xD800, 'b' };
+    CFStringBuilder      lBuilder;
+
+    lBuilder.Append(kCharacters, sizeof (kCharacters) / sizeof (kCharacters[0]));
+
+    Test(lBuilder, "a\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80\xef\xbf\xbd" "b");
+}
+
+void
+TestCFStringBuilder :: TestStrings(void)
+{
+    static const UniChar kCharacters[] = { 'G', 'r', 0x00F6, 0x00DF, 'e' };
+    CFStringRef          lString;
+    CFMutableStringRef   lMutableString;
+    CFStringBuilder      lBuilder;
+
+    lString = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                           kCharacters,
+                                           sizeof (kCharacters) / sizeof (kCharacters[0]));
+    CPPUNIT_ASSERT(lString != NULL);
+
+    lMutableString = CFStringCreateMutableCopy(kCFAllocatorDefault, 0, lString);
+    CPPUNIT_ASSERT(lMutableString != NULL);
+
+    lBuilder.Append(CFSTR("ASCII, "));
+    lBuilder.Append(lString);
+    lBuilder.Append(static_cast<CFStringRef>(NULL));
+    lBuilder.Append(", ");
+    lBuilder.Append(lMutableString);
+
+    Test(lBuilder, "ASCII, Gr\xc3\xb6\xc3\x9f" "e, Gr\xc3\xb6\xc3\x9f" "e");
+
+    CFRelease(lMutableString);
+    CFRelease(lString);
+}
+
+void
+TestCFStringBuilder :: TestIntegers(void)
+{
+    CFStringBuilder lBuilder;
+
+    lBuilder.AppendInteger(0).Append(' ');
+    lBuilder.AppendInteger(-42).Append(' ');
+    lBuilder.AppendInteger(static_cast<signed char>(-128)).Append(' ');
+    lBuilder.AppendInteger(INT64_MIN).Append(' ');
+    lBuilder.AppendInteger(UINT64_MAX);
+
+    Test(lBuilder, "0 -42 -128 -9223372036854775808 18446744073709551615");
+}
+
+void
+TestCFStringBuilder :: TestFloats(void)
+{
+    CFStringBuilder lBuilder;
+
+    // Numbers are written in as few digits as read back exactly.
+
+    lBuilder.AppendFloat(0.1).Append(' ');
+    lBuilder.AppendFloat(-2.5).Append(' ');
+    lBuilder.AppendFloat(1.0 / 3.0);
+
+    Test(lBuilder, "0.1 -2.5 0.3333333333333333");
+}
+
+void
+TestCFStringBuilder :: TestLong(void)
+{
+    CFStringBuilder lBuilder;
+    std::string     lExpected;
+
+    // Outgrow the inline buffer, such that the string is created
+    // from a heap buffer.
+
+    for (int i = 0; i < 1000; i++)
+    {
+        lBuilder.Append("Line ").AppendInteger(i).Append('\n');
+
+        lExpected += "Line " + std::to_string(i) + "\n";
+    }
+
+    Test(lBuilder, lExpected.c_str());
+
+    // The builder is reusable after handing its buffer off.
+
+    lBuilder.Append("Short");
+
+    Test(lBuilder, "Short");
+}
+
+void
+TestCFStringBuilder :: TestReuse(void)
+{
+    CFStringBuilder lBuilder;
+
+    CPPUNIT_ASSERT(lBuilder.Reserve(4096) == true);
+
+    lBuilder.Append("Discarded");
+    lBuilder.Clear();
+
+    CPPUNIT_ASSERT(lBuilder.GetLength() == 0);
+
+    lBuilder.Append("Kept");
+
+    Test(lBuilder, "Kept");
+}
+
+void
+TestCFStringBuilder :: TestInvalid(void)
+{
+    CFStringBuilder lBuilder;
+    CFStringRef     lString;
+
+    lBuilder.Append("Invalid \xff");
+
+    lString = lBuilder.CreateString();
+    CPPUNIT_ASSERT(lString == NULL);
+
+    // As is the case from a heap buffer.
+
+    for (int i = 0; i < 100; i++)
+    {
+        lBuilder.Append("Invalid \xff");
+    }
+
+    lString = lBuilder.CreateString();
+    CPPUNIT_ASSERT(lString == NULL);
+
+    lBuilder.Append("Valid");
+
+    Test(lBuilder, "Valid");
+}
@@ -0,0 +1,198 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a multi-threaded stress test for the
+ *      CFString encoding buffer cache.
+ */
+
+#include <CFUtilities/CFString.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFStringConcurrency :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFStringConcurrency);
+    CPPUNIT_TEST(TestSharedReaders);
+    CPPUNIT_TEST(TestRepeatedRaces);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestSharedReaders(void);
+    void TestRepeatedRaces(void);
+
+    void setUp(void);
+    void tearDown(void);
+
+private:
+    static const size_t kThreads       = 8;
+    static const size_t kEncodingCount = 4;
+    static const size_t kIterations    = 10000;
+
+    struct Result
+    {
+        const char * mPointers[kEncodingCount];
+        bool         mConsistent;
+    };
+
+    static void Reader(const CFString * inString,
+                       size_t           inIterations,
+                       Result *         outResult);
+
+    void Run(const CFString & inString, size_t inIterations);
+
+    CFStringRef mCFString;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFStringConcurrency);
+
+/*
+ * A non-ASCII string, "Teststräng", is used so that CoreFoundation is
+ * unlikely to have an O(1) representation for any of the encodings
+ * and the encoding buffer cache is exercised.
+ */
+static const UInt8            kUTF8Bytes[]     = { 'T', 'e', 's', 't',
+                                                   's', 't', 'r',
+                                                   0xc3, 0xa4,
+                                                   'n', 'g' };
+static const CFStringEncoding kEncodings[]     = { kCFStringEncodingUTF8,
+                                                   kCFStringEncodingMacRoman,
+                                                   kCFStringEncodingISOLatin1,
+                                                   kCFStringEncodingWindowsLatin1 };
+static const UInt8            kExpected[][12]  = { { 'T', 'e', 's', 't', 's', 't', 'r', 0xc3, 0xa4, 'n', 'g', 0 },
+                                                   { 'T', 'e', 's', 't', 's', 't', 'r', 0x8a, 'n', 'g', 0 },
+                                                   { 'T', 'e', 's', 't', 's', 't', 'r', 0xe4, 'n', 'g', 0 },
+                                                   { 'T', 'e', 's', 't', 's', 't', 'r', 0xe4, 'n', 'g', 0 } };
+
+void
+TestCFStringConcurrency :: setUp(void)
+{
+    const bool kIsExternalRepresentation = true;
+
+    mCFString = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                        &kUTF8Bytes[0],
+                                        sizeof (kUTF8Bytes),
+                                        kCFStringEncodingUTF8,
+                                        !kIsExternalRepresentation);
+    CPPUNIT_ASSERT(mCFString != NULL);
+}
+
+void
+TestCFStringConcurrency :: tearDown(void)
+{
+    CFRelease(mCFString);
+}
+
+void
+TestCFStringConcurrency :: Reader(const CFString * inString,
+                                  size_t           inIterations,
+                                  Result *         outResult)
+{
+    outResult->mConsistent = true;
+
+    for (size_t i = 0; i < kEncodingCount; i++)
+    {
+        outResult->mPointers[i] = NULL;
+    }
+
+    for (size_t lIteration = 0; lIteration < inIterations; lIteration++)
+    {
+        // Vary the order in which encodings are requested across
+        // iterations to maximize the chance of racing publications.
+
+        for (size_t i = 0; i < kEncodingCount; i++)
+        {
+            const size_t lIndex   = (i + lIteration) % kEncodingCount;
+            const char * lCString = inString->GetCString(kEncodings[lIndex]);
+
+            if ((lCString == NULL) ||
+                (strcmp(lCString, reinterpret_cast<const char *>(kExpected[lIndex])) != 0))
+            {
+                outResult->mConsistent = false;
+            }
+            else if (outResult->mPointers[lIndex] == NULL)
+            {
+                outResult->mPointers[lIndex] = lCString;
+            }
+            else if (outResult->mPointers[lIndex] != lCString)
+            {
+                outResult->mConsistent = false;
+            }
+        }
+    }
+}
+
+void
+TestCFStringConcurrency :: Run(const CFString & inString, size_t inIterations)
+{
+    std::vector<std::thread> lThreads;
+    Result                   lResults[kThreads];
+
+    for (size_t i = 0; i < kThreads; i++)
+    {
+        lThreads.push_back(std::thread(Reader, &inString, inIterations, &lResults[i]));
+    }
+
+    for (size_t i = 0; i < kThreads; i++)
+    {
+        lThreads[i].join();
+    }
+
+    // Every thread must have seen correct content and, for each
+    // encoding, the very same published buffer throughout.
+
+    for (size_t i = 0; i < kThreads; i++)
+    {
+        CPPUNIT_ASSERT(lResults[i].mConsistent);
+
+        for (size_t j = 0; j < kEncodingCount; j++)
+        {
+            CPPUNIT_ASSERT(lResults[i].mPointers[j] == lResults[0].mPointers[j]);
+        }
+    }
+}
+
+void
+TestCFStringConcurrency :: TestSharedReaders(void)
+{
+    const CFString lString(mCFString);
+
+    Run(lString, kIterations);
+}
+
+void
+TestCFStringConcurrency :: TestRepeatedRaces(void)
+{
+    // Use a fresh, empty cache for each round such that every round
+    // races to publish each encoding.
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        const CFString lString(mCFString);
+
+        Run(lString, 1);
+    }
+}
@@ -0,0 +1,329 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFStringSplitter.
+ */
+
+#include <CFUtilities/CFString.hpp>
+
+#include <string>
+#include <vector>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFStringSplitter :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFStringSplitter);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestEmpty);
+    CPPUNIT_TEST(TestSplit);
+    CPPUNIT_TEST(TestSkipEmpty);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST(TestIterator);
+    CPPUNIT_TEST(TestMany);
+#if __cplusplus >= 201703L
+    CPPUNIT_TEST(TestViews);
+#endif
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestEmpty(void);
+    void TestSplit(void);
+    void TestSkipEmpty(void);
+    void TestNonASCII(void);
+    void TestIterator(void);
+    void TestMany(void);
+#if __cplusplus >= 201703L
+    void TestViews(void);
+#endif
+
+private:
+    static void TestPieces(CFStringSplitter &           aSplitter,
+                           const std::vector<CFRange> & aExpected);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFStringSplitter);
+
+void
+TestCFStringSplitter :: TestPieces(CFStringSplitter &           aSplitter,
+                                   const std::vector<CFRange> & aExpected)
+{
+    CFRange lRange;
+    bool    lStatus;
+
+    for (size_t i = 0; i < aExpected.size(); i++)
+    {
+        lStatus = aSplitter.Next(lRange);
+        CPPUNIT_ASSERT(lStatus == true);
+        CPPUNIT_ASSERT(lRange.location == aExpected[i].location);
+        CPPUNIT_ASSERT(lRange.length == aExpected[i].length);
+    }
+
+    lStatus = aSplitter.Next(lRange);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    // Once exhausted, it stays so.
+
+    lStatus = aSplitter.Next(lRange);
+    CPPUNIT_ASSERT(lStatus == false);
+}
+
+void
+TestCFStringSplitter :: TestNull(void)
+{
+    CFStringSplitter lSplitter(NULL, '/');
+
+    TestPieces(lSplitter, std::vector<CFRange>());
+
+    CPPUNIT_ASSERT(lSplitter.CreateString(CFRangeMake(0, 0)) == NULL);
+}
+
+void
+TestCFStringSplitter :: TestEmpty(void)
+{
+    CFStringSplitter lSplitter(CFSTR(""), '/');
+    CFStringSplitter lTokenizer(CFSTR(""), '/', true);
+
+    // As with CFStringCreateArrayBySeparatingStrings, an empty
+    // string is a single empty piece.
+
+    TestPieces(lSplitter, { CFRangeMake(0, 0) });
+    TestPieces(lTokenizer, std::vector<CFRange>());
+}
+
+void
+TestCFStringSplitter :: TestSplit(void)
+{
+    CFStringSplitter lSplitter(CFSTR("/usr//local/"), '/');
+    CFStringSplitter lUnseparated(CFSTR("usr"), '/');
+    CFStringRef      lString;
+
+    TestPieces(lSplitter, { CFRangeMake(0, 0),
+                            CFRangeMake(1, 3),
+                            CFRangeMake(5, 0),
+                            CFRangeMake(6, 5),
+                            CFRangeMake(12, 0) });
+
+    TestPieces(lUnseparated, { CFRangeMake(0, 3) });
+
+    // Pieces are only created as strings on request.
+
+    lString = lSplitter.CreateString(CFRangeMake(6, 5));
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringCompare(lString, CFSTR("local"), 0) == kCFCompareEqualTo);
+
+    CFRelease(lString);
+
+    // Splitting may be restarted.
+
+    lSplitter.Reset();
+
+    TestPieces(lSplitter, { CFRangeMake(0, 0),
+                            CFRangeMake(1, 3),
+                            CFRangeMake(5, 0),
+                            CFRangeMake(6, 5),
+                            CFRangeMake(12, 0) });
+}
+
+void
+TestCFStringSplitter :: TestSkipEmpty(void)
+{
+    CFStringSplitter lTokenizer(CFSTR("/usr//local/"), '/', true);
+    CFStringSplitter lSeparators(CFSTR("///"), '/', true);
+
+    TestPieces(lTokenizer, { CFRangeMake(1, 3),
+                             CFRangeMake(6, 5) });
+
+    TestPieces(lSeparators, std::vector<CFRange>());
+}
+
+void
+TestCFStringSplitter :: TestNonASCII(void)
+{
+    static const UniChar kCharacters[] = { 0x00e4, ',', 0x20ac, 0x20ac, ',', 'a' };
+    CFStringRef          lString;
+    CFMutableStringRef   lMutableString;
+
+    // Whatever the backing store, the separator is found.
+
+    lString = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                           kCharacters,
+                                           sizeof (kCharacters) / sizeof (kCharacters[0]));
+    CPPUNIT_ASSERT(lString != NULL);
+
+    {
+        CFStringSplitter lSplitter(lString, ',');
+        CFStringSplitter lEuroSplitter(lString, 0x20ac);
+
+        TestPieces(lSplitter, { CFRangeMake(0, 1),
+                                CFRangeMake(2, 2),
+                                CFRangeMake(5, 1) });
+
+        TestPieces(lEuroSplitter, { CFRangeMake(0, 2),
+                                    CFRangeMake(3, 0),
+                                    CFRangeMake(4, 2) });
+    }
+
+    lMutableString = CFStringCreateMutableCopy(kCFAllocatorDefault, 0, lString);
+    CPPUNIT_ASSERT(lMutableString != NULL);
+
+    {
+        CFMutableString  lObject(lMutableString);
+        CFStringSplitter lSplitter(lObject, ',');
+
+        TestPieces(lSplitter, { CFRangeMake(0, 1),
+                                CFRangeMake(2, 2),
+                                CFRangeMake(5, 1) });
+    }
+
+    CFRelease(lMutableString);
+    CFRelease(lString);
+
+    // An ISO Latin-1 string, with a separator beyond ASCII.
+
+    lString = CFStringCreateWithCString(kCFAllocatorDefault,
+                                        "a\xe4" "b\xe4",
+                                        kCFStringEncodingISOLatin1);
+    CPPUNIT_ASSERT(lString != NULL);
+
+    {
+        CFStringSplitter lSplitter(lString, 0x00e4);
+
+        TestPieces(lSplitter, { CFRangeMake(0, 1),
+                                CFRangeMake(2, 1),
+                                CFRangeMake(4, 0) });
+    }
+
+    CFRelease(lString);
+}
+
+void
+TestCFStringSplitter :: TestIterator(void)
+{
+    CFString             lString(CFSTR("a.bc.def"));
+    CFStringSplitter     lSplitter(lString, '.');
+    std::vector<CFIndex> lLengths;
+
+    for (const CFRange & lRange : lSplitter)
+    {
+        lLengths.push_back(lRange.length);
+    }
+
+    CPPUNIT_ASSERT(lLengths.size() == 3);
+    CPPUNIT_ASSERT(lLengths[0] == 1);
+    CPPUNIT_ASSERT(lLengths[1] == 2);
+    CPPUNIT_ASSERT(lLengths[2] == 3);
+
+    // Iterating again restarts from the beginning.
+
+    lLengths.clear();
+
+    for (CFStringSplitter::Iterator lIterator = lSplitter.begin();
+         lIterator != lSplitter.end();
+         ++lIterator)
+    {
+        lLengths.push_back(lIterator->length);
+    }
+
+    CPPUNIT_ASSERT(lLengths.size() == 3);
+}
+
+void
+TestCFStringSplitter :: TestMany(void)
+{
+    static const size_t kSegments = 10000;
+    std::string         lPath;
+    CFStringRef         lString;
+    size_t              lCount = 0;
+    CFIndex             lTotal = 0;
+
+    for (size_t i = 0; i < kSegments; i++)
+    {
+        lPath += "/segment";
+    }
+
+    lString = CFStringCreateWithCString(kCFAllocatorDefault, lPath.c_str(), kCFStringEncodingUTF8);
+    CPPUNIT_ASSERT(lString != NULL);
+
+    {
+        CFStringSplitter lSplitter(lString, '/', true);
+
+        for (const CFRange & lRange : lSplitter)
+        {
+            lCount++;
+            lTotal += lRange.length;
+        }
+    }
+
+    CPPUNIT_ASSERT(lCount == kSegments);
+    CPPUNIT_ASSERT(lTotal == static_cast<CFIndex>(kSegments * 7));
+
+    CFRelease(lString);
+}
+
+#if __cplusplus >= 201703L
+void
+TestCFStringSplitter :: TestViews(void)
+{
+    static const UniChar kCharacters[] = { 0x00e4, ',', 'b' };
+    CFStringRef          lString;
+    std::string_view     lView;
+    std::u16string_view  lCharacters;
+
+    {
+        CFStringSplitter lSplitter(CFSTR("key.path"), '.');
+
+        // A view is only available when CoreFoundation stores the
+        // string as ASCII, but must agree with it when it is.
+
+        lView = lSplitter.GetStringView(CFRangeMake(4, 4));
+
+        if (lView.data() != NULL)
+        {
+            CPPUNIT_ASSERT(lView == "path");
+        }
+    }
+
+    lString = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                           kCharacters,
+                                           sizeof (kCharacters) / sizeof (kCharacters[0]));
+    CPPUNIT_ASSERT(lString != NULL);
+
+    {
+        CFStringSplitter lSplitter(lString, ',');
+
+        lView = lSplitter.GetStringView(CFRangeMake(0, 1));
+        CPPUNIT_ASSERT(lView.data() == NULL);
+
+        lCharacters = lSplitter.GetCharactersView(CFRangeMake(0, 1));
+
+        if (lCharacters.data() != NULL)
+        {
+            CPPUNIT_ASSERT(lCharacters.size() == 1);
+            CPPUNIT_ASSERT(lCharacters[0] == 0x00e4);
+        }
+    }
+
+    CFRelease(lString);
+}
+#endif
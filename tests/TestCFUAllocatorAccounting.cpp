@@ -0,0 +1,538 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFUAllocatorAccountingCreate
+ *      and the accounting allocator statistics interfaces, as well as
+ *      allocation budgets for the dictionary merge and difference and
+ *      property list descriptor interfaces measured with them.
+ */
+
+#include <CFUtilities/CFUtilities.h>
+
+#include <thread>
+
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUAllocatorAccounting :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUAllocatorAccounting);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestCounts);
+    CPPUNIT_TEST(TestReset);
+    CPPUNIT_TEST(TestThread);
+    CPPUNIT_TEST(TestDefault);
+    CPPUNIT_TEST(TestMergeBudget);
+    CPPUNIT_TEST(TestDifferenceBudget);
+    CPPUNIT_TEST(TestPropertyListBudget);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestCounts(void);
+    void TestReset(void);
+    void TestThread(void);
+    void TestDefault(void);
+    void TestMergeBudget(void);
+    void TestDifferenceBudget(void);
+    void TestPropertyListBudget(void);
+
+private:
+    static const size_t  kIterations = 1000;
+    static const CFIndex kEntries    = 1000;
+
+    static void Allocate(CFAllocatorRef inAccounting, CFUAllocatorStatistics * outStatistics);
+    static CFMutableDictionaryRef CreateDictionary(CFIndex inCount);
+    template <typename Operation>
+    static uint64_t CountAllocations(CFAllocatorRef inAccounting, Operation inOperation);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUAllocatorAccounting);
+
+void
+TestCFUAllocatorAccounting :: TestNull(void)
+{
+    CFUAllocatorStatistics lStatistics;
+    CFAllocatorRef         lAccounting;
+    Boolean                lStatus;
+
+    lStatus = CFUAllocatorAccountingGetStatistics(NULL, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUAllocatorAccountingResetStatistics(NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    // Other allocators are not accounting allocators.
+
+    lStatus = CFUAllocatorAccountingGetStatistics(kCFAllocatorMalloc, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    CFRelease(lAccounting);
+}
+
+void
+TestCFUAllocatorAccounting :: TestCounts(void)
+{
+    CFUAllocatorStatistics lStatistics;
+    CFAllocatorRef         lAccounting;
+    char *                 lFirst;
+    char *                 lSecond;
+    Boolean                lStatus;
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mAllocations == 0);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive == 0);
+
+    lFirst = static_cast<char *>(CFAllocatorAllocate(lAccounting, 100, 0));
+    CPPUNIT_ASSERT(lFirst != NULL);
+
+    lSecond = static_cast<char *>(CFAllocatorAllocate(lAccounting, 50, 0));
+    CPPUNIT_ASSERT(lSecond != NULL);
+
+    memset(lFirst, 'a', 100);
+
+    // Reallocation preserves the contents and accounts for the
+    // growth alone.
+
+    lFirst = static_cast<char *>(CFAllocatorReallocate(lAccounting, lFirst, 300, 0));
+    CPPUNIT_ASSERT(lFirst != NULL);
+    CPPUNIT_ASSERT(lFirst[99] == 'a');
+
+    CFAllocatorDeallocate(lAccounting, lSecond);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mAllocations == 2);
+    CPPUNIT_ASSERT(lStatistics.mDeallocations == 1);
+    CPPUNIT_ASSERT(lStatistics.mReallocations == 1);
+    CPPUNIT_ASSERT(lStatistics.mBytesAllocated == 350);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive == 300);
+    CPPUNIT_ASSERT(lStatistics.mBytesPeak == 350);
+
+    CFAllocatorDeallocate(lAccounting, lFirst);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mDeallocations == 2);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive == 0);
+    CPPUNIT_ASSERT(lStatistics.mBytesPeak == 350);
+
+    CFRelease(lAccounting);
+}
+
+void
+TestCFUAllocatorAccounting :: TestReset(void)
+{
+    CFUAllocatorStatistics lStatistics;
+    CFAllocatorRef         lAccounting;
+    void *                 lPointer;
+    Boolean                lStatus;
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    lPointer = CFAllocatorAllocate(lAccounting, 64, 0);
+    CPPUNIT_ASSERT(lPointer != NULL);
+
+    CFAllocatorDeallocate(lAccounting, CFAllocatorAllocate(lAccounting, 256, 0));
+
+    // The counts are zeroed, but the outstanding allocation remains
+    // live and the peak restarts from it.
+
+    lStatus = CFUAllocatorAccountingResetStatistics(lAccounting);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mAllocations == 0);
+    CPPUNIT_ASSERT(lStatistics.mDeallocations == 0);
+    CPPUNIT_ASSERT(lStatistics.mBytesAllocated == 0);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive == 64);
+    CPPUNIT_ASSERT(lStatistics.mBytesPeak == 64);
+
+    CFAllocatorDeallocate(lAccounting, lPointer);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mDeallocations == 1);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive == 0);
+
+    CFRelease(lAccounting);
+}
+
+void
+TestCFUAllocatorAccounting :: Allocate(CFAllocatorRef inAccounting, CFUAllocatorStatistics * outStatistics)
+{
+    CFUAllocatorAccountingResetThreadStatistics();
+
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        CFAllocatorDeallocate(inAccounting, CFAllocatorAllocate(inAccounting, 32, 0));
+    }
+
+    CFUAllocatorAccountingGetThreadStatistics(outStatistics);
+}
+
+void
+TestCFUAllocatorAccounting :: TestThread(void)
+{
+    CFUAllocatorStatistics lStatistics;
+    CFUAllocatorStatistics lOther;
+    CFAllocatorRef         lAccounting;
+    void *                 lPointer;
+    std::thread            lThread;
+    Boolean                lStatus;
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    CFUAllocatorAccountingResetThreadStatistics();
+
+    lPointer = CFAllocatorAllocate(lAccounting, 128, 0);
+    CPPUNIT_ASSERT(lPointer != NULL);
+
+    // Another thread's requests are counted for the allocator, but
+    // not for this thread.
+
+    lThread = std::thread(Allocate, lAccounting, &lOther);
+    lThread.join();
+
+    CPPUNIT_ASSERT(lOther.mAllocations == kIterations);
+    CPPUNIT_ASSERT(lOther.mDeallocations == kIterations);
+    CPPUNIT_ASSERT(lOther.mBytesAllocated == kIterations * 32);
+    CPPUNIT_ASSERT(lOther.mBytesLive == 0);
+    CPPUNIT_ASSERT(lOther.mBytesPeak == 32);
+
+    CFUAllocatorAccountingGetThreadStatistics(&lStatistics);
+    CPPUNIT_ASSERT(lStatistics.mAllocations == 1);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive == 128);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mAllocations == kIterations + 1);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive == 128);
+
+    CFAllocatorDeallocate(lAccounting, lPointer);
+
+    CFRelease(lAccounting);
+}
+
+void
+TestCFUAllocatorAccounting :: TestDefault(void)
+{
+    const void *           lKeys[]   = { CFSTR("Key 1"), CFSTR("Key 2") };
+    const void *           lValues[] = { CFSTR("Value 1"), CFSTR("Value 2") };
+    CFUAllocatorStatistics lStatistics;
+    CFAllocatorRef         lPrevious;
+    CFAllocatorRef         lAccounting;
+    CFDictionaryRef        lDictionary;
+    CFArrayRef             lArray;
+    Boolean                lStatus;
+
+    lDictionary = CFDictionaryCreate(kCFAllocatorDefault,
+                                     lKeys,
+                                     lValues,
+                                     2,
+                                     &kCFTypeDictionaryKeyCallBacks,
+                                     &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lDictionary != NULL);
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorDefault);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    // Made the default, the accounting allocator counts the
+    // allocations of interfaces that use the default allocator.
+
+    lPrevious = static_cast<CFAllocatorRef>(CFRetain(CFAllocatorGetDefault()));
+
+    CFAllocatorSetDefault(lAccounting);
+
+    lArray = CFUDictionaryCopyKeys(lDictionary);
+
+    CFAllocatorSetDefault(lPrevious);
+
+    CPPUNIT_ASSERT(lArray != NULL);
+    CPPUNIT_ASSERT(CFArrayGetCount(lArray) == 2);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mAllocations > 0);
+    CPPUNIT_ASSERT(lStatistics.mBytesLive > 0);
+
+    CFRelease(lArray);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lStatistics.mDeallocations > 0);
+
+    CFRelease(lPrevious);
+    CFRelease(lAccounting);
+    CFRelease(lDictionary);
+}
+
+/*
+ * A dictionary of the specified count of numbers keyed by their
+ * decimal strings, created with the current default allocator.
+ */
+CFMutableDictionaryRef
+TestCFUAllocatorAccounting :: CreateDictionary(CFIndex inCount)
+{
+    CFMutableDictionaryRef lDictionary;
+
+    lDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                            0,
+                                            &kCFTypeDictionaryKeyCallBacks,
+                                            &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lDictionary != NULL);
+
+    for (CFIndex i = 0; i < inCount; i++)
+    {
+        CFStringRef lKey   = CFStringCreateWithFormat(kCFAllocatorDefault, NULL, CFSTR("%ld"), static_cast<long>(i));
+        CFNumberRef lValue = CFNumberCreate(kCFAllocatorDefault, kCFNumberCFIndexType, &i);
+
+        CFDictionarySetValue(lDictionary, lKey, lValue);
+
+        CFRelease(lValue);
+        CFRelease(lKey);
+    }
+
+    return (lDictionary);
+}
+
+/*
+ * Return the allocations, including reallocations, made through the
+ * specified accounting allocator, made the default for the
+ * duration, by the specified operation.
+ */
+template <typename Operation>
+uint64_t
+TestCFUAllocatorAccounting :: CountAllocations(CFAllocatorRef inAccounting, Operation inOperation)
+{
+    CFUAllocatorStatistics lStatistics;
+    CFAllocatorRef         lPrevious;
+    Boolean                lStatus;
+
+    lPrevious = static_cast<CFAllocatorRef>(CFRetain(CFAllocatorGetDefault()));
+
+    CFAllocatorSetDefault(inAccounting);
+
+    lStatus = CFUAllocatorAccountingResetStatistics(inAccounting);
+
+    inOperation();
+
+    CFAllocatorSetDefault(lPrevious);
+
+    CFRelease(lPrevious);
+
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lStatus = CFUAllocatorAccountingGetStatistics(inAccounting, &lStatistics);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    return (lStatistics.mAllocations + lStatistics.mReallocations);
+}
+
+void
+TestCFUAllocatorAccounting :: TestMergeBudget(void)
+{
+    CFMutableDictionaryRef lSource;
+    CFMutableDictionaryRef lPresent;
+    CFMutableDictionaryRef lDestination = NULL;
+    CFAllocatorRef         lAccounting;
+    uint64_t               lAllocations;
+    Boolean                lStatus      = false;
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    lSource  = CreateDictionary(kEntries);
+    lPresent = CreateDictionary(kEntries);
+
+    // Merging keys that are all present allocates nothing, whether
+    // their values are kept or replaced.
+
+    lAllocations = CountAllocations(lAccounting, [&]() {
+        lStatus = CFUDictionaryMerge(lPresent, lSource, false);
+    });
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lAllocations == 0);
+
+    lAllocations = CountAllocations(lAccounting, [&]() {
+        lStatus = CFUDictionaryMerge(lPresent, lSource, true);
+    });
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lAllocations == 0);
+
+    // Merging keys that are all new allocates only as the
+    // destination grows, which is amortized over its entries.
+
+    lAllocations = CountAllocations(lAccounting, [&]() {
+        lDestination = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                                 0,
+                                                 &kCFTypeDictionaryKeyCallBacks,
+                                                 &kCFTypeDictionaryValueCallBacks);
+
+        lStatus = CFUDictionaryMerge(lDestination, lSource, false);
+    });
+    CPPUNIT_ASSERT(lDestination != NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(lDestination) == kEntries);
+    CPPUNIT_ASSERT(lAllocations > 0);
+    CPPUNIT_ASSERT(lAllocations < static_cast<uint64_t>(kEntries / 16));
+
+    CFRelease(lDestination);
+    CFRelease(lPresent);
+    CFRelease(lSource);
+    CFRelease(lAccounting);
+}
+
+void
+TestCFUAllocatorAccounting :: TestDifferenceBudget(void)
+{
+    const CFIndex  lCounts[] = { 10, kEntries };
+    uint64_t       lAllocations[sizeof (lCounts) / sizeof (lCounts[0])];
+    CFAllocatorRef lAccounting;
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    // The allocations made in differencing equal dictionaries, when
+    // their common entries are not requested, do not scale with the
+    // count of entries.
+
+    for (size_t i = 0; i < sizeof (lCounts) / sizeof (lCounts[0]); i++)
+    {
+        CFMutableDictionaryRef lProposed = CreateDictionary(lCounts[i]);
+        CFMutableDictionaryRef lBase     = CreateDictionary(lCounts[i]);
+        CFMutableDictionaryRef lAdded    = CreateDictionary(0);
+        CFMutableDictionaryRef lRemoved  = CreateDictionary(0);
+        Boolean                lStatus   = false;
+
+        lAllocations[i] = CountAllocations(lAccounting, [&]() {
+            lStatus = CFUDictionaryDifferenceWithAllocator(lAccounting,
+                                                           lProposed,
+                                                           &lBase,
+                                                           lAdded,
+                                                           NULL,
+                                                           lRemoved);
+        });
+        CPPUNIT_ASSERT(lStatus == true);
+        CPPUNIT_ASSERT(CFDictionaryGetCount(lAdded) == 0);
+        CPPUNIT_ASSERT(CFDictionaryGetCount(lRemoved) == 0);
+
+        CFRelease(lRemoved);
+        CFRelease(lAdded);
+        CFRelease(lBase);
+        CFRelease(lProposed);
+    }
+
+    CPPUNIT_ASSERT(lAllocations[1] == lAllocations[0]);
+
+    CFRelease(lAccounting);
+}
+
+void
+TestCFUAllocatorAccounting :: TestPropertyListBudget(void)
+{
+    const size_t           lBufferSizes[] = { 0, 16 };
+    uint64_t               lWrites[sizeof (lBufferSizes) / sizeof (lBufferSizes[0])];
+    uint64_t               lReads[sizeof (lBufferSizes) / sizeof (lBufferSizes[0])];
+    int64_t                lLive[sizeof (lBufferSizes) / sizeof (lBufferSizes[0])];
+    CFUAllocatorStatistics lStatistics;
+    CFMutableDictionaryRef lDictionary;
+    CFAllocatorRef         lAccounting;
+
+    lAccounting = CFUAllocatorAccountingCreate(kCFAllocatorDefault, kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lAccounting != NULL);
+
+    // Small enough that its XML representation fits within a pipe's
+    // buffer.
+
+    lDictionary = CreateDictionary(100);
+
+    for (size_t i = 0; i < sizeof (lBufferSizes) / sizeof (lBufferSizes[0]); i++)
+    {
+        CFPropertyListRef lPlist  = NULL;
+        Boolean           lStatus = false;
+        int               lDescriptors[2];
+        int               lResult;
+
+        lResult = pipe(lDescriptors);
+        CPPUNIT_ASSERT(lResult == 0);
+
+        lWrites[i] = CountAllocations(lAccounting, [&]() {
+            lStatus = CFUPropertyListWriteToFD(lDescriptors[1],
+                                               lBufferSizes[i],
+                                               kCFPropertyListXMLFormat_v1_0,
+                                               lDictionary,
+                                               NULL);
+        });
+        CPPUNIT_ASSERT(lStatus == true);
+
+        close(lDescriptors[1]);
+
+        lReads[i] = CountAllocations(lAccounting, [&]() {
+            lStatus = CFUPropertyListReadFromFDWithAllocator(lAccounting,
+                                                             lDescriptors[0],
+                                                             lBufferSizes[i],
+                                                             kCFPropertyListImmutable,
+                                                             NULL,
+                                                             &lPlist,
+                                                             NULL);
+        });
+        CPPUNIT_ASSERT(lStatus == true);
+        CPPUNIT_ASSERT(lPlist != NULL);
+        CPPUNIT_ASSERT(CFEqual(lPlist, lDictionary));
+
+        close(lDescriptors[0]);
+
+        CFRelease(lPlist);
+
+        lStatus = CFUAllocatorAccountingGetStatistics(lAccounting, &lStatistics);
+        CPPUNIT_ASSERT(lStatus == true);
+
+        lLive[i] = lStatistics.mBytesLive;
+    }
+
+    // Neither writing nor reading allocates per chunk transferred
+    // and, once the property list read is released, nothing
+    // allocated in writing or reading it remains live.
+
+    CPPUNIT_ASSERT(lWrites[1] == lWrites[0]);
+    CPPUNIT_ASSERT(lReads[1] == lReads[0]);
+    CPPUNIT_ASSERT(lLive[1] == lLive[0]);
+
+    CFRelease(lDictionary);
+    CFRelease(lAccounting);
+}
@@ -0,0 +1,516 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFUAllocatorArenaCreate
+ *      and CFUAllocatorArenaReset.
+ */
+
+#include <CFUtilities/CFUtilities.h>
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <vector>
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUAllocatorArena :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUAllocatorArena);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestAllocate);
+    CPPUNIT_TEST(TestReallocate);
+    CPPUNIT_TEST(TestReset);
+    CPPUNIT_TEST(TestObjects);
+    CPPUNIT_TEST(TestDifference);
+    CPPUNIT_TEST(TestCopyOnWrite);
+    CPPUNIT_TEST(TestPropertyList);
+    CPPUNIT_TEST(TestLineReader);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestAllocate(void);
+    void TestReallocate(void);
+    void TestReset(void);
+    void TestObjects(void);
+    void TestDifference(void);
+    void TestCopyOnWrite(void);
+    void TestPropertyList(void);
+    void TestLineReader(void);
+
+private:
+    static const size_t kChunkSize = 1024;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUAllocatorArena);
+
+void
+TestCFUAllocatorArena :: TestNull(void)
+{
+    Boolean lStatus;
+
+    lStatus = CFUAllocatorArenaReset(NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    // Other allocators are not arenas and cannot be reset.
+
+    lStatus = CFUAllocatorArenaReset(kCFAllocatorMalloc);
+    CPPUNIT_ASSERT(lStatus == false);
+}
+
+void
+TestCFUAllocatorArena :: TestAllocate(void)
+{
+    CFAllocatorRef lArena;
+    char *         lFirst;
+    char *         lSecond;
+    char *         lLarge;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, kChunkSize);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    // Allocations are suitably aligned and carved consecutively.
+
+    lFirst = static_cast<char *>(CFAllocatorAllocate(lArena, 10, 0));
+    CPPUNIT_ASSERT(lFirst != NULL);
+    CPPUNIT_ASSERT((reinterpret_cast<uintptr_t>(lFirst) % 16) == 0);
+
+    lSecond = static_cast<char *>(CFAllocatorAllocate(lArena, 10, 0));
+    CPPUNIT_ASSERT(lSecond != NULL);
+    CPPUNIT_ASSERT((reinterpret_cast<uintptr_t>(lSecond) % 16) == 0);
+    CPPUNIT_ASSERT(lSecond > lFirst);
+
+    memset(lFirst, 'a', 10);
+    memset(lSecond, 'b', 10);
+
+    // Deallocating the most recent allocation makes its storage
+    // immediately available again.
+
+    CFAllocatorDeallocate(lArena, lSecond);
+
+    CPPUNIT_ASSERT(CFAllocatorAllocate(lArena, 10, 0) == lSecond);
+
+    // An allocation larger than a chunk is still satisfied.
+
+    lLarge = static_cast<char *>(CFAllocatorAllocate(lArena, kChunkSize * 4, 0));
+    CPPUNIT_ASSERT(lLarge != NULL);
+
+    memset(lLarge, 'c', kChunkSize * 4);
+
+    CPPUNIT_ASSERT(lFirst[9] == 'a');
+
+    CFAllocatorDeallocate(lArena, lLarge);
+    CFAllocatorDeallocate(lArena, lSecond);
+    CFAllocatorDeallocate(lArena, lFirst);
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUAllocatorArena :: TestReallocate(void)
+{
+    CFAllocatorRef lArena;
+    char *         lFirst;
+    char *         lSecond;
+    char *         lResult;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, kChunkSize);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    lFirst = static_cast<char *>(CFAllocatorAllocate(lArena, 16, 0));
+    CPPUNIT_ASSERT(lFirst != NULL);
+
+    lSecond = static_cast<char *>(CFAllocatorAllocate(lArena, 16, 0));
+    CPPUNIT_ASSERT(lSecond != NULL);
+
+    memset(lFirst, 'a', 16);
+    memset(lSecond, 'b', 16);
+
+    // The most recent allocation grows in place.
+
+    lResult = static_cast<char *>(CFAllocatorReallocate(lArena, lSecond, 64, 0));
+    CPPUNIT_ASSERT(lResult == lSecond);
+    CPPUNIT_ASSERT(lResult[15] == 'b');
+
+    // Any other moves, preserving its contents.
+
+    lResult = static_cast<char *>(CFAllocatorReallocate(lArena, lFirst, 64, 0));
+    CPPUNIT_ASSERT(lResult != NULL);
+    CPPUNIT_ASSERT(lResult != lFirst);
+    CPPUNIT_ASSERT(lResult[0] == 'a');
+    CPPUNIT_ASSERT(lResult[15] == 'a');
+
+    CFAllocatorDeallocate(lArena, lResult);
+    CFAllocatorDeallocate(lArena, lSecond);
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUAllocatorArena :: TestReset(void)
+{
+    CFAllocatorRef      lArena;
+    std::vector<void *> lPointers;
+    void *              lFirst;
+    Boolean             lStatus;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, kChunkSize);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    // A fresh arena may be reset.
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    // Fill several chunks.
+
+    for (size_t i = 0; i < 256; i++)
+    {
+        lPointers.push_back(CFAllocatorAllocate(lArena, 48, 0));
+        CPPUNIT_ASSERT(lPointers.back() != NULL);
+    }
+
+    // With allocations outstanding, the arena is not reset.
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    for (size_t i = 0; i < lPointers.size(); i++)
+    {
+        CFAllocatorDeallocate(lArena, lPointers[i]);
+    }
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    // After a reset, the retained chunk is reused from its start.
+
+    lFirst = CFAllocatorAllocate(lArena, 48, 0);
+    CPPUNIT_ASSERT(lFirst != NULL);
+
+    CFAllocatorDeallocate(lArena, lFirst);
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CPPUNIT_ASSERT(CFAllocatorAllocate(lArena, 48, 0) == lFirst);
+
+    CFAllocatorDeallocate(lArena, lFirst);
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUAllocatorArena :: TestObjects(void)
+{
+    CFAllocatorRef         lArena;
+    CFMutableDictionaryRef lDictionary;
+    CFArrayRef             lKeys;
+    Boolean                lStatus;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, 0);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    // Build and discard a short-lived object graph several times
+    // over, resetting the arena in between.
+
+    for (int i = 0; i < 4; i++)
+    {
+        lDictionary = CFDictionaryCreateMutable(lArena,
+                                                0,
+                                                &kCFTypeDictionaryKeyCallBacks,
+                                                &kCFTypeDictionaryValueCallBacks);
+        CPPUNIT_ASSERT(lDictionary != NULL);
+        CPPUNIT_ASSERT(CFGetAllocator(lDictionary) == lArena);
+
+        for (int j = 0; j < 64; j++)
+        {
+            CFStringRef lKey;
+            CFNumberRef lValue;
+
+            lKey = CFStringCreateWithFormat(lArena, NULL, CFSTR("Key %d"), j);
+            CPPUNIT_ASSERT(lKey != NULL);
+
+            lValue = CFNumberCreate(lArena, kCFNumberIntType, &j);
+            CPPUNIT_ASSERT(lValue != NULL);
+
+            CFDictionarySetValue(lDictionary, lKey, lValue);
+
+            CFRelease(lValue);
+            CFRelease(lKey);
+        }
+
+        lKeys = CFUDictionaryCopyKeysWithAllocator(lArena, lDictionary);
+        CPPUNIT_ASSERT(lKeys != NULL);
+        CPPUNIT_ASSERT(CFGetAllocator(lKeys) == lArena);
+        CPPUNIT_ASSERT(CFArrayGetCount(lKeys) == 64);
+
+        // While the graph is live, the arena must not be reset.
+
+        lStatus = CFUAllocatorArenaReset(lArena);
+        CPPUNIT_ASSERT(lStatus == false);
+
+        CFRelease(lKeys);
+        CFRelease(lDictionary);
+
+        lStatus = CFUAllocatorArenaReset(lArena);
+        CPPUNIT_ASSERT(lStatus == true);
+    }
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUAllocatorArena :: TestDifference(void)
+{
+    const void *           lKeys[]   = { CFSTR("Key 1"), CFSTR("Key 2") };
+    const void *           lValues[] = { CFSTR("Value 1"), CFSTR("Value 2") };
+    CFAllocatorRef         lArena;
+    CFDictionaryRef        lProposed;
+    CFMutableDictionaryRef lBase = NULL;
+    CFMutableDictionaryRef lAdded;
+    Boolean                lStatus;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, 0);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    lProposed = CFDictionaryCreate(kCFAllocatorDefault,
+                                   lKeys,
+                                   lValues,
+                                   2,
+                                   &kCFTypeDictionaryKeyCallBacks,
+                                   &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lProposed != NULL);
+
+    lAdded = CFDictionaryCreateMutable(lArena,
+                                       0,
+                                       &kCFTypeDictionaryKeyCallBacks,
+                                       &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lAdded != NULL);
+
+    // A null base is created with the specified allocator.
+
+    lStatus = CFUDictionaryDifferenceWithAllocator(lArena,
+                                                   lProposed,
+                                                   &lBase,
+                                                   lAdded,
+                                                   NULL,
+                                                   NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lBase != NULL);
+    CPPUNIT_ASSERT(CFGetAllocator(lBase) == lArena);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(lAdded) == 2);
+
+    CFRelease(lBase);
+
+    lBase = NULL;
+
+    CFDictionaryRemoveAllValues(lAdded);
+
+    // As with the C++ interface.
+
+    lStatus = CFUDictionaryDifference(lArena,
+                                      lProposed,
+                                      lBase,
+                                      lAdded,
+                                      NULL,
+                                      NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lBase != NULL);
+    CPPUNIT_ASSERT(CFGetAllocator(lBase) == lArena);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(lAdded) == 2);
+
+    CFRelease(lBase);
+    CFRelease(lAdded);
+    CFRelease(lProposed);
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUAllocatorArena :: TestCopyOnWrite(void)
+{
+    CFAllocatorRef              lArena;
+    CFMutableDictionaryRef      lOriginal;
+    CFUDictionaryCopyOnWriteRef lCopy;
+    CFMutableDictionaryRef      lMutable;
+    CFDictionaryRef             lSnapshot;
+    Boolean                     lStatus;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, 0);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    lOriginal = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                          0,
+                                          &kCFTypeDictionaryKeyCallBacks,
+                                          &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lOriginal != NULL);
+
+    CFDictionarySetValue(lOriginal, CFSTR("Key"), CFSTR("Value"));
+
+    lCopy = CFUDictionaryCopyOnWriteCreateWithAllocator(lArena, lOriginal);
+    CPPUNIT_ASSERT(lCopy != NULL);
+
+    // Clones are created with the specified allocator.
+
+    lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, NULL);
+    CPPUNIT_ASSERT(lMutable != NULL);
+    CPPUNIT_ASSERT(lMutable != lOriginal);
+    CPPUNIT_ASSERT(CFGetAllocator(lMutable) == lArena);
+
+    CFDictionarySetValue(lMutable, CFSTR("Key"), CFSTR("Other Value"));
+
+    lSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(lCopy);
+    CPPUNIT_ASSERT(lSnapshot != NULL);
+    CPPUNIT_ASSERT(CFDictionaryGetValue(lOriginal, CFSTR("Key")) == CFSTR("Value"));
+
+    CFUDictionaryCopyOnWriteDestroy(lCopy);
+    CFRelease(lSnapshot);
+    CFRelease(lOriginal);
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUAllocatorArena :: TestPropertyList(void)
+{
+    CFAllocatorRef         lArena;
+    CFMutableDictionaryRef lDictionary;
+    CFPropertyListRef      lPropertyList;
+    int                    lDescriptors[2];
+    int                    lResult;
+    Boolean                lStatus;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, 0);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    lDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                            0,
+                                            &kCFTypeDictionaryKeyCallBacks,
+                                            &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lDictionary != NULL);
+
+    CFDictionarySetValue(lDictionary, CFSTR("Key"), CFSTR("Value"));
+
+    lResult = pipe(lDescriptors);
+    CPPUNIT_ASSERT(lResult == 0);
+
+    lStatus = CFUPropertyListWriteToFD(lDescriptors[1],
+                                       0,
+                                       kCFPropertyListXMLFormat_v1_0,
+                                       lDictionary,
+                                       NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    close(lDescriptors[1]);
+
+    // The property list is created with the specified allocator.
+
+    lStatus = CFUPropertyListReadFromFDWithAllocator(lArena,
+                                                     lDescriptors[0],
+                                                     0,
+                                                     kCFPropertyListImmutable,
+                                                     NULL,
+                                                     &lPropertyList,
+                                                     NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+    CPPUNIT_ASSERT(CFGetAllocator(lPropertyList) == lArena);
+    CPPUNIT_ASSERT(CFEqual(lPropertyList, lDictionary));
+
+    close(lDescriptors[0]);
+
+    CFRelease(lPropertyList);
+    CFRelease(lDictionary);
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUAllocatorArena :: TestLineReader(void)
+{
+    static const char      kLines[] = "First\nSecond\n";
+    CFAllocatorRef         lArena;
+    CFUStringLineReaderRef lReader;
+    CFStringRef            lLine;
+    int                    lDescriptors[2];
+    int                    lResult;
+    ssize_t                lWritten;
+    bool                   lStatus;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, 0);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    lResult = pipe(lDescriptors);
+    CPPUNIT_ASSERT(lResult == 0);
+
+    lWritten = write(lDescriptors[1], kLines, strlen(kLines));
+    CPPUNIT_ASSERT(lWritten == static_cast<ssize_t>(strlen(kLines)));
+
+    close(lDescriptors[1]);
+
+    lReader = CFUStringLineReaderCreateWithFD(lDescriptors[0], 0);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    // Each line is created with the specified allocator.
+
+    lStatus = CFUStringLineReaderCopyLineWithAllocator(lArena,
+                                                       lReader,
+                                                       kCFStringEncodingUTF8,
+                                                       &lLine);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(CFGetAllocator(lLine) == lArena);
+    CPPUNIT_ASSERT(CFEqual(lLine, CFSTR("First")));
+
+    CFRelease(lLine);
+
+    lStatus = CFUStringLineReaderCopyLineWithAllocator(lArena,
+                                                       lReader,
+                                                       kCFStringEncodingUTF8,
+                                                       &lLine);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(CFGetAllocator(lLine) == lArena);
+    CPPUNIT_ASSERT(CFEqual(lLine, CFSTR("Second")));
+
+    CFRelease(lLine);
+
+    CFUStringLineReaderDestroy(lReader);
+
+    close(lDescriptors[0]);
+
+    lStatus = CFUAllocatorArenaReset(lArena);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CFRelease(lArena);
+}
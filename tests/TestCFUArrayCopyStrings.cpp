@@ -0,0 +1,211 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements a unit test for CFUArrayCopyStrings.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <string>
+#include <vector>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUArrayCopyStrings :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUArrayCopyStrings);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestEmpty);
+    CPPUNIT_TEST(TestStrings);
+    CPPUNIT_TEST(TestRoundTrip);
+    CPPUNIT_TEST(TestNonString);
+    CPPUNIT_TEST(TestUnpairedSurrogate);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestEmpty(void);
+    void TestStrings(void);
+    void TestRoundTrip(void);
+    void TestNonString(void);
+    void TestUnpairedSurrogate(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUArrayCopyStrings);
+
+void
+TestCFUArrayCopyStrings :: TestNull(void)
+{
+    std::string         lBytes("Stale");
+    std::vector<size_t> lOffsets(1, 0);
+    bool                lStatus;
+
+    lStatus = CFUArrayCopyStrings(NULL, lBytes, lOffsets);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lBytes.empty());
+    CPPUNIT_ASSERT(lOffsets.empty());
+}
+
+void
+TestCFUArrayCopyStrings :: TestEmpty(void)
+{
+    CFArrayRef          lArray;
+    std::string         lBytes;
+    std::vector<size_t> lOffsets;
+    bool                lStatus;
+
+    lArray = CFArrayCreate(kCFAllocatorDefault, NULL, 0, &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lArray != NULL);
+
+    lStatus = CFUArrayCopyStrings(lArray, lBytes, lOffsets);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lBytes.empty());
+    CPPUNIT_ASSERT(lOffsets.size() == 1);
+    CPPUNIT_ASSERT(lOffsets[0] == 0);
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUArrayCopyStrings :: TestStrings(void)
+{
+    const UniChar       lCharacters[] = { 'G', 'r', 0x00F6, 0x00DF, 'e' };
+    CFStringRef         lValues[3];
+    CFArrayRef          lArray;
+    std::string         lBytes;
+    std::vector<size_t> lOffsets;
+    bool                lStatus;
+
+    lValues[0] = CFSTR("First");
+    lValues[1] = CFSTR("");
+    lValues[2] = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                              lCharacters,
+                                              sizeof (lCharacters) / sizeof (lCharacters[0]));
+    CPPUNIT_ASSERT(lValues[2] != NULL);
+
+    lArray = CFArrayCreate(kCFAllocatorDefault,
+                           reinterpret_cast<const void **>(lValues),
+                           3,
+                           &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lArray != NULL);
+
+    lStatus = CFUArrayCopyStrings(lArray, lBytes, lOffsets);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    // Both ASCII and non-ASCII strings land, as UTF-8, in the arena.
+
+    CPPUNIT_ASSERT(lBytes == "FirstGr\xc3\xb6\xc3\x9f" "e");
+    CPPUNIT_ASSERT(lOffsets.size() == 4);
+    CPPUNIT_ASSERT(lOffsets[0] == 0);
+    CPPUNIT_ASSERT(lOffsets[1] == 5);
+    CPPUNIT_ASSERT(lOffsets[2] == 5);
+    CPPUNIT_ASSERT(lOffsets[3] == 12);
+
+    CFRelease(lArray);
+    CFRelease(lValues[2]);
+}
+
+void
+TestCFUArrayCopyStrings :: TestRoundTrip(void)
+{
+    std::vector<std::string> lStrings;
+    CFArrayRef               lArray;
+    std::string              lBytes;
+    std::vector<size_t>      lOffsets;
+    bool                     lStatus;
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        lStrings.push_back(std::string(i, (i % 2) ? 'a' : 'z'));
+    }
+
+    lStrings.push_back("\xe2\x82\xac \xf0\x9f\x98\x80");
+
+    lArray = CFUArrayCreateWithStrings(kCFAllocatorDefault, lStrings);
+    CPPUNIT_ASSERT(lArray != NULL);
+
+    lStatus = CFUArrayCopyStrings(lArray, lBytes, lOffsets);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lOffsets.size() == lStrings.size() + 1);
+
+    for (size_t i = 0; i < lStrings.size(); i++)
+    {
+        CPPUNIT_ASSERT(lBytes.compare(lOffsets[i],
+                                      lOffsets[i + 1] - lOffsets[i],
+                                      lStrings[i]) == 0);
+    }
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUArrayCopyStrings :: TestNonString(void)
+{
+    CFTypeRef           lValues[2];
+    CFArrayRef          lArray;
+    std::string         lBytes;
+    std::vector<size_t> lOffsets;
+    bool                lStatus;
+
+    lValues[0] = CFSTR("First");
+    lValues[1] = kCFBooleanTrue;
+
+    lArray = CFArrayCreate(kCFAllocatorDefault, lValues, 2, &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lArray != NULL);
+
+    lStatus = CFUArrayCopyStrings(lArray, lBytes, lOffsets);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lBytes.empty());
+    CPPUNIT_ASSERT(lOffsets.empty());
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUArrayCopyStrings :: TestUnpairedSurrogate(void)
+{
+    // A high surrogate with no low surrogate following it has no
+    // UTF-8 form.
+
+    const UniChar       lCharacters[] = { 'a', 0xD800, 'b' };
+    CFTypeRef           lValues[2];
+    CFArrayRef          lArray;
+    std::string         lBytes;
+    std::vector<size_t> lOffsets;
+    bool                lStatus;
+
+    lValues[0] = CFSTR("First");
+    lValues[1] = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                              lCharacters,
+                                              sizeof (lCharacters) / sizeof (lCharacters[0]));
+    CPPUNIT_ASSERT(lValues[1] != NULL);
+
+    lArray = CFArrayCreate(kCFAllocatorDefault, lValues, 2, &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lArray != NULL);
+
+    lStatus = CFUArrayCopyStrings(lArray, lBytes, lOffsets);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lBytes.empty());
+    CPPUNIT_ASSERT(lOffsets.empty());
+
+    CFRelease(lArray);
+    CFRelease(lValues[1]);
+}
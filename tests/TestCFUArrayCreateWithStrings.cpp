@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements a unit test for CFUArrayCreateWithStrings.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <string>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+#include <vector>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUArrayCreateWithStrings :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUArrayCreateWithStrings);
+    CPPUNIT_TEST(TestEmpty);
+    CPPUNIT_TEST(TestStrings);
+    CPPUNIT_TEST(TestStringViews);
+    CPPUNIT_TEST(TestRange);
+    CPPUNIT_TEST(TestInvalid);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestEmpty(void);
+    void TestStrings(void);
+    void TestStringViews(void);
+    void TestRange(void);
+    void TestInvalid(void);
+
+private:
+    static void Test(CFArrayRef inArray, CFIndex inIndex, CFStringRef inExpected);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUArrayCreateWithStrings);
+
+void
+TestCFUArrayCreateWithStrings :: Test(CFArrayRef  inArray,
+                                      CFIndex     inIndex,
+                                      CFStringRef inExpected)
+{
+    CFStringRef lString;
+
+    lString = static_cast<CFStringRef>(CFArrayGetValueAtIndex(inArray, inIndex));
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringCompare(lString, inExpected, 0) == kCFCompareEqualTo);
+}
+
+void
+TestCFUArrayCreateWithStrings :: TestEmpty(void)
+{
+    const std::vector<std::string> lStrings;
+    CFArrayRef                     lArray;
+
+    lArray = CFUArrayCreateWithStrings(kCFAllocatorDefault, lStrings);
+    CPPUNIT_ASSERT(lArray != NULL);
+    CPPUNIT_ASSERT(CFArrayGetCount(lArray) == 0);
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUArrayCreateWithStrings :: TestStrings(void)
+{
+    std::vector<std::string> lStrings;
+    CFStringRef              lExpected;
+    CFArrayRef               lArray;
+
+    lStrings.push_back("First");
+    lStrings.push_back("");
+    lStrings.push_back("Gr\xc3\xb6\xc3\x9f" "e");
+
+    lArray = CFUArrayCreateWithStrings(kCFAllocatorDefault, lStrings);
+    CPPUNIT_ASSERT(lArray != NULL);
+    CPPUNIT_ASSERT(CFArrayGetCount(lArray) == 3);
+
+    lExpected = CFStringCreateWithCString(kCFAllocatorDefault,
+                                          lStrings[2].c_str(),
+                                          kCFStringEncodingUTF8);
+    CPPUNIT_ASSERT(lExpected != NULL);
+
+    Test(lArray, 0, CFSTR("First"));
+    Test(lArray, 1, CFSTR(""));
+    Test(lArray, 2, lExpected);
+
+    CFRelease(lExpected);
+    CFRelease(lArray);
+}
+
+void
+TestCFUArrayCreateWithStrings :: TestStringViews(void)
+{
+#if __cplusplus >= 201703L
+    const char * const            lBytes = "FirstSecond";
+    std::vector<std::string_view> lStrings;
+    CFArrayRef                    lArray;
+
+    lStrings.push_back(std::string_view(lBytes, 5));
+    lStrings.push_back(std::string_view(lBytes + 5, 6));
+    lStrings.push_back(std::string_view());
+
+    lArray = CFUArrayCreateWithStrings(kCFAllocatorDefault, lStrings);
+    CPPUNIT_ASSERT(lArray != NULL);
+    CPPUNIT_ASSERT(CFArrayGetCount(lArray) == 3);
+
+    Test(lArray, 0, CFSTR("First"));
+    Test(lArray, 1, CFSTR("Second"));
+    Test(lArray, 2, CFSTR(""));
+
+    CFRelease(lArray);
+#endif // __cplusplus >= 201703L
+}
+
+void
+TestCFUArrayCreateWithStrings :: TestRange(void)
+{
+    std::vector<std::string> lStrings;
+    CFArrayRef               lArray;
+
+    lStrings.push_back("First");
+    lStrings.push_back("Second");
+    lStrings.push_back("Third");
+
+    lArray = CFUArrayCreateWithStrings(kCFAllocatorDefault,
+                                       lStrings.begin() + 1,
+                                       lStrings.end());
+    CPPUNIT_ASSERT(lArray != NULL);
+    CPPUNIT_ASSERT(CFArrayGetCount(lArray) == 2);
+
+    Test(lArray, 0, CFSTR("Second"));
+    Test(lArray, 1, CFSTR("Third"));
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUArrayCreateWithStrings :: TestInvalid(void)
+{
+    std::vector<std::string> lStrings;
+    CFArrayRef               lArray;
+
+    lStrings.push_back("Valid");
+    lStrings.push_back("Invalid \xff");
+
+    lArray = CFUArrayCreateWithStrings(kCFAllocatorDefault, lStrings);
+    CPPUNIT_ASSERT(lArray == NULL);
+}
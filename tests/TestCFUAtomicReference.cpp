@@ -0,0 +1,298 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test and multi-threaded stress
+ *      test for CFUAtomicReference.
+ */
+
+#include <CFUtilities/CFUAtomicReference.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUAtomicReference :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUAtomicReference);
+    CPPUNIT_TEST(TestDefaultConstruction);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestSet);
+    CPPUNIT_TEST(TestRetired);
+    CPPUNIT_TEST(TestCopy);
+    CPPUNIT_TEST(TestConcurrent);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestDefaultConstruction(void);
+    void TestConstruction(void);
+    void TestSet(void);
+    void TestRetired(void);
+    void TestCopy(void);
+    void TestConcurrent(void);
+
+private:
+    typedef CFUAtomicReference<CFDictionaryRef> Configuration;
+
+    static const size_t kReaders    = 64;
+    static const size_t kIterations = 1000;
+    static const size_t kUpdates    = 1000;
+
+    static CFDictionaryRef CreateDictionary(int inVersion);
+    static int GetVersion(CFDictionaryRef inDictionary);
+    static void Reader(const Configuration *     inConfiguration,
+                       const std::atomic<bool> * inDone,
+                       bool *                    outConsistent);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUAtomicReference);
+
+CFDictionaryRef
+TestCFUAtomicReference :: CreateDictionary(int inVersion)
+{
+    CFMutableDictionaryRef lRetval;
+    Boolean                lStatus;
+
+    lRetval = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                        0,
+                                        &kCFTypeDictionaryKeyCallBacks,
+                                        &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lRetval != NULL);
+
+    lStatus = CFUDictionarySetNumber(lRetval, CFSTR("Version"), inVersion);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    return (lRetval);
+}
+
+int
+TestCFUAtomicReference :: GetVersion(CFDictionaryRef inDictionary)
+{
+    int lRetval = -1;
+
+    CFUDictionaryGetNumber(inDictionary, CFSTR("Version"), lRetval);
+
+    return (lRetval);
+}
+
+void
+TestCFUAtomicReference :: TestDefaultConstruction(void)
+{
+    Configuration           lConfiguration;
+    Configuration::Snapshot lSnapshot(lConfiguration);
+
+    CPPUNIT_ASSERT(lSnapshot.get() == NULL);
+}
+
+void
+TestCFUAtomicReference :: TestConstruction(void)
+{
+    CFDictionaryRef lDictionary = CreateDictionary(1);
+
+    {
+        Configuration lConfiguration(lDictionary);
+
+        CPPUNIT_ASSERT(CFGetRetainCount(lDictionary) == 2);
+
+        {
+            Configuration::Snapshot lSnapshot(lConfiguration);
+
+            // A snapshot does not retain the reference.
+
+            CPPUNIT_ASSERT(lSnapshot.get() == lDictionary);
+            CPPUNIT_ASSERT(CFGetRetainCount(lDictionary) == 2);
+        }
+    }
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lDictionary) == 1);
+
+    CFRelease(lDictionary);
+}
+
+void
+TestCFUAtomicReference :: TestSet(void)
+{
+    CFDictionaryRef lFirst  = CreateDictionary(1);
+    CFDictionaryRef lSecond = CreateDictionary(2);
+    Configuration   lConfiguration(lFirst);
+
+    // Without snapshots, the previous reference is released at once.
+
+    lConfiguration.Set(lSecond);
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lFirst) == 1);
+    CPPUNIT_ASSERT(CFGetRetainCount(lSecond) == 2);
+
+    {
+        Configuration::Snapshot lSnapshot(lConfiguration);
+
+        CPPUNIT_ASSERT(GetVersion(lSnapshot) == 2);
+    }
+
+    lConfiguration.Set(NULL);
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lSecond) == 1);
+
+    CFRelease(lFirst);
+    CFRelease(lSecond);
+}
+
+void
+TestCFUAtomicReference :: TestRetired(void)
+{
+    CFDictionaryRef lFirst  = CreateDictionary(1);
+    CFDictionaryRef lSecond = CreateDictionary(2);
+    Configuration   lConfiguration(lFirst);
+    size_t          lKept;
+
+    {
+        Configuration::Snapshot lSnapshot(lConfiguration);
+
+        // A reference held by a snapshot is retired, not released,
+        // when replaced, and the snapshot continues to see it.
+
+        lConfiguration.Set(lSecond);
+
+        CPPUNIT_ASSERT(CFGetRetainCount(lFirst) == 2);
+        CPPUNIT_ASSERT(lSnapshot.get() == lFirst);
+        CPPUNIT_ASSERT(GetVersion(lSnapshot) == 1);
+
+        // While new snapshots see the new reference.
+
+        {
+            Configuration::Snapshot lNewSnapshot(lConfiguration);
+
+            CPPUNIT_ASSERT(lNewSnapshot.get() == lSecond);
+        }
+
+        lKept = lConfiguration.Reclaim();
+        CPPUNIT_ASSERT(lKept == 1);
+    }
+
+    // Once the snapshot is gone, it may be released.
+
+    lKept = lConfiguration.Reclaim();
+    CPPUNIT_ASSERT(lKept == 0);
+    CPPUNIT_ASSERT(CFGetRetainCount(lFirst) == 1);
+
+    CFRelease(lFirst);
+    CFRelease(lSecond);
+}
+
+void
+TestCFUAtomicReference :: TestCopy(void)
+{
+    CFDictionaryRef lDictionary = CreateDictionary(1);
+    Configuration   lConfiguration(lDictionary);
+
+    {
+        CFURef<CFDictionaryRef> lCopy = lConfiguration.Copy();
+
+        // A copy retains the reference and outlives its replacement.
+
+        CPPUNIT_ASSERT(lCopy.get() == lDictionary);
+        CPPUNIT_ASSERT(CFGetRetainCount(lDictionary) == 3);
+
+        lConfiguration.Set(NULL);
+
+        CPPUNIT_ASSERT(CFGetRetainCount(lDictionary) == 2);
+        CPPUNIT_ASSERT(GetVersion(lCopy) == 1);
+    }
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lDictionary) == 1);
+
+    CFRelease(lDictionary);
+}
+
+void
+TestCFUAtomicReference :: Reader(const Configuration *     inConfiguration,
+                                 const std::atomic<bool> * inDone,
+                                 bool *                    outConsistent)
+{
+    int lLastVersion = 0;
+
+    *outConsistent = true;
+
+    // Each snapshot must be of a live dictionary, and versions,
+    // published in increasing order, must never go backwards.
+
+    for (size_t i = 0; (i < kIterations) || !inDone->load(); i++)
+    {
+        Configuration::Snapshot lSnapshot(*inConfiguration);
+        const int               lVersion = GetVersion(lSnapshot);
+
+        if (lVersion < lLastVersion)
+        {
+            *outConsistent = false;
+        }
+
+        lLastVersion = lVersion;
+    }
+}
+
+void
+TestCFUAtomicReference :: TestConcurrent(void)
+{
+    CFDictionaryRef          lDictionary = CreateDictionary(0);
+    Configuration            lConfiguration(lDictionary);
+    std::atomic<bool>        lDone(false);
+    std::vector<std::thread> lThreads;
+    bool                     lConsistent[kReaders];
+    size_t                   lKept;
+
+    CFRelease(lDictionary);
+
+    for (size_t i = 0; i < kReaders; i++)
+    {
+        lThreads.push_back(std::thread(Reader, &lConfiguration, &lDone, &lConsistent[i]));
+    }
+
+    for (size_t i = 1; i <= kUpdates; i++)
+    {
+        lDictionary = CreateDictionary(static_cast<int>(i));
+
+        lConfiguration.Set(lDictionary);
+
+        CFRelease(lDictionary);
+    }
+
+    lDone.store(true);
+
+    for (size_t i = 0; i < kReaders; i++)
+    {
+        lThreads[i].join();
+
+        CPPUNIT_ASSERT(lConsistent[i] == true);
+    }
+
+    // With the readers gone, every retired reference is released.
+
+    lKept = lConfiguration.Reclaim();
+    CPPUNIT_ASSERT(lKept == 0);
+
+    {
+        Configuration::Snapshot lSnapshot(lConfiguration);
+
+        CPPUNIT_ASSERT(GetVersion(lSnapshot) == static_cast<int>(kUpdates));
+    }
+}
@@ -0,0 +1,321 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the
+ *      CFUDictionaryCopyOnWrite interfaces.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUDictionaryCopyOnWrite :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUDictionaryCopyOnWrite);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestUnmodified);
+    CPPUNIT_TEST(TestModified);
+    CPPUNIT_TEST(TestSnapshots);
+    CPPUNIT_TEST(TestMissing);
+    CPPUNIT_TEST(TestNonDictionary);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestUnmodified(void);
+    void TestModified(void);
+    void TestSnapshots(void);
+    void TestMissing(void);
+    void TestNonDictionary(void);
+
+    void setUp(void);
+    void tearDown(void);
+
+private:
+    static CFMutableDictionaryRef CreateDictionary(void);
+    static CFTypeRef GetValue(CFDictionaryRef inDictionary,
+                              CFStringRef     inFirst,
+                              CFStringRef     inSecond);
+    static CFArrayRef CreateKeyPath(CFStringRef inFirst,
+                                    CFStringRef inSecond);
+
+    CFMutableDictionaryRef mDictionary;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUDictionaryCopyOnWrite);
+
+void
+TestCFUDictionaryCopyOnWrite :: setUp(void)
+{
+    CFMutableDictionaryRef lFirst;
+    CFMutableDictionaryRef lSecond;
+
+    // { First: { Key: "Old" }, Second: { Key: "Shared" }, Leaf: "Leaf" }
+
+    mDictionary = CreateDictionary();
+    lFirst      = CreateDictionary();
+    lSecond     = CreateDictionary();
+
+    CFDictionarySetValue(lFirst, CFSTR("Key"), CFSTR("Old"));
+    CFDictionarySetValue(lSecond, CFSTR("Key"), CFSTR("Shared"));
+
+    CFDictionarySetValue(mDictionary, CFSTR("First"), lFirst);
+    CFDictionarySetValue(mDictionary, CFSTR("Second"), lSecond);
+    CFDictionarySetValue(mDictionary, CFSTR("Leaf"), CFSTR("Leaf"));
+
+    CFRelease(lFirst);
+    CFRelease(lSecond);
+}
+
+void
+TestCFUDictionaryCopyOnWrite :: tearDown(void)
+{
+    CFRelease(mDictionary);
+}
+
+CFMutableDictionaryRef
+TestCFUDictionaryCopyOnWrite :: CreateDictionary(void)
+{
+    CFMutableDictionaryRef lDictionary;
+
+    lDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                            0,
+                                            &kCFTypeDictionaryKeyCallBacks,
+                                            &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lDictionary != NULL);
+
+    return (lDictionary);
+}
+
+CFTypeRef
+TestCFUDictionaryCopyOnWrite :: GetValue(CFDictionaryRef inDictionary,
+                                         CFStringRef     inFirst,
+                                         CFStringRef     inSecond)
+{
+    CFDictionaryRef lChild;
+
+    lChild = static_cast<CFDictionaryRef>(CFDictionaryGetValue(inDictionary, inFirst));
+    CPPUNIT_ASSERT(lChild != NULL);
+
+    return (CFDictionaryGetValue(lChild, inSecond));
+}
+
+CFArrayRef
+TestCFUDictionaryCopyOnWrite :: CreateKeyPath(CFStringRef inFirst,
+                                              CFStringRef inSecond)
+{
+    const void * lKeys[] = { inFirst, inSecond };
+    CFArrayRef   lKeyPath;
+
+    lKeyPath = CFArrayCreate(kCFAllocatorDefault,
+                             lKeys,
+                             ((inSecond == NULL) ? 1 : 2),
+                             &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lKeyPath != NULL);
+
+    return (lKeyPath);
+}
+
+void
+TestCFUDictionaryCopyOnWrite :: TestNull(void)
+{
+    CFUDictionaryCopyOnWriteRef lCopy;
+    CFMutableDictionaryRef      lMutable;
+    CFDictionaryRef             lSnapshot;
+
+    lCopy = CFUDictionaryCopyOnWriteCreate(NULL);
+    CPPUNIT_ASSERT(lCopy == NULL);
+
+    lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(NULL, NULL);
+    CPPUNIT_ASSERT(lMutable == NULL);
+
+    lSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(NULL);
+    CPPUNIT_ASSERT(lSnapshot == NULL);
+
+    CFUDictionaryCopyOnWriteDestroy(NULL);
+}
+
+void
+TestCFUDictionaryCopyOnWrite :: TestUnmodified(void)
+{
+    CFUDictionaryCopyOnWriteRef lCopy;
+    CFDictionaryRef             lSnapshot;
+
+    lCopy = CFUDictionaryCopyOnWriteCreate(mDictionary);
+    CPPUNIT_ASSERT(lCopy != NULL);
+
+    // Without any mutation, the copy is the original itself.
+
+    lSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(lCopy);
+    CPPUNIT_ASSERT(lSnapshot == mDictionary);
+
+    CFRelease(lSnapshot);
+
+    CFUDictionaryCopyOnWriteDestroy(lCopy);
+}
+
+void
+TestCFUDictionaryCopyOnWrite :: TestModified(void)
+{
+    CFUDictionaryCopyOnWriteRef lCopy;
+    CFArrayRef                  lKeyPath;
+    CFMutableDictionaryRef      lMutable;
+    CFDictionaryRef             lSnapshot;
+
+    lCopy = CFUDictionaryCopyOnWriteCreate(mDictionary);
+    CPPUNIT_ASSERT(lCopy != NULL);
+
+    lKeyPath = CreateKeyPath(CFSTR("First"), NULL);
+
+    lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, lKeyPath);
+    CPPUNIT_ASSERT(lMutable != NULL);
+
+    CFDictionarySetValue(lMutable, CFSTR("Key"), CFSTR("New"));
+
+    // Asking again must yield the same, already-cloned dictionary.
+
+    CPPUNIT_ASSERT(CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, lKeyPath) == lMutable);
+
+    lSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(lCopy);
+    CPPUNIT_ASSERT(lSnapshot != NULL);
+
+    // The original is untouched...
+
+    CPPUNIT_ASSERT(CFEqual(GetValue(mDictionary, CFSTR("First"), CFSTR("Key")), CFSTR("Old")));
+
+    // ...the copy reflects the change...
+
+    CPPUNIT_ASSERT(lSnapshot != mDictionary);
+    CPPUNIT_ASSERT(CFEqual(GetValue(lSnapshot, CFSTR("First"), CFSTR("Key")), CFSTR("New")));
+
+    // ...and everything off the mutated path is shared.
+
+    CPPUNIT_ASSERT(CFDictionaryGetValue(lSnapshot, CFSTR("Second")) ==
+                   CFDictionaryGetValue(mDictionary, CFSTR("Second")));
+    CPPUNIT_ASSERT(CFDictionaryGetValue(lSnapshot, CFSTR("Leaf")) ==
+                   CFDictionaryGetValue(mDictionary, CFSTR("Leaf")));
+
+    CFRelease(lSnapshot);
+    CFRelease(lKeyPath);
+
+    CFUDictionaryCopyOnWriteDestroy(lCopy);
+}
+
+void
+TestCFUDictionaryCopyOnWrite :: TestSnapshots(void)
+{
+    CFUDictionaryCopyOnWriteRef lCopy;
+    CFArrayRef                  lKeyPath;
+    CFMutableDictionaryRef      lMutable;
+    CFDictionaryRef             lFirstSnapshot;
+    CFDictionaryRef             lSecondSnapshot;
+
+    lCopy = CFUDictionaryCopyOnWriteCreate(mDictionary);
+    CPPUNIT_ASSERT(lCopy != NULL);
+
+    lKeyPath = CreateKeyPath(CFSTR("First"), NULL);
+
+    lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, lKeyPath);
+    CPPUNIT_ASSERT(lMutable != NULL);
+
+    CFDictionarySetValue(lMutable, CFSTR("Key"), CFSTR("New"));
+
+    lFirstSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(lCopy);
+    CPPUNIT_ASSERT(lFirstSnapshot != NULL);
+
+    // Mutating after a snapshot must clone anew rather than alter the
+    // snapshot.
+
+    lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, lKeyPath);
+    CPPUNIT_ASSERT(lMutable != NULL);
+
+    CFDictionarySetValue(lMutable, CFSTR("Key"), CFSTR("Newer"));
+
+    lSecondSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(lCopy);
+    CPPUNIT_ASSERT(lSecondSnapshot != NULL);
+
+    CPPUNIT_ASSERT(CFEqual(GetValue(mDictionary, CFSTR("First"), CFSTR("Key")), CFSTR("Old")));
+    CPPUNIT_ASSERT(CFEqual(GetValue(lFirstSnapshot, CFSTR("First"), CFSTR("Key")), CFSTR("New")));
+    CPPUNIT_ASSERT(CFEqual(GetValue(lSecondSnapshot, CFSTR("First"), CFSTR("Key")), CFSTR("Newer")));
+
+    CPPUNIT_ASSERT(CFDictionaryGetValue(lFirstSnapshot, CFSTR("Second")) ==
+                   CFDictionaryGetValue(lSecondSnapshot, CFSTR("Second")));
+
+    CFRelease(lFirstSnapshot);
+    CFRelease(lSecondSnapshot);
+    CFRelease(lKeyPath);
+
+    CFUDictionaryCopyOnWriteDestroy(lCopy);
+}
+
+void
+TestCFUDictionaryCopyOnWrite :: TestMissing(void)
+{
+    CFUDictionaryCopyOnWriteRef lCopy;
+    CFArrayRef                  lKeyPath;
+    CFMutableDictionaryRef      lMutable;
+    CFDictionaryRef             lSnapshot;
+
+    lCopy = CFUDictionaryCopyOnWriteCreate(mDictionary);
+    CPPUNIT_ASSERT(lCopy != NULL);
+
+    lKeyPath = CreateKeyPath(CFSTR("Third"), CFSTR("Fourth"));
+
+    lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, lKeyPath);
+    CPPUNIT_ASSERT(lMutable != NULL);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(lMutable) == 0);
+
+    CFDictionarySetValue(lMutable, CFSTR("Key"), CFSTR("Created"));
+
+    lSnapshot = CFUDictionaryCopyOnWriteCopyDictionary(lCopy);
+    CPPUNIT_ASSERT(lSnapshot != NULL);
+
+    CPPUNIT_ASSERT(CFDictionaryGetValue(mDictionary, CFSTR("Third")) == NULL);
+    CPPUNIT_ASSERT(GetValue(static_cast<CFDictionaryRef>(CFDictionaryGetValue(lSnapshot, CFSTR("Third"))),
+                            CFSTR("Fourth"),
+                            CFSTR("Key")) != NULL);
+
+    CFRelease(lSnapshot);
+    CFRelease(lKeyPath);
+
+    CFUDictionaryCopyOnWriteDestroy(lCopy);
+}
+
+void
+TestCFUDictionaryCopyOnWrite :: TestNonDictionary(void)
+{
+    CFUDictionaryCopyOnWriteRef lCopy;
+    CFArrayRef                  lKeyPath;
+    CFMutableDictionaryRef      lMutable;
+
+    lCopy = CFUDictionaryCopyOnWriteCreate(mDictionary);
+    CPPUNIT_ASSERT(lCopy != NULL);
+
+    lKeyPath = CreateKeyPath(CFSTR("Leaf"), CFSTR("Key"));
+
+    lMutable = CFUDictionaryCopyOnWriteGetMutableDictionary(lCopy, lKeyPath);
+    CPPUNIT_ASSERT(lMutable == NULL);
+
+    CFRelease(lKeyPath);
+
+    CFUDictionaryCopyOnWriteDestroy(lCopy);
+}
@@ -0,0 +1,294 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for
+ *      CFUPropertyListReadFromFD and CFUPropertyListWriteToFD.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUPropertyListFD :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUPropertyListFD);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestEmpty);
+    CPPUNIT_TEST(TestXML);
+    CPPUNIT_TEST(TestBinary);
+    CPPUNIT_TEST(TestDefaultBufferSize);
+    CPPUNIT_TEST(TestWithOptions);
+    CPPUNIT_TEST(TestInputLimit);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestEmpty(void);
+    void TestXML(void);
+    void TestBinary(void);
+    void TestDefaultBufferSize(void);
+    void TestWithOptions(void);
+    void TestInputLimit(void);
+
+    void setUp(void);
+    void tearDown(void);
+
+private:
+    void TestRoundTrip(CFPropertyListFormat inFormat, size_t inBufferSize);
+
+    int                    mDescriptors[2];
+    CFMutableDictionaryRef mDictionary;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUPropertyListFD);
+
+void
+TestCFUPropertyListFD :: setUp(void)
+{
+    CFMutableArrayRef lArray;
+    int               lStatus;
+
+    lStatus = pipe(mDescriptors);
+    CPPUNIT_ASSERT(lStatus == 0);
+
+    mDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                            0,
+                                            &kCFTypeDictionaryKeyCallBacks,
+                                            &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(mDictionary != NULL);
+
+    lArray = CFArrayCreateMutable(kCFAllocatorDefault,
+                                  0,
+                                  &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lArray != NULL);
+
+    CFArrayAppendValue(lArray, CFSTR("First"));
+    CFArrayAppendValue(lArray, CFSTR("Second"));
+
+    CFDictionarySetValue(mDictionary, CFSTR("Array"), lArray);
+    CFDictionarySetValue(mDictionary, CFSTR("String"), CFSTR("String"));
+    CFDictionarySetValue(mDictionary, CFSTR("Boolean"), kCFBooleanTrue);
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUPropertyListFD :: tearDown(void)
+{
+    if (mDescriptors[0] != -1)
+        close(mDescriptors[0]);
+
+    if (mDescriptors[1] != -1)
+        close(mDescriptors[1]);
+
+    CFRelease(mDictionary);
+}
+
+void
+TestCFUPropertyListFD :: TestRoundTrip(CFPropertyListFormat inFormat,
+                                       size_t               inBufferSize)
+{
+    CFPropertyListRef lPropertyList = NULL;
+    bool              lStatus;
+
+    lStatus = CFUPropertyListWriteToFD(mDescriptors[1],
+                                       inBufferSize,
+                                       inFormat,
+                                       mDictionary,
+                                       NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    // Close the write end such that the reader sees end-of-file.
+
+    close(mDescriptors[1]);
+    mDescriptors[1] = -1;
+
+    lStatus = CFUPropertyListReadFromFD(mDescriptors[0],
+                                        inBufferSize,
+                                        kCFPropertyListImmutable,
+                                        NULL,
+                                        &lPropertyList,
+                                        NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+
+    CPPUNIT_ASSERT(CFEqual(lPropertyList, mDictionary));
+
+    CFRelease(lPropertyList);
+}
+
+void
+TestCFUPropertyListFD :: TestNull(void)
+{
+    CFPropertyListRef lPropertyList;
+    bool              lStatus;
+
+    lStatus = CFUPropertyListReadFromFD(-1,
+                                        0,
+                                        kCFPropertyListImmutable,
+                                        NULL,
+                                        &lPropertyList,
+                                        NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUPropertyListReadFromFD(mDescriptors[0],
+                                        0,
+                                        kCFPropertyListImmutable,
+                                        NULL,
+                                        NULL,
+                                        NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUPropertyListWriteToFD(-1,
+                                       0,
+                                       kCFPropertyListXMLFormat_v1_0,
+                                       mDictionary,
+                                       NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUPropertyListWriteToFD(mDescriptors[1],
+                                       0,
+                                       kCFPropertyListXMLFormat_v1_0,
+                                       NULL,
+                                       NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+}
+
+void
+TestCFUPropertyListFD :: TestEmpty(void)
+{
+    CFPropertyListRef lPropertyList = NULL;
+    bool              lStatus;
+
+    close(mDescriptors[1]);
+    mDescriptors[1] = -1;
+
+    lStatus = CFUPropertyListReadFromFD(mDescriptors[0],
+                                        0,
+                                        kCFPropertyListImmutable,
+                                        NULL,
+                                        &lPropertyList,
+                                        NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lPropertyList == NULL);
+}
+
+void
+TestCFUPropertyListFD :: TestXML(void)
+{
+    // Use a deliberately small, odd buffer size to exercise multiple
+    // reads and writes.
+
+    TestRoundTrip(kCFPropertyListXMLFormat_v1_0, 7);
+}
+
+void
+TestCFUPropertyListFD :: TestBinary(void)
+{
+    TestRoundTrip(kCFPropertyListBinaryFormat_v1_0, 7);
+}
+
+void
+TestCFUPropertyListFD :: TestDefaultBufferSize(void)
+{
+    TestRoundTrip(kCFPropertyListBinaryFormat_v1_0, 0);
+}
+
+void
+TestCFUPropertyListFD :: TestWithOptions(void)
+{
+    const CFUPropertyListReadOptions lOptions      = { 1, 0, 0, 0, NULL, 0 };
+    CFPropertyListRef                lPropertyList = NULL;
+    CFStringRef                      lError        = NULL;
+    bool                             lStatus;
+
+    lStatus = CFUPropertyListWriteToFD(mDescriptors[1],
+                                       0,
+                                       kCFPropertyListXMLFormat_v1_0,
+                                       mDictionary,
+                                       NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    close(mDescriptors[1]);
+    mDescriptors[1] = -1;
+
+    // The array nested in the dictionary exceeds a depth of one (1).
+
+    lStatus = CFUPropertyListReadFromFD(mDescriptors[0],
+                                        0,
+                                        kCFPropertyListImmutable,
+                                        &lOptions,
+                                        &lPropertyList,
+                                        &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lPropertyList == NULL);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CFRelease(lError);
+}
+
+void
+TestCFUPropertyListFD :: TestInputLimit(void)
+{
+    const CFUPropertyListReadOptions lOptions      = { 0, 0, 0, 0, NULL, 32 };
+    CFPropertyListRef                lPropertyList = NULL;
+    CFStringRef                      lError        = NULL;
+    char                             lBuffer[4096];
+    ssize_t                          lRemaining;
+    bool                             lStatus;
+
+    lStatus = CFUPropertyListWriteToFD(mDescriptors[1],
+                                       0,
+                                       kCFPropertyListXMLFormat_v1_0,
+                                       mDictionary,
+                                       NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    close(mDescriptors[1]);
+    mDescriptors[1] = -1;
+
+    // The serialized dictionary is far larger than thirty-two (32)
+    // bytes, so the read should fail after consuming just one byte
+    // past the limit.
+
+    lStatus = CFUPropertyListReadFromFD(mDescriptors[0],
+                                        0,
+                                        kCFPropertyListImmutable,
+                                        &lOptions,
+                                        &lPropertyList,
+                                        &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lPropertyList == NULL);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CFRelease(lError);
+
+    // The remainder of the property list should remain unread in the
+    // pipe.
+
+    lRemaining = read(mDescriptors[0], lBuffer, sizeof (lBuffer));
+    CPPUNIT_ASSERT(lRemaining > 0);
+    CPPUNIT_ASSERT(strncmp(lBuffer, "<?xml", 5) != 0);
+}
@@ -0,0 +1,348 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for
+ *      CFUPropertyListReadFromFileWithOptions and
+ *      CFUPropertyListReadFromURLWithOptions.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+/*
+ * This property list has seven (7) objects, including keys, nested
+ * two (2) containers deep. Its longest string or data payload is ten
+ * (10) bytes.
+ */
+static const char * const kPropertyListBuffer =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n"
+    "<plist version=\"1.0\">\n"
+    "<dict>\n"
+    "    <key>Array</key>\n"
+    "    <array>\n"
+    "        <string>0123456789</string>\n"
+    "        <data>AAECAwQFBgcICQ==</data>\n"
+    "    </array>\n"
+    "    <key>Integer</key>\n"
+    "    <integer>42</integer>\n"
+    "</dict>\n"
+    "</plist>";
+
+class TestCFUPropertyListReadWithOptions :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUPropertyListReadWithOptions);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestUnlimited);
+    CPPUNIT_TEST(TestWithinLimits);
+    CPPUNIT_TEST(TestDepth);
+    CPPUNIT_TEST(TestObjects);
+    CPPUNIT_TEST(TestBytes);
+    CPPUNIT_TEST(TestLength);
+    CPPUNIT_TEST(TestInput);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestUnlimited(void);
+    void TestWithinLimits(void);
+    void TestDepth(void);
+    void TestObjects(void);
+    void TestBytes(void);
+    void TestLength(void);
+    void TestInput(void);
+
+    void setUp(void);
+    void tearDown(void);
+
+private:
+    void WriteTemporary(char *       aPathBuffer,
+                        const char * aPathPattern,
+                        const char * aBuffer);
+    void WriteBinary(void);
+
+    void TestAccept(const CFUPropertyListReadOptions & inOptions);
+    void TestReject(const CFUPropertyListReadOptions & inOptions);
+    void TestReject(const char *                       inPath,
+                    const CFUPropertyListReadOptions & inOptions);
+
+    char mXMLPath[PATH_MAX];
+    char mBinaryPath[PATH_MAX];
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUPropertyListReadWithOptions);
+
+void
+TestCFUPropertyListReadWithOptions :: setUp(void)
+{
+    WriteTemporary(mXMLPath,
+                   "/tmp/cfu-xml-plistXXXXXX",
+                   kPropertyListBuffer);
+
+    WriteBinary();
+}
+
+void
+TestCFUPropertyListReadWithOptions :: tearDown(void)
+{
+    int lStatus;
+
+    lStatus = unlink(mXMLPath);
+    CPPUNIT_ASSERT(lStatus == 0);
+
+    lStatus = unlink(mBinaryPath);
+    CPPUNIT_ASSERT(lStatus == 0);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: WriteTemporary(char *       aPathBuffer,
+                                                     const char * aPathPattern,
+                                                     const char * aBuffer)
+{
+    const size_t lLength     = strlen(aBuffer);
+    int          lDescriptor = -1;
+    ssize_t      lStatus;
+
+    aPathBuffer[0] = '\0';
+    strcat(aPathBuffer, aPathPattern);
+
+    lStatus = mkstemp(aPathBuffer);
+    CPPUNIT_ASSERT(lStatus > 0);
+
+    lDescriptor = static_cast<int>(lStatus);
+
+    lStatus = write(lDescriptor, aBuffer, lLength);
+    CPPUNIT_ASSERT(lStatus > 0);
+    CPPUNIT_ASSERT(static_cast<size_t>(lStatus) == lLength);
+
+    close(lDescriptor);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: WriteBinary(void)
+{
+    const bool        kWritable     = true;
+    CFPropertyListRef lPropertyList = NULL;
+    int               lDescriptor;
+    bool              lStatus;
+
+    // Convert the XML property list into an equivalent binary one.
+
+    lStatus = CFUPropertyListReadFromFile(mXMLPath,
+                                          kCFPropertyListImmutable,
+                                          &lPropertyList,
+                                          NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+
+    mBinaryPath[0] = '\0';
+    strcat(mBinaryPath, "/tmp/cfu-binary-plistXXXXXX");
+
+    lDescriptor = mkstemp(mBinaryPath);
+    CPPUNIT_ASSERT(lDescriptor > 0);
+
+    close(lDescriptor);
+
+    lStatus = CFUPropertyListWriteToFile(mBinaryPath,
+                                         kWritable,
+                                         kCFPropertyListBinaryFormat_v1_0,
+                                         lPropertyList,
+                                         NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CFRelease(lPropertyList);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestAccept(const CFUPropertyListReadOptions & inOptions)
+{
+    const char * const lPaths[] = { mXMLPath, mBinaryPath };
+
+    for (size_t i = 0; i < sizeof (lPaths) / sizeof (lPaths[0]); i++)
+    {
+        CFPropertyListRef lPropertyList = NULL;
+        CFStringRef       lError        = NULL;
+        bool              lStatus;
+
+        lStatus = CFUPropertyListReadFromFileWithOptions(lPaths[i],
+                                                         kCFPropertyListImmutable,
+                                                         &inOptions,
+                                                         &lPropertyList,
+                                                         &lError);
+        CPPUNIT_ASSERT(lStatus == true);
+        CPPUNIT_ASSERT(lPropertyList != NULL);
+        CPPUNIT_ASSERT(lError == NULL);
+
+        CPPUNIT_ASSERT(CFGetTypeID(lPropertyList) == CFDictionaryGetTypeID());
+        CPPUNIT_ASSERT(CFDictionaryGetCount(static_cast<CFDictionaryRef>(lPropertyList)) == 2);
+
+        CFRelease(lPropertyList);
+    }
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestReject(const char *                       inPath,
+                                                 const CFUPropertyListReadOptions & inOptions)
+{
+    CFPropertyListRef lPropertyList = NULL;
+    CFStringRef       lError        = NULL;
+    bool              lStatus;
+
+    lStatus = CFUPropertyListReadFromFileWithOptions(inPath,
+                                                     kCFPropertyListImmutable,
+                                                     &inOptions,
+                                                     &lPropertyList,
+                                                     &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lPropertyList == NULL);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CFRelease(lError);
+
+    // The error string is optional.
+
+    lStatus = CFUPropertyListReadFromFileWithOptions(inPath,
+                                                     kCFPropertyListImmutable,
+                                                     &inOptions,
+                                                     &lPropertyList,
+                                                     NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lPropertyList == NULL);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestReject(const CFUPropertyListReadOptions & inOptions)
+{
+    TestReject(mXMLPath, inOptions);
+    TestReject(mBinaryPath, inOptions);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestNull(void)
+{
+    const CFUPropertyListReadOptions lOptions = { 0, 0, 0, 0, NULL, 0 };
+    CFPropertyListRef                lPropertyList;
+    bool                             lStatus;
+
+    lStatus = CFUPropertyListReadFromFileWithOptions(static_cast<const char *>(NULL),
+                                                     kCFPropertyListImmutable,
+                                                     &lOptions,
+                                                     &lPropertyList,
+                                                     NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUPropertyListReadFromURLWithOptions(NULL,
+                                                    kCFPropertyListImmutable,
+                                                    &lOptions,
+                                                    &lPropertyList,
+                                                    NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUPropertyListReadFromFileWithOptions(mXMLPath,
+                                                     kCFPropertyListImmutable,
+                                                     &lOptions,
+                                                     NULL,
+                                                     NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestUnlimited(void)
+{
+    const CFUPropertyListReadOptions lOptions = { 0, 0, 0, 0, NULL, 0 };
+    CFPropertyListRef                lPropertyList = NULL;
+    bool                             lStatus;
+
+    // Null options should behave exactly as the unlimited reader.
+
+    lStatus = CFUPropertyListReadFromFileWithOptions(mXMLPath,
+                                                     kCFPropertyListImmutable,
+                                                     NULL,
+                                                     &lPropertyList,
+                                                     NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+
+    CFRelease(lPropertyList);
+
+    // As should options where every limit is zero.
+
+    TestAccept(lOptions);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestWithinLimits(void)
+{
+    const CFUPropertyListReadOptions lOptions = { 2, 7, 64, 16, NULL, 0 };
+
+    TestAccept(lOptions);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestDepth(void)
+{
+    const CFUPropertyListReadOptions lOptions = { 1, 0, 0, 0, NULL, 0 };
+
+    TestReject(lOptions);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestObjects(void)
+{
+    const CFUPropertyListReadOptions lOptions = { 0, 6, 0, 0, NULL, 0 };
+
+    TestReject(lOptions);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestBytes(void)
+{
+    const CFUPropertyListReadOptions lOptions = { 0, 0, 16, 0, NULL, 0 };
+
+    TestReject(lOptions);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestLength(void)
+{
+    const CFUPropertyListReadOptions lOptions = { 0, 0, 0, 9, NULL, 0 };
+
+    TestReject(lOptions);
+}
+
+void
+TestCFUPropertyListReadWithOptions :: TestInput(void)
+{
+    const CFUPropertyListReadOptions lWithin   = { 0, 0, 0, 0, NULL, 4096 };
+    const CFUPropertyListReadOptions lExceeded = { 0, 0, 0, 0, NULL, 32 };
+
+    // Both the XML and binary property lists are larger than
+    // thirty-two (32) bytes but well under four kilobytes.
+
+    TestAccept(lWithin);
+    TestReject(lExceeded);
+}
@@ -0,0 +1,397 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the
+ *      CFUPropertyListSchema interfaces.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+static const CFUPropertyListSchemaEntry kEntries[] = {
+    { "",                kCFUPropertyListSchemaTypeDictionary, 0,                              0, 0     },
+    { "Name",            kCFUPropertyListSchemaTypeString,     kCFUPropertyListSchemaRequired | kCFUPropertyListSchemaRange, 1, 16    },
+    { "Enabled",         kCFUPropertyListSchemaTypeBoolean,    0,                              0, 0     },
+    { "Servers",         kCFUPropertyListSchemaTypeArray,      kCFUPropertyListSchemaRequired, 0, 0     },
+    { "Servers.[].Host", kCFUPropertyListSchemaTypeString,     kCFUPropertyListSchemaRequired, 0, 0     },
+    { "Servers.[].Port", kCFUPropertyListSchemaTypeNumber,     kCFUPropertyListSchemaRange,    1, 65535 }
+};
+
+class TestCFUPropertyListSchema :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUPropertyListSchema);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestErrors);
+    CPPUNIT_TEST(TestMalformed);
+    CPPUNIT_TEST(TestConflicting);
+    CPPUNIT_TEST(TestConforming);
+    CPPUNIT_TEST(TestType);
+    CPPUNIT_TEST(TestRequired);
+    CPPUNIT_TEST(TestRange);
+    CPPUNIT_TEST(TestElement);
+    CPPUNIT_TEST(TestRead);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestErrors(void);
+    void TestMalformed(void);
+    void TestConflicting(void);
+    void TestConforming(void);
+    void TestType(void);
+    void TestRequired(void);
+    void TestRange(void);
+    void TestElement(void);
+    void TestRead(void);
+
+    void setUp(void);
+    void tearDown(void);
+
+private:
+    CFMutableDictionaryRef CreateServer(CFStringRef inHost, int inPort);
+    void TestCompile(const char * inFirst, const char * inSecond);
+    void TestViolation(CFStringRef inExpected);
+
+    CFUPropertyListSchemaRef mSchema;
+    CFMutableDictionaryRef   mDictionary;
+    CFMutableArrayRef        mServers;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUPropertyListSchema);
+
+void
+TestCFUPropertyListSchema :: setUp(void)
+{
+    CFMutableDictionaryRef lServer;
+
+    mSchema = CFUPropertyListSchemaCreate(kEntries,
+                                          sizeof (kEntries) / sizeof (kEntries[0]),
+                                          NULL);
+    CPPUNIT_ASSERT(mSchema != NULL);
+
+    mDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                            0,
+                                            &kCFTypeDictionaryKeyCallBacks,
+                                            &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(mDictionary != NULL);
+
+    mServers = CFArrayCreateMutable(kCFAllocatorDefault,
+                                    0,
+                                    &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(mServers != NULL);
+
+    lServer = CreateServer(CFSTR("primary"), 80);
+    CFArrayAppendValue(mServers, lServer);
+    CFRelease(lServer);
+
+    lServer = CreateServer(CFSTR("secondary"), 8080);
+    CFArrayAppendValue(mServers, lServer);
+    CFRelease(lServer);
+
+    CFDictionarySetValue(mDictionary, CFSTR("Name"), CFSTR("Service"));
+    CFDictionarySetValue(mDictionary, CFSTR("Servers"), mServers);
+
+    // Keys not named by the schema are permitted.
+
+    CFDictionarySetValue(mDictionary, CFSTR("Unknown"), CFSTR("Ignored"));
+}
+
+void
+TestCFUPropertyListSchema :: tearDown(void)
+{
+    CFUPropertyListSchemaDestroy(mSchema);
+
+    CFRelease(mServers);
+    CFRelease(mDictionary);
+}
+
+CFMutableDictionaryRef
+TestCFUPropertyListSchema :: CreateServer(CFStringRef inHost, int inPort)
+{
+    CFMutableDictionaryRef lServer;
+    bool                   lStatus;
+
+    lServer = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                        0,
+                                        &kCFTypeDictionaryKeyCallBacks,
+                                        &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lServer != NULL);
+
+    CFDictionarySetValue(lServer, CFSTR("Host"), inHost);
+
+    lStatus = CFUDictionarySetNumber(lServer, CFSTR("Port"), inPort);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    return (lServer);
+}
+
+void
+TestCFUPropertyListSchema :: TestCompile(const char * inFirst,
+                                         const char * inSecond)
+{
+    const CFUPropertyListSchemaEntry lEntries[] = {
+        { inFirst,  kCFUPropertyListSchemaTypeString, 0, 0, 0 },
+        { inSecond, kCFUPropertyListSchemaTypeString, 0, 0, 0 }
+    };
+    CFUPropertyListSchemaRef lSchema;
+    CFStringRef              lError = NULL;
+
+    lSchema = CFUPropertyListSchemaCreate(lEntries, 2, &lError);
+    CPPUNIT_ASSERT(lSchema == NULL);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CFRelease(lError);
+}
+
+void
+TestCFUPropertyListSchema :: TestViolation(CFStringRef inExpected)
+{
+    CFStringRef lError = NULL;
+    bool        lStatus;
+
+    lStatus = CFUPropertyListSchemaValidate(mSchema, mDictionary, &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CPPUNIT_ASSERT(CFStringCompare(lError, inExpected, 0) == kCFCompareEqualTo);
+
+    CFRelease(lError);
+}
+
+void
+TestCFUPropertyListSchema :: TestNull(void)
+{
+    CFUPropertyListSchemaRef lSchema;
+    bool                     lStatus;
+
+    lSchema = CFUPropertyListSchemaCreate(NULL, 1, NULL);
+    CPPUNIT_ASSERT(lSchema == NULL);
+
+    // An empty schema is valid and accepts anything.
+
+    lSchema = CFUPropertyListSchemaCreate(NULL, 0, NULL);
+    CPPUNIT_ASSERT(lSchema != NULL);
+
+    lStatus = CFUPropertyListSchemaValidate(lSchema, mDictionary, NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lStatus = CFUPropertyListSchemaValidate(lSchema, NULL, NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUPropertyListSchemaValidate(NULL, mDictionary, NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    CFUPropertyListSchemaDestroy(lSchema);
+    CFUPropertyListSchemaDestroy(NULL);
+}
+
+void
+TestCFUPropertyListSchema :: TestErrors(void)
+{
+    const CFUPropertyListSchemaEntry lEntries[] = {
+        { NULL,   kCFUPropertyListSchemaTypeString,                                             0, 0, 0 },
+        { "Name", static_cast<CFUPropertyListSchemaType>(-1),                                   0, 0, 0 },
+        { "Name", static_cast<CFUPropertyListSchemaType>(kCFUPropertyListSchemaTypeString + 1), 0, 0, 0 }
+    };
+    CFUPropertyListSchemaRef lSchema;
+    CFStringRef              lError;
+    bool                     lStatus;
+
+    // Every failure should be reported, not just conflicts.
+
+    lError  = NULL;
+    lSchema = CFUPropertyListSchemaCreate(NULL, 1, &lError);
+    CPPUNIT_ASSERT(lSchema == NULL);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CFRelease(lError);
+
+    for (size_t i = 0; i < sizeof (lEntries) / sizeof (lEntries[0]); i++)
+    {
+        lError  = NULL;
+        lSchema = CFUPropertyListSchemaCreate(&lEntries[i], 1, &lError);
+        CPPUNIT_ASSERT(lSchema == NULL);
+        CPPUNIT_ASSERT(lError != NULL);
+
+        CFRelease(lError);
+    }
+
+    lError  = NULL;
+    lStatus = CFUPropertyListSchemaValidate(mSchema, NULL, &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CFRelease(lError);
+
+    lError  = NULL;
+    lStatus = CFUPropertyListSchemaValidate(NULL, mDictionary, &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CFRelease(lError);
+}
+
+void
+TestCFUPropertyListSchema :: TestMalformed(void)
+{
+    TestCompile("First", "A..B");
+    TestCompile("First", "A.");
+    TestCompile("First", ".A");
+}
+
+void
+TestCFUPropertyListSchema :: TestConflicting(void)
+{
+    // Duplicate declarations conflict.
+
+    TestCompile("A", "A");
+
+    // A string cannot also be a dictionary or an array.
+
+    TestCompile("A", "A.B");
+    TestCompile("A.B", "A");
+    TestCompile("A.[]", "A.B");
+}
+
+void
+TestCFUPropertyListSchema :: TestConforming(void)
+{
+    CFStringRef lError = NULL;
+    bool        lStatus;
+
+    lStatus = CFUPropertyListSchemaValidate(mSchema, mDictionary, &lError);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lError == NULL);
+}
+
+void
+TestCFUPropertyListSchema :: TestType(void)
+{
+    CFDictionarySetValue(mDictionary, CFSTR("Enabled"), CFSTR("true"));
+
+    TestViolation(CFSTR("Property list schema violation at 'Enabled': expected boolean"));
+}
+
+void
+TestCFUPropertyListSchema :: TestRequired(void)
+{
+    CFDictionaryRemoveValue(mDictionary, CFSTR("Name"));
+
+    TestViolation(CFSTR("Property list schema violation at 'Name': missing required key"));
+}
+
+void
+TestCFUPropertyListSchema :: TestRange(void)
+{
+    CFDictionarySetValue(mDictionary, CFSTR("Name"), CFSTR(""));
+
+    TestViolation(CFSTR("Property list schema violation at 'Name': length or count out of range"));
+}
+
+void
+TestCFUPropertyListSchema :: TestElement(void)
+{
+    CFMutableDictionaryRef lServer;
+
+    lServer = CreateServer(CFSTR("tertiary"), 70000);
+    CFArrayAppendValue(mServers, lServer);
+    CFRelease(lServer);
+
+    TestViolation(CFSTR("Property list schema violation at 'Servers[2].Port': value out of range"));
+}
+
+void
+TestCFUPropertyListSchema :: TestRead(void)
+{
+    const bool                 kWritable     = true;
+    CFUPropertyListReadOptions lOptions      = { 0, 0, 0, 0, mSchema, 0 };
+    CFPropertyListRef          lPropertyList = NULL;
+    CFStringRef                lError        = NULL;
+    char                       lPath[PATH_MAX];
+    int                        lDescriptor;
+    bool                       lStatus;
+
+    lPath[0] = '\0';
+    strcat(lPath, "/tmp/cfu-schema-plistXXXXXX");
+
+    lDescriptor = mkstemp(lPath);
+    CPPUNIT_ASSERT(lDescriptor > 0);
+
+    close(lDescriptor);
+
+    // A conforming property list reads successfully.
+
+    lStatus = CFUPropertyListWriteToFile(lPath,
+                                         kWritable,
+                                         kCFPropertyListXMLFormat_v1_0,
+                                         mDictionary,
+                                         NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lStatus = CFUPropertyListReadFromFileWithOptions(lPath,
+                                                     kCFPropertyListImmutable,
+                                                     &lOptions,
+                                                     &lPropertyList,
+                                                     &lError);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+    CPPUNIT_ASSERT(lError == NULL);
+
+    CFRelease(lPropertyList);
+    lPropertyList = NULL;
+
+    // A nonconforming one is rejected, with no property list
+    // returned.
+
+    CFDictionaryRemoveValue(mDictionary, CFSTR("Servers"));
+
+    lStatus = CFUPropertyListWriteToFile(lPath,
+                                         kWritable,
+                                         kCFPropertyListBinaryFormat_v1_0,
+                                         mDictionary,
+                                         NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    lStatus = CFUPropertyListReadFromFileWithOptions(lPath,
+                                                     kCFPropertyListImmutable,
+                                                     &lOptions,
+                                                     &lPropertyList,
+                                                     &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lPropertyList == NULL);
+    CPPUNIT_ASSERT(lError != NULL);
+
+    CPPUNIT_ASSERT(CFStringCompare(lError,
+                                   CFSTR("Property list schema violation at 'Servers': missing required key"),
+                                   0) == kCFCompareEqualTo);
+
+    CFRelease(lError);
+
+    lStatus = unlink(lPath);
+    CPPUNIT_ASSERT(lStatus == 0);
+}
@@ -0,0 +1,505 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the
+ *      CFUPropertyListWatcher interfaces.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUPropertyListWatcher :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUPropertyListWatcher);
+    CPPUNIT_TEST(TestNull);
+#if defined(__linux__)
+    CPPUNIT_TEST(TestNonexistent);
+    CPPUNIT_TEST(TestUnchanged);
+    CPPUNIT_TEST(TestChanged);
+    CPPUNIT_TEST(TestRemoved);
+    CPPUNIT_TEST(TestAllocator);
+    CPPUNIT_TEST(TestNotDictionary);
+    CPPUNIT_TEST(TestUnsettled);
+#endif
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestNonexistent(void);
+    void TestUnchanged(void);
+    void TestChanged(void);
+    void TestRemoved(void);
+    void TestAllocator(void);
+    void TestNotDictionary(void);
+    void TestUnsettled(void);
+
+    void setUp(void);
+    void tearDown(void);
+
+private:
+    struct Context
+    {
+        size_t          mCalls;
+        CFDictionaryRef mAdded;
+        CFDictionaryRef mChanged;
+        CFDictionaryRef mRemoved;
+    };
+
+    static void CallBack(CFUPropertyListWatcherRef inWatcher,
+                         CFDictionaryRef           inAdded,
+                         CFDictionaryRef           inChanged,
+                         CFDictionaryRef           inRemoved,
+                         void *                    inContext);
+
+    void Write(CFStringRef aFirstKey,
+               CFStringRef aFirstValue,
+               CFStringRef aSecondKey,
+               CFStringRef aSecondValue);
+    void Rewrite(const std::atomic<bool> & inDone);
+
+    char    mDirectory[PATH_MAX];
+    char    mPath[PATH_MAX];
+    Context mContext;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUPropertyListWatcher);
+
+void
+TestCFUPropertyListWatcher :: setUp(void)
+{
+    char * lStatus;
+
+    mDirectory[0] = '\0';
+    strcat(mDirectory, "/tmp/cfu-watcherXXXXXX");
+
+    lStatus = mkdtemp(mDirectory);
+    CPPUNIT_ASSERT(lStatus != NULL);
+
+    snprintf(mPath, sizeof (mPath), "%s/watched.plist", mDirectory);
+
+    memset(&mContext, 0, sizeof (mContext));
+}
+
+void
+TestCFUPropertyListWatcher :: tearDown(void)
+{
+    // Not every test creates the watched file, so ignore the return
+    // status of unlink.
+
+    unlink(mPath);
+
+    rmdir(mDirectory);
+
+    CFURelease(mContext.mAdded);
+    CFURelease(mContext.mChanged);
+    CFURelease(mContext.mRemoved);
+}
+
+void
+TestCFUPropertyListWatcher :: CallBack(CFUPropertyListWatcherRef inWatcher,
+                                       CFDictionaryRef           inAdded,
+                                       CFDictionaryRef           inChanged,
+                                       CFDictionaryRef           inRemoved,
+                                       void *                    inContext)
+{
+    Context * lContext = static_cast<Context *>(inContext);
+
+    CPPUNIT_ASSERT(inWatcher != NULL);
+    CPPUNIT_ASSERT(lContext != NULL);
+
+    lContext->mCalls++;
+
+    CFUReferenceSet(lContext->mAdded,   inAdded);
+    CFUReferenceSet(lContext->mChanged, inChanged);
+    CFUReferenceSet(lContext->mRemoved, inRemoved);
+}
+
+void
+TestCFUPropertyListWatcher :: Write(CFStringRef aFirstKey,
+                                    CFStringRef aFirstValue,
+                                    CFStringRef aSecondKey,
+                                    CFStringRef aSecondValue)
+{
+    const bool             kWritable   = true;
+    CFMutableDictionaryRef lDictionary = NULL;
+    bool                   lStatus;
+
+    lDictionary = CFDictionaryCreateMutable(kCFAllocatorDefault,
+                                            0,
+                                            &kCFTypeDictionaryKeyCallBacks,
+                                            &kCFTypeDictionaryValueCallBacks);
+    CPPUNIT_ASSERT(lDictionary != NULL);
+
+    CFDictionarySetValue(lDictionary, aFirstKey, aFirstValue);
+    CFDictionarySetValue(lDictionary, aSecondKey, aSecondValue);
+
+    lStatus = CFUPropertyListWriteToFile(mPath,
+                                         kWritable,
+                                         kCFPropertyListXMLFormat_v1_0,
+                                         lDictionary,
+                                         NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CFRelease(lDictionary);
+}
+
+void
+TestCFUPropertyListWatcher :: TestNull(void)
+{
+    CFUPropertyListWatcherRef lWatcher;
+    CFDictionaryRef           lPropertyList;
+    int                       lDescriptor;
+    bool                      lStatus;
+
+    lWatcher = CFUPropertyListWatcherCreate(NULL,
+                                            kCFPropertyListImmutable,
+                                            0,
+                                            CallBack,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher == NULL);
+
+    lWatcher = CFUPropertyListWatcherCreate(mPath,
+                                            kCFPropertyListImmutable,
+                                            0,
+                                            NULL,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher == NULL);
+
+    lDescriptor = CFUPropertyListWatcherGetFileDescriptor(NULL);
+    CPPUNIT_ASSERT(lDescriptor == -1);
+
+    lPropertyList = CFUPropertyListWatcherCopyPropertyList(NULL);
+    CPPUNIT_ASSERT(lPropertyList == NULL);
+
+    lStatus = CFUPropertyListWatcherProcess(NULL, 0, NULL);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    CFUPropertyListWatcherDestroy(NULL);
+}
+
+void
+TestCFUPropertyListWatcher :: TestNonexistent(void)
+{
+    CFUPropertyListWatcherRef lWatcher;
+    CFDictionaryRef           lPropertyList;
+    int                       lDescriptor;
+
+    lWatcher = CFUPropertyListWatcherCreate(mPath,
+                                            kCFPropertyListImmutable,
+                                            0,
+                                            CallBack,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher != NULL);
+
+    lDescriptor = CFUPropertyListWatcherGetFileDescriptor(lWatcher);
+    CPPUNIT_ASSERT(lDescriptor >= 0);
+
+    lPropertyList = CFUPropertyListWatcherCopyPropertyList(lWatcher);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(lPropertyList) == 0);
+
+    CFRelease(lPropertyList);
+
+    CFUPropertyListWatcherDestroy(lWatcher);
+}
+
+void
+TestCFUPropertyListWatcher :: TestUnchanged(void)
+{
+    CFUPropertyListWatcherRef lWatcher;
+    bool                      lStatus;
+
+    Write(CFSTR("First"), CFSTR("1"), CFSTR("Second"), CFSTR("2"));
+
+    lWatcher = CFUPropertyListWatcherCreate(mPath,
+                                            kCFPropertyListImmutable,
+                                            10,
+                                            CallBack,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher != NULL);
+
+    // No change has occurred, so processing should neither block nor
+    // invoke the callback.
+
+    lStatus = CFUPropertyListWatcherProcess(lWatcher, 0, NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(mContext.mCalls == 0);
+
+    CFUPropertyListWatcherDestroy(lWatcher);
+}
+
+void
+TestCFUPropertyListWatcher :: TestChanged(void)
+{
+    CFUPropertyListWatcherRef lWatcher;
+    CFDictionaryRef           lPropertyList;
+    bool                      lStatus;
+
+    Write(CFSTR("Same"), CFSTR("Same"), CFSTR("Changed"), CFSTR("Old"));
+
+    lWatcher = CFUPropertyListWatcherCreate(mPath,
+                                            kCFPropertyListImmutable,
+                                            10,
+                                            CallBack,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher != NULL);
+
+    // Write twice in quick succession; the debounce should coalesce
+    // both writes into a single reload and callback. Each write is
+    // the same size, possibly within the same modification time
+    // tick, and must still be observed.
+
+    Write(CFSTR("Same"), CFSTR("Same"), CFSTR("Changed"), CFSTR("Interim"));
+    Write(CFSTR("Same"), CFSTR("Same"), CFSTR("Changed"), CFSTR("New"));
+
+    lStatus = CFUPropertyListWatcherProcess(lWatcher, 1000, NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(mContext.mCalls == 1);
+
+    CPPUNIT_ASSERT(CFDictionaryGetCount(mContext.mAdded) == 0);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(mContext.mRemoved) == 0);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(mContext.mChanged) == 1);
+    CPPUNIT_ASSERT(CFEqual(CFDictionaryGetValue(mContext.mChanged,
+                                                CFSTR("Changed")),
+                           CFSTR("New")));
+
+    lPropertyList = CFUPropertyListWatcherCopyPropertyList(lWatcher);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(lPropertyList) == 2);
+
+    CFRelease(lPropertyList);
+
+    CFUPropertyListWatcherDestroy(lWatcher);
+}
+
+void
+TestCFUPropertyListWatcher :: TestRemoved(void)
+{
+    CFUPropertyListWatcherRef lWatcher;
+    bool                      lStatus;
+    int                       lResult;
+
+    Write(CFSTR("First"), CFSTR("1"), CFSTR("Second"), CFSTR("2"));
+
+    lWatcher = CFUPropertyListWatcherCreate(mPath,
+                                            kCFPropertyListImmutable,
+                                            10,
+                                            CallBack,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher != NULL);
+
+    // Removing the watched file should be reported as the removal of
+    // all of its keys.
+
+    lResult = unlink(mPath);
+    CPPUNIT_ASSERT(lResult == 0);
+
+    lStatus = CFUPropertyListWatcherProcess(lWatcher, 1000, NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(mContext.mCalls == 1);
+
+    CPPUNIT_ASSERT(CFDictionaryGetCount(mContext.mAdded) == 0);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(mContext.mChanged) == 0);
+    CPPUNIT_ASSERT(CFDictionaryGetCount(mContext.mRemoved) == 2);
+
+    CFUPropertyListWatcherDestroy(lWatcher);
+}
+
+void
+TestCFUPropertyListWatcher :: TestAllocator(void)
+{
+    CFAllocatorRef            lArena;
+    CFUPropertyListWatcherRef lWatcher;
+    CFDictionaryRef           lPropertyList;
+    bool                      lStatus;
+
+    lArena = CFUAllocatorArenaCreate(kCFAllocatorDefault, 0);
+    CPPUNIT_ASSERT(lArena != NULL);
+
+    Write(CFSTR("Same"), CFSTR("Same"), CFSTR("Changed"), CFSTR("Old"));
+
+    lWatcher = CFUPropertyListWatcherCreateWithAllocator(lArena,
+                                                         mPath,
+                                                         kCFPropertyListImmutable,
+                                                         10,
+                                                         CallBack,
+                                                         &mContext);
+    CPPUNIT_ASSERT(lWatcher != NULL);
+
+    Write(CFSTR("Same"), CFSTR("Same"), CFSTR("Changed"), CFSTR("New"));
+
+    lStatus = CFUPropertyListWatcherProcess(lWatcher, 1000, NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(mContext.mCalls == 1);
+
+    // Both the property list read and its differences are created
+    // with the specified allocator.
+
+    CPPUNIT_ASSERT(CFGetAllocator(mContext.mAdded) == lArena);
+    CPPUNIT_ASSERT(CFGetAllocator(mContext.mChanged) == lArena);
+    CPPUNIT_ASSERT(CFGetAllocator(mContext.mRemoved) == lArena);
+
+    lPropertyList = CFUPropertyListWatcherCopyPropertyList(lWatcher);
+    CPPUNIT_ASSERT(lPropertyList != NULL);
+    CPPUNIT_ASSERT(CFGetAllocator(lPropertyList) == lArena);
+
+    CFRelease(lPropertyList);
+
+    CFUPropertyListWatcherDestroy(lWatcher);
+
+    // Objects retain the allocator they were created with, so it may
+    // be released while the differences are still held.
+
+    CFRelease(lArena);
+}
+
+void
+TestCFUPropertyListWatcher :: TestNotDictionary(void)
+{
+    const bool                kWritable = true;
+    CFUPropertyListWatcherRef lWatcher;
+    CFArrayRef                lArray;
+    CFStringRef               lError    = NULL;
+    bool                      lStatus;
+
+    lWatcher = CFUPropertyListWatcherCreate(mPath,
+                                            kCFPropertyListImmutable,
+                                            10,
+                                            CallBack,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher != NULL);
+
+    lArray = CFArrayCreate(kCFAllocatorDefault, NULL, 0, &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lArray != NULL);
+
+    lStatus = CFUPropertyListWriteToFile(mPath,
+                                         kWritable,
+                                         kCFPropertyListXMLFormat_v1_0,
+                                         lArray,
+                                         NULL);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    // A well-formed property list that is not a dictionary is an
+    // error that is described, distinguishing it from a failure to
+    // read the file.
+
+    lStatus = CFUPropertyListWatcherProcess(lWatcher, 1000, &lError);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lError != NULL);
+    CPPUNIT_ASSERT(mContext.mCalls == 0);
+
+    CFRelease(lError);
+    CFRelease(lArray);
+
+    CFUPropertyListWatcherDestroy(lWatcher);
+}
+
+/*
+ * Atomically replace the watched file, as an editor might, every few
+ * milliseconds until told to stop or until a generous limit elapses,
+ * such that a regression fails rather than hangs the test.
+ */
+void
+TestCFUPropertyListWatcher :: Rewrite(const std::atomic<bool> & inDone)
+{
+    static const char                           kContents[] =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<plist version=\"1.0\">\n"
+        "<dict><key>Key</key><string>Value</string></dict>\n"
+        "</plist>\n";
+    const std::chrono::steady_clock::time_point lLimit =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    char                                        lTemporary[PATH_MAX];
+
+    snprintf(lTemporary, sizeof (lTemporary), "%s/rewrite.plist", mDirectory);
+
+    while (!inDone && (std::chrono::steady_clock::now() < lLimit))
+    {
+        const int lDescriptor = open(lTemporary, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+        if (lDescriptor >= 0)
+        {
+            ssize_t lWritten = write(lDescriptor, kContents, sizeof (kContents) - 1);
+
+            (void)lWritten;
+
+            close(lDescriptor);
+
+            rename(lTemporary, mPath);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    unlink(lTemporary);
+}
+
+void
+TestCFUPropertyListWatcher :: TestUnsettled(void)
+{
+    CFUPropertyListWatcherRef             lWatcher;
+    std::atomic<bool>                     lDone(false);
+    std::thread                           lThread;
+    std::chrono::steady_clock::time_point lStart;
+    std::chrono::milliseconds             lElapsed;
+    bool                                  lStatus;
+
+    lWatcher = CFUPropertyListWatcherCreate(mPath,
+                                            kCFPropertyListImmutable,
+                                            50,
+                                            CallBack,
+                                            &mContext);
+    CPPUNIT_ASSERT(lWatcher != NULL);
+
+    // A file rewritten more often than the debounce period never
+    // settles, but must still be reloaded within a bounded time.
+
+    lThread = std::thread(&TestCFUPropertyListWatcher::Rewrite, this, std::cref(lDone));
+
+    lStart = std::chrono::steady_clock::now();
+
+    lStatus = CFUPropertyListWatcherProcess(lWatcher, 1000, NULL);
+
+    lElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - lStart);
+
+    lDone = true;
+
+    lThread.join();
+
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(mContext.mCalls == 1);
+    CPPUNIT_ASSERT(lElapsed < std::chrono::milliseconds(2000));
+
+    CFUPropertyListWatcherDestroy(lWatcher);
+}
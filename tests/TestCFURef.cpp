@@ -0,0 +1,281 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFURef.
+ */
+
+#include <CFUtilities/CFURef.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFURef :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFURef);
+    CPPUNIT_TEST(TestDefaultConstruction);
+    CPPUNIT_TEST(TestAdopt);
+    CPPUNIT_TEST(TestRetain);
+    CPPUNIT_TEST(TestCopy);
+    CPPUNIT_TEST(TestMove);
+    CPPUNIT_TEST(TestConvertingMove);
+    CPPUNIT_TEST(TestRelease);
+    CPPUNIT_TEST(TestReset);
+    CPPUNIT_TEST(TestSwap);
+    CPPUNIT_TEST(TestConversion);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestDefaultConstruction(void);
+    void TestAdopt(void);
+    void TestRetain(void);
+    void TestCopy(void);
+    void TestMove(void);
+    void TestConvertingMove(void);
+    void TestRelease(void);
+    void TestReset(void);
+    void TestSwap(void);
+    void TestConversion(void);
+
+private:
+    static CFMutableArrayRef CreateArray(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFURef);
+
+CFMutableArrayRef
+TestCFURef :: CreateArray(void)
+{
+    CFMutableArrayRef lRetval;
+
+    lRetval = CFArrayCreateMutable(kCFAllocatorDefault, 0, &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lRetval != NULL);
+
+    return (lRetval);
+}
+
+void
+TestCFURef :: TestDefaultConstruction(void)
+{
+    CFURef<CFArrayRef> lArray;
+
+    CPPUNIT_ASSERT(lArray.get() == NULL);
+    CPPUNIT_ASSERT(lArray == NULL);
+}
+
+void
+TestCFURef :: TestAdopt(void)
+{
+    CFMutableArrayRef lCFArray = CreateArray();
+
+    CFRetain(lCFArray);
+
+    // Adopting neither retains nor releases, but the reference is
+    // released when the object is destroyed.
+
+    {
+        CFURef<CFMutableArrayRef> lArray = CFURefAdopt(lCFArray);
+
+        CPPUNIT_ASSERT(lArray.get() == lCFArray);
+        CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 2);
+    }
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+
+    {
+        CFURef<CFMutableArrayRef> lArray = CFURef<CFMutableArrayRef>::Adopt(NULL);
+
+        CPPUNIT_ASSERT(lArray.get() == NULL);
+    }
+
+    CFRelease(lCFArray);
+}
+
+void
+TestCFURef :: TestRetain(void)
+{
+    CFMutableArrayRef lCFArray = CreateArray();
+
+    {
+        CFURef<CFMutableArrayRef> lArray(lCFArray);
+
+        CPPUNIT_ASSERT(lArray.get() == lCFArray);
+        CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 2);
+    }
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+
+    {
+        CFURef<CFMutableArrayRef> lArray(NULL);
+
+        CPPUNIT_ASSERT(lArray.get() == NULL);
+    }
+
+    CFRelease(lCFArray);
+}
+
+void
+TestCFURef :: TestCopy(void)
+{
+    CFURef<CFMutableArrayRef> lFirst = CFURefAdopt(CreateArray());
+    CFURef<CFMutableArrayRef> lThird;
+
+    {
+        CFURef<CFMutableArrayRef> lSecond(lFirst);
+
+        CPPUNIT_ASSERT(lSecond.get() == lFirst.get());
+        CPPUNIT_ASSERT(CFGetRetainCount(lFirst) == 2);
+
+        lThird = lSecond;
+        CPPUNIT_ASSERT(CFGetRetainCount(lFirst) == 3);
+    }
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lFirst) == 2);
+}
+
+void
+TestCFURef :: TestMove(void)
+{
+    CFMutableArrayRef         lCFArray = CreateArray();
+    CFURef<CFMutableArrayRef> lFirst   = CFURefAdopt(lCFArray);
+    CFURef<CFMutableArrayRef> lThird;
+
+    // Moving transfers ownership without touching the reference
+    // count.
+
+    CFURef<CFMutableArrayRef> lSecond(std::move(lFirst));
+
+    CPPUNIT_ASSERT(lFirst.get() == NULL);
+    CPPUNIT_ASSERT(lSecond.get() == lCFArray);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+
+    lThird = std::move(lSecond);
+
+    CPPUNIT_ASSERT(lSecond.get() == NULL);
+    CPPUNIT_ASSERT(lThird.get() == lCFArray);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+
+    // As does growing a container of objects.
+
+    {
+        std::vector<CFURef<CFMutableArrayRef> > lArrays;
+
+        lArrays.push_back(std::move(lThird));
+
+        for (size_t i = 0; i < 32; i++)
+        {
+            lArrays.push_back(CFURefAdopt(CreateArray()));
+        }
+
+        CPPUNIT_ASSERT(lArrays[0].get() == lCFArray);
+        CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+
+        CFRetain(lCFArray);
+    }
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+
+    CFRelease(lCFArray);
+}
+
+void
+TestCFURef :: TestConvertingMove(void)
+{
+    CFMutableArrayRef         lCFArray = CreateArray();
+    CFURef<CFMutableArrayRef> lMutable = CFURefAdopt(lCFArray);
+    CFURef<CFArrayRef>        lImmutable(std::move(lMutable));
+
+    CPPUNIT_ASSERT(lMutable.get() == NULL);
+    CPPUNIT_ASSERT(lImmutable.get() == lCFArray);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+}
+
+void
+TestCFURef :: TestRelease(void)
+{
+    CFMutableArrayRef         lCFArray = CreateArray();
+    CFURef<CFMutableArrayRef> lArray   = CFURefAdopt(lCFArray);
+    CFMutableArrayRef         lReleased;
+
+    lReleased = lArray.release();
+
+    CPPUNIT_ASSERT(lReleased == lCFArray);
+    CPPUNIT_ASSERT(lArray.get() == NULL);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFArray) == 1);
+
+    CFRelease(lReleased);
+}
+
+void
+TestCFURef :: TestReset(void)
+{
+    CFMutableArrayRef         lFirst  = CreateArray();
+    CFMutableArrayRef         lSecond = CreateArray();
+    CFURef<CFMutableArrayRef> lArray  = CFURefAdopt(lFirst);
+
+    CFRetain(lFirst);
+
+    // Resetting releases the current reference and adopts the new
+    // one.
+
+    lArray.reset(lSecond);
+
+    CPPUNIT_ASSERT(lArray.get() == lSecond);
+    CPPUNIT_ASSERT(CFGetRetainCount(lFirst) == 1);
+    CPPUNIT_ASSERT(CFGetRetainCount(lSecond) == 1);
+
+    lArray.reset();
+
+    CPPUNIT_ASSERT(lArray.get() == NULL);
+
+    CFRelease(lFirst);
+}
+
+void
+TestCFURef :: TestSwap(void)
+{
+    CFMutableArrayRef         lCFFirst  = CreateArray();
+    CFMutableArrayRef         lCFSecond = CreateArray();
+    CFURef<CFMutableArrayRef> lFirst    = CFURefAdopt(lCFFirst);
+    CFURef<CFMutableArrayRef> lSecond   = CFURefAdopt(lCFSecond);
+
+    swap(lFirst, lSecond);
+
+    CPPUNIT_ASSERT(lFirst.get() == lCFSecond);
+    CPPUNIT_ASSERT(lSecond.get() == lCFFirst);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFFirst) == 1);
+    CPPUNIT_ASSERT(CFGetRetainCount(lCFSecond) == 1);
+}
+
+void
+TestCFURef :: TestConversion(void)
+{
+    CFURef<CFMutableArrayRef> lArray = CFURefAdopt(CreateArray());
+
+    // The object may be passed wherever its reference type is.
+
+    CFArrayAppendValue(lArray, kCFBooleanTrue);
+
+    CPPUNIT_ASSERT(CFArrayGetCount(lArray) == 1);
+    CPPUNIT_ASSERT(CFUIsTypeID(lArray.get(), CFArrayGetTypeID()));
+}
@@ -0,0 +1,251 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFUReleaseDeferred and
+ *      the deferred release queue.
+ */
+
+#include <CFUtilities/CFUtilities.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUReleaseDeferred :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUReleaseDeferred);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestDrain);
+    CPPUNIT_TEST(TestBatches);
+    CPPUNIT_TEST(TestThreadExit);
+    CPPUNIT_TEST(TestReclaimer);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestDrain(void);
+    void TestBatches(void);
+    void TestThreadExit(void);
+    void TestReclaimer(void);
+
+private:
+    static const size_t kReleases = 1000;
+
+    static CFMutableArrayRef CreateArray(void);
+    static CFArrayRef CreateMarker(void);
+    static void Defer(CFTypeRef inReference, size_t inCount);
+    static void ReleaseMarker(CFAllocatorRef inAllocator, const void * inValue);
+
+    static std::mutex              sMutex;
+    static std::condition_variable sCondition;
+    static bool                    sMarkerReleased;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUReleaseDeferred);
+
+std::mutex              TestCFUReleaseDeferred::sMutex;
+std::condition_variable TestCFUReleaseDeferred::sCondition;
+bool                    TestCFUReleaseDeferred::sMarkerReleased = false;
+
+CFMutableArrayRef
+TestCFUReleaseDeferred :: CreateArray(void)
+{
+    CFMutableArrayRef lRetval;
+
+    lRetval = CFArrayCreateMutable(kCFAllocatorDefault, 0, &kCFTypeArrayCallBacks);
+    CPPUNIT_ASSERT(lRetval != NULL);
+
+    return (lRetval);
+}
+
+/*
+ * A marker is an array whose sole value signals, when the array is
+ * destroyed, that the marker has been released.
+ */
+CFArrayRef
+TestCFUReleaseDeferred :: CreateMarker(void)
+{
+    static const CFArrayCallBacks kCallBacks = { 0, NULL, ReleaseMarker, NULL, NULL };
+    const void *                  lValue     = &sMarkerReleased;
+    CFArrayRef                    lRetval;
+
+    sMarkerReleased = false;
+
+    lRetval = CFArrayCreate(kCFAllocatorDefault, &lValue, 1, &kCallBacks);
+    CPPUNIT_ASSERT(lRetval != NULL);
+
+    return (lRetval);
+}
+
+void
+TestCFUReleaseDeferred :: ReleaseMarker(CFAllocatorRef inAllocator, const void * inValue)
+{
+    std::lock_guard<std::mutex> lLock(sMutex);
+
+    (void)inAllocator;
+    (void)inValue;
+
+    sMarkerReleased = true;
+
+    sCondition.notify_all();
+}
+
+void
+TestCFUReleaseDeferred :: Defer(CFTypeRef inReference, size_t inCount)
+{
+    for (size_t i = 0; i < inCount; i++)
+    {
+        CFRetain(inReference);
+
+        CFUReleaseDeferred(inReference);
+    }
+}
+
+void
+TestCFUReleaseDeferred :: TestNull(void)
+{
+    size_t lReleased;
+
+    CFUReleaseDeferred(NULL);
+
+    lReleased = CFUReleaseQueueDrain();
+    CPPUNIT_ASSERT(lReleased == 0);
+}
+
+void
+TestCFUReleaseDeferred :: TestDrain(void)
+{
+    CFMutableArrayRef lArray = CreateArray();
+    size_t            lReleased;
+
+    // A deferred release is not performed until drained.
+
+    Defer(lArray, 1);
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == 2);
+
+    lReleased = CFUReleaseQueueDrain();
+    CPPUNIT_ASSERT(lReleased == 1);
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == 1);
+
+    lReleased = CFUReleaseQueueDrain();
+    CPPUNIT_ASSERT(lReleased == 0);
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUReleaseDeferred :: TestBatches(void)
+{
+    CFMutableArrayRef lArray = CreateArray();
+    size_t            lReleased;
+
+    // Filling several batches hands them off, but, without a
+    // reclaimer, nothing is released until drained.
+
+    Defer(lArray, kReleases);
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == static_cast<CFIndex>(kReleases + 1));
+
+    CFUReleaseQueueFlush();
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == static_cast<CFIndex>(kReleases + 1));
+
+    lReleased = CFUReleaseQueueDrain();
+    CPPUNIT_ASSERT(lReleased == kReleases);
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == 1);
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUReleaseDeferred :: TestThreadExit(void)
+{
+    CFMutableArrayRef lArray = CreateArray();
+    std::thread       lThread(Defer, lArray, 3);
+    size_t            lReleased;
+
+    // A thread's queue is handed off when it exits, to be drained
+    // by another.
+
+    lThread.join();
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == 4);
+
+    lReleased = CFUReleaseQueueDrain();
+    CPPUNIT_ASSERT(lReleased == 3);
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == 1);
+
+    CFRelease(lArray);
+}
+
+void
+TestCFUReleaseDeferred :: TestReclaimer(void)
+{
+    CFMutableArrayRef lArray = CreateArray();
+    bool              lStatus;
+
+    lStatus = CFUReleaseQueueStartReclaimer();
+    CPPUNIT_ASSERT(lStatus == true);
+
+    // Starting it again is harmless.
+
+    lStatus = CFUReleaseQueueStartReclaimer();
+    CPPUNIT_ASSERT(lStatus == true);
+
+    Defer(lArray, kReleases);
+
+    // References are released in the order deferred, so once the
+    // marker, deferred last, is released, so are all the others.
+
+    CFUReleaseDeferred(CreateMarker());
+
+    CFUReleaseQueueFlush();
+
+    // The reclaimer releases the references in the background.
+
+    {
+        std::unique_lock<std::mutex> lLock(sMutex);
+
+        lStatus = sCondition.wait_for(lLock, std::chrono::seconds(10), []() {
+            return (sMarkerReleased);
+        });
+    }
+
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == 1);
+
+    CFUReleaseQueueStopReclaimer();
+
+    // Once stopped, releases are again deferred until drained.
+
+    Defer(lArray, 1);
+    CFUReleaseQueueFlush();
+
+    CPPUNIT_ASSERT(CFGetRetainCount(lArray) == 2);
+    CPPUNIT_ASSERT(CFUReleaseQueueDrain() == 1);
+
+    CFRelease(lArray);
+}
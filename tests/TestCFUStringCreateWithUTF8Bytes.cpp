@@ -0,0 +1,175 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements a unit test for CFUStringCreateWithUTF8Bytes.
+ */
+
+#include <CFUtilities/CFUtilities.h>
+
+#include <string>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUStringCreateWithUTF8Bytes :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUStringCreateWithUTF8Bytes);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestASCII);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST(TestBoundaries);
+    CPPUNIT_TEST(TestInvalid);
+    CPPUNIT_TEST(TestInvalidSequences);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestASCII(void);
+    void TestNonASCII(void);
+    void TestBoundaries(void);
+    void TestInvalid(void);
+    void TestInvalidSequences(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUStringCreateWithUTF8Bytes);
+
+void
+TestCFUStringCreateWithUTF8Bytes :: TestNull(void)
+{
+    CFStringRef lString;
+
+    lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, NULL, 0);
+    CPPUNIT_ASSERT(lString == NULL);
+}
+
+void
+TestCFUStringCreateWithUTF8Bytes :: TestASCII(void)
+{
+    CFStringRef lString;
+
+    lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, "", 0);
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringGetLength(lString) == 0);
+
+    CFRelease(lString);
+
+    // Only the specified length is used.
+
+    lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, "Key, Value", 3);
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringCompare(lString, CFSTR("Key"), 0) == kCFCompareEqualTo);
+
+    CFRelease(lString);
+}
+
+void
+TestCFUStringCreateWithUTF8Bytes :: TestNonASCII(void)
+{
+    std::string lBytes(100, 'a');
+    CFStringRef lString;
+
+    // A non-ASCII character after the first block of bytes examined
+    // is still detected.
+
+    lBytes += "\xc3\xa4";
+
+    lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, lBytes.data(), lBytes.size());
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringGetLength(lString) == 101);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, 100) == 0x00e4);
+
+    CFRelease(lString);
+
+    // As are two-, three- and four-byte sequences.
+
+    lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, "\xe2\x82\xac \xf0\x9f\x98\x80", 8);
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringGetLength(lString) == 4);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, 0) == 0x20ac);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, 2) == 0xd83d);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, 3) == 0xde00);
+
+    CFRelease(lString);
+}
+
+void
+TestCFUStringCreateWithUTF8Bytes :: TestBoundaries(void)
+{
+    // Place a non-ASCII character, valid and then truncated, at
+    // every offset across several blocks of bytes, such that it is
+    // found wherever it falls relative to a block boundary.
+
+    for (size_t i = 0; i < 70; i++)
+    {
+        std::string lBytes(i, 'a');
+        CFStringRef lString;
+
+        lBytes += "\xc3\xa4";
+        lBytes += std::string(70 - i, 'b');
+
+        lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, lBytes.data(), lBytes.size());
+        CPPUNIT_ASSERT(lString != NULL);
+        CPPUNIT_ASSERT(CFStringGetLength(lString) == 71);
+        CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, i) == 0x00e4);
+
+        CFRelease(lString);
+
+        lBytes.erase(i + 1, 1);
+
+        lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, lBytes.data(), lBytes.size());
+        CPPUNIT_ASSERT(lString == NULL);
+    }
+}
+
+void
+TestCFUStringCreateWithUTF8Bytes :: TestInvalid(void)
+{
+    CFStringRef lString;
+
+    lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, "Invalid \xff", 9);
+    CPPUNIT_ASSERT(lString == NULL);
+}
+
+void
+TestCFUStringCreateWithUTF8Bytes :: TestInvalidSequences(void)
+{
+    static const char * const kInvalidSequences[] = {
+        "\xc0\xaf",          // Overlong
+        "\xe0\x80\xaf",      // Overlong
+        "\xf0\x80\x80\xaf",  // Overlong
+        "\xed\xa0\x80",      // Surrogate
+        "\xf4\x90\x80\x80",  // Above U+10FFFF
+        "\xf5\x80\x80\x80",  // Invalid lead byte
+        "\x80",              // Unexpected continuation
+        "\xe2\x82",          // Truncated
+        "\xf0\x9f\x98"       // Truncated
+    };
+    CFStringRef lString;
+
+    for (size_t i = 0; i < sizeof (kInvalidSequences) / sizeof (kInvalidSequences[0]); i++)
+    {
+        std::string lBytes("Prefix ");
+
+        lBytes += kInvalidSequences[i];
+
+        lString = CFUStringCreateWithUTF8Bytes(kCFAllocatorDefault, lBytes.data(), lBytes.size());
+        CPPUNIT_ASSERT(lString == NULL);
+    }
+}
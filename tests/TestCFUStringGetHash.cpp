@@ -0,0 +1,176 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFUStringGetHash,
+ *      CFUStringHash and CFUStringEqual.
+ */
+
+#include <CFUtilities/CFString.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUStringGetHash :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUStringGetHash);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestDistinct);
+    CPPUNIT_TEST(TestRepresentations);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST(TestFunctors);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestDistinct(void);
+    void TestRepresentations(void);
+    void TestNonASCII(void);
+    void TestFunctors(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUStringGetHash);
+
+void
+TestCFUStringGetHash :: TestNull(void)
+{
+    CPPUNIT_ASSERT(CFUStringGetHash(NULL) == 0);
+}
+
+void
+TestCFUStringGetHash :: TestDistinct(void)
+{
+    CPPUNIT_ASSERT(CFUStringGetHash(CFSTR("")) != CFUStringGetHash(CFSTR("a")));
+    CPPUNIT_ASSERT(CFUStringGetHash(CFSTR("ab")) != CFUStringGetHash(CFSTR("ba")));
+    CPPUNIT_ASSERT(CFUStringGetHash(CFSTR("Key")) != CFUStringGetHash(CFSTR("key")));
+}
+
+void
+TestCFUStringGetHash :: TestRepresentations(void)
+{
+    static const UniChar kCharacters[] = { 'K', 'e', 'y' };
+    const size_t         lHash         = CFUStringGetHash(CFSTR("Key"));
+    CFStringRef          lString;
+    CFMutableStringRef   lMutableString;
+
+    // The same characters hash the same whether stored with eight
+    // or sixteen bits per character, or mutably.
+
+    lString = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                           kCharacters,
+                                           sizeof (kCharacters) / sizeof (kCharacters[0]));
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFUStringGetHash(lString) == lHash);
+
+    lMutableString = CFStringCreateMutableCopy(kCFAllocatorDefault, 0, lString);
+    CPPUNIT_ASSERT(lMutableString != NULL);
+    CPPUNIT_ASSERT(CFUStringGetHash(lMutableString) == lHash);
+
+    CFRelease(lMutableString);
+    CFRelease(lString);
+
+    lString = CFStringCreateWithCString(kCFAllocatorDefault, "Key", kCFStringEncodingASCII);
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFUStringGetHash(lString) == lHash);
+
+    CFRelease(lString);
+}
+
+void
+TestCFUStringGetHash :: TestNonASCII(void)
+{
+    std::vector<UniChar> lCharacters;
+    std::string          lBytes;
+    CFStringRef          lFirst;
+    CFStringRef          lSecond;
+
+    // A string long enough to be hashed in several chunks, should
+    // its characters not be directly available, built both from
+    // UTF-16 and from UTF-8.
+
+    for (size_t i = 0; i < 200; i++)
+    {
+        lCharacters.push_back(0x20ac);
+        lCharacters.push_back('a');
+
+        lBytes += "\xe2\x82\xac" "a";
+    }
+
+    lFirst = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                          &lCharacters[0],
+                                          static_cast<CFIndex>(lCharacters.size()));
+    CPPUNIT_ASSERT(lFirst != NULL);
+
+    lSecond = CFStringCreateWithBytes(kCFAllocatorDefault,
+                                      reinterpret_cast<const UInt8 *>(lBytes.data()),
+                                      static_cast<CFIndex>(lBytes.size()),
+                                      kCFStringEncodingUTF8,
+                                      false);
+    CPPUNIT_ASSERT(lSecond != NULL);
+
+    CPPUNIT_ASSERT(CFUStringGetHash(lFirst) == CFUStringGetHash(lSecond));
+
+    CFRelease(lFirst);
+    CFRelease(lSecond);
+
+    // An ISO Latin-1 string hashes the same as its UTF-16 equivalent.
+
+    lFirst = CFStringCreateWithCString(kCFAllocatorDefault, "\xe4", kCFStringEncodingISOLatin1);
+    CPPUNIT_ASSERT(lFirst != NULL);
+
+    lCharacters[0] = 0x00e4;
+
+    lSecond = CFStringCreateWithCharacters(kCFAllocatorDefault, &lCharacters[0], 1);
+    CPPUNIT_ASSERT(lSecond != NULL);
+    CPPUNIT_ASSERT(CFUStringGetHash(lFirst) == CFUStringGetHash(lSecond));
+
+    CFRelease(lFirst);
+    CFRelease(lSecond);
+}
+
+void
+TestCFUStringGetHash :: TestFunctors(void)
+{
+    std::unordered_map<CFStringRef, int, CFUStringHash, CFUStringEqual> lIndex;
+    CFStringRef                                                        lKey;
+    CFUStringHash                                                      lHash;
+
+    lKey = CFStringCreateWithCString(kCFAllocatorDefault, "Key", kCFStringEncodingUTF8);
+    CPPUNIT_ASSERT(lKey != NULL);
+
+    // Keys are found by content rather than by pointer.
+
+    lIndex[CFSTR("Key")] = 1;
+
+    CPPUNIT_ASSERT(lIndex.count(lKey) == 1);
+    CPPUNIT_ASSERT(lIndex[lKey] == 1);
+    CPPUNIT_ASSERT(lIndex.size() == 1);
+    CPPUNIT_ASSERT(lIndex.count(CFSTR("Other Key")) == 0);
+
+    // The hash of a string object is that of its string.
+
+    CPPUNIT_ASSERT(lHash(CFString(lKey)) == lHash(lKey));
+
+    CFRelease(lKey);
+}
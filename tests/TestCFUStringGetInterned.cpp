@@ -0,0 +1,219 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for CFUStringGetInterned and
+ *      CFUStringGetInternedCString.
+ */
+
+#include <CFUtilities/CFUtilities.h>
+
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUStringGetInterned :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUStringGetInterned);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestCanonical);
+    CPPUNIT_TEST(TestLength);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST(TestInvalid);
+    CPPUNIT_TEST(TestMatch);
+    CPPUNIT_TEST(TestConcurrent);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestCanonical(void);
+    void TestLength(void);
+    void TestNonASCII(void);
+    void TestInvalid(void);
+    void TestMatch(void);
+    void TestConcurrent(void);
+
+private:
+    static const size_t kThreads = 8;
+    static const size_t kKeys    = 256;
+
+    static void Intern(size_t inOffset, CFStringRef * outStrings);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUStringGetInterned);
+
+void
+TestCFUStringGetInterned :: TestNull(void)
+{
+    CFStringRef lString;
+
+    lString = CFUStringGetInterned(NULL, 0);
+    CPPUNIT_ASSERT(lString == NULL);
+
+    lString = CFUStringGetInternedCString(NULL);
+    CPPUNIT_ASSERT(lString == NULL);
+}
+
+void
+TestCFUStringGetInterned :: TestCanonical(void)
+{
+    char        lBuffer[16];
+    CFStringRef lFirst;
+    CFStringRef lSecond;
+    CFStringRef lOther;
+
+    // The same bytes, even from distinct buffers, yield the same
+    // string.
+
+    strcpy(lBuffer, "Key");
+
+    lFirst = CFUStringGetInternedCString("Key");
+    CPPUNIT_ASSERT(lFirst != NULL);
+
+    lSecond = CFUStringGetInternedCString(lBuffer);
+    CPPUNIT_ASSERT(lSecond == lFirst);
+
+    CPPUNIT_ASSERT(CFStringCompare(lFirst, CFSTR("Key"), 0) == kCFCompareEqualTo);
+
+    // Distinct bytes yield distinct strings.
+
+    lOther = CFUStringGetInternedCString("Other Key");
+    CPPUNIT_ASSERT(lOther != NULL);
+    CPPUNIT_ASSERT(lOther != lFirst);
+
+    // As does the empty string.
+
+    lOther = CFUStringGetInternedCString("");
+    CPPUNIT_ASSERT(lOther != NULL);
+    CPPUNIT_ASSERT(CFStringGetLength(lOther) == 0);
+    CPPUNIT_ASSERT(lOther == CFUStringGetInterned("", 0));
+}
+
+void
+TestCFUStringGetInterned :: TestLength(void)
+{
+    const char * const lBuffer = "KeyKeychain";
+    CFStringRef        lFirst;
+    CFStringRef        lSecond;
+
+    // Only the specified length is interned; the bytes need not be
+    // null-terminated.
+
+    lFirst = CFUStringGetInterned(lBuffer, 3);
+    CPPUNIT_ASSERT(lFirst != NULL);
+    CPPUNIT_ASSERT(lFirst == CFUStringGetInternedCString("Key"));
+
+    lSecond = CFUStringGetInterned(lBuffer + 3, 8);
+    CPPUNIT_ASSERT(lSecond != NULL);
+    CPPUNIT_ASSERT(lSecond == CFUStringGetInternedCString("Keychain"));
+}
+
+void
+TestCFUStringGetInterned :: TestNonASCII(void)
+{
+    static const char kUTF8Bytes[] = "Tests\xc3\xa4tze";
+    CFStringRef       lString;
+
+    lString = CFUStringGetInternedCString(kUTF8Bytes);
+    CPPUNIT_ASSERT(lString != NULL);
+    CPPUNIT_ASSERT(CFStringGetLength(lString) == 9);
+    CPPUNIT_ASSERT(CFStringGetCharacterAtIndex(lString, 5) == 0x00e4);
+
+    CPPUNIT_ASSERT(CFUStringGetInternedCString(kUTF8Bytes) == lString);
+}
+
+void
+TestCFUStringGetInterned :: TestInvalid(void)
+{
+    static const char kInvalidBytes[] = "Invalid \xff";
+    CFStringRef       lString;
+
+    lString = CFUStringGetInternedCString(kInvalidBytes);
+    CPPUNIT_ASSERT(lString == NULL);
+
+    // A failed attempt is not remembered.
+
+    lString = CFUStringGetInternedCString(kInvalidBytes);
+    CPPUNIT_ASSERT(lString == NULL);
+}
+
+void
+TestCFUStringGetInterned :: TestMatch(void)
+{
+    CFStringRef lString = CFUStringGetInternedCString("Match");
+    bool        lMatch;
+
+    lMatch = CFUStringsMatch(lString, lString);
+    CPPUNIT_ASSERT(lMatch == true);
+
+    lMatch = CFUStringsMatch(lString, CFSTR("Match"));
+    CPPUNIT_ASSERT(lMatch == true);
+}
+
+void
+TestCFUStringGetInterned :: Intern(size_t inOffset, CFStringRef * outStrings)
+{
+    // Intern the keys in a thread-specific order to maximize the
+    // chance of racing publications of the same key.
+
+    for (size_t i = 0; i < kKeys; i++)
+    {
+        const size_t lIndex = (i + inOffset) % kKeys;
+        char         lKey[32];
+
+        snprintf(lKey, sizeof (lKey), "Concurrent Key %zu", lIndex);
+
+        outStrings[lIndex] = CFUStringGetInternedCString(lKey);
+    }
+}
+
+void
+TestCFUStringGetInterned :: TestConcurrent(void)
+{
+    std::vector<std::thread> lThreads;
+    CFStringRef              lStrings[kThreads][kKeys];
+
+    for (size_t i = 0; i < kThreads; i++)
+    {
+        lThreads.push_back(std::thread(Intern, i * (kKeys / kThreads), &lStrings[i][0]));
+    }
+
+    for (size_t i = 0; i < kThreads; i++)
+    {
+        lThreads[i].join();
+    }
+
+    // Every thread must have received the same string for each key.
+
+    for (size_t j = 0; j < kKeys; j++)
+    {
+        CPPUNIT_ASSERT(lStrings[0][j] != NULL);
+
+        for (size_t i = 1; i < kThreads; i++)
+        {
+            CPPUNIT_ASSERT(lStrings[i][j] == lStrings[0][j]);
+        }
+    }
+}
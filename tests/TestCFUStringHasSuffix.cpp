@@ -0,0 +1,154 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements a unit test for CFUStringHasSuffix.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUStringHasSuffix :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUStringHasSuffix);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestMatching);
+    CPPUNIT_TEST(TestNotMatching);
+    CPPUNIT_TEST(TestRepresentations);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestMatching(void);
+    void TestNotMatching(void);
+    void TestRepresentations(void);
+    void TestNonASCII(void);
+
+private:
+    void Test(CFStringRef aString, CFStringRef aSuffix, bool aIgnoreCase, bool aMatches);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUStringHasSuffix);
+
+void
+TestCFUStringHasSuffix :: TestNull(void)
+{
+    const bool  lMatches = false;
+    CFStringRef lString  = CFSTR("Content-Type");
+
+    Test(NULL,    lString, false, lMatches);
+    Test(lString, NULL,    false, lMatches);
+    Test(NULL,    NULL,    true,  lMatches);
+}
+
+void
+TestCFUStringHasSuffix :: TestMatching(void)
+{
+    const bool  lMatches = true;
+    CFStringRef lString  = CFSTR("Content-Type");
+
+    Test(lString, lString,   false, lMatches);
+    Test(lString, CFSTR(""), false, lMatches);
+    Test(lString, CFSTR("-Type"), false, lMatches);
+
+    Test(lString, CFSTR("-Type"), true, lMatches);
+    Test(lString, CFSTR("-type"), true, lMatches);
+    Test(lString, CFSTR("CONTENT-TYPE"), true, lMatches);
+}
+
+void
+TestCFUStringHasSuffix :: TestNotMatching(void)
+{
+    const bool  lMatches = true;
+    CFStringRef lString  = CFSTR("Content-Type");
+
+    // Case matters unless it is ignored.
+
+    Test(lString, CFSTR("-type"), false, !lMatches);
+    Test(lString, CFSTR("CONTENT-TYPE"), false, !lMatches);
+
+    Test(lString, CFSTR("Content"), false, !lMatches);
+    Test(lString, CFSTR("Content"), true,  !lMatches);
+    Test(lString, CFSTR(" Content-Type"), false, !lMatches);
+    Test(lString, CFSTR(" Content-Type"), true,  !lMatches);
+    Test(lString, CFSTR("Hype"), true,  !lMatches);
+    Test(CFSTR(""), lString, true, !lMatches);
+}
+
+void
+TestCFUStringHasSuffix :: TestRepresentations(void)
+{
+    static const UniChar kCharacters[] = { '-', 't', 'Y', 'p', 'E' };
+    const bool           lMatches      = true;
+    CFMutableStringRef   lString;
+    CFStringRef          lSuffix;
+
+    lString = CFStringCreateMutableCopy(kCFAllocatorDefault, 0, CFSTR("Content-Type"));
+    CPPUNIT_ASSERT(lString != NULL);
+
+    lSuffix = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                       kCharacters,
+                                       sizeof (kCharacters) / sizeof (kCharacters[0]));
+    CPPUNIT_ASSERT(lSuffix != NULL);
+
+    Test(lString, lSuffix, true,  lMatches);
+    Test(lString, lSuffix, false, !lMatches);
+
+    CFRelease(lString);
+    CFRelease(lSuffix);
+}
+
+void
+TestCFUStringHasSuffix :: TestNonASCII(void)
+{
+    static const UniChar kString[] = { 'T', 'y', 'p', 'e', '-', 'l', 0x00F6 };
+    static const UniChar kSuffix[]     = { 'L', 0x00D6 };
+    const bool           lMatches  = true;
+    CFStringRef          lString;
+    CFStringRef          lSuffix;
+
+    // Non-ASCII characters are folded, too.
+
+    lString = CFStringCreateWithCharacters(kCFAllocatorDefault, kString, sizeof (kString) / sizeof (kString[0]));
+    CPPUNIT_ASSERT(lString != NULL);
+
+    lSuffix = CFStringCreateWithCharacters(kCFAllocatorDefault, kSuffix, sizeof (kSuffix) / sizeof (kSuffix[0]));
+    CPPUNIT_ASSERT(lSuffix != NULL);
+
+    Test(lString, lSuffix, true,  lMatches);
+    Test(lString, lSuffix, false, !lMatches);
+
+    CFRelease(lString);
+    CFRelease(lSuffix);
+}
+
+void
+TestCFUStringHasSuffix :: Test(CFStringRef aString,
+                               CFStringRef aSuffix,
+                               bool        aIgnoreCase,
+                               bool        aMatches)
+{
+    bool lStatus;
+
+    lStatus = CFUStringHasSuffix(aString, aSuffix, aIgnoreCase);
+    CPPUNIT_ASSERT(lStatus == aMatches);
+}
@@ -0,0 +1,377 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements a unit test for CFUStringLineReader.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUStringLineReader :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUStringLineReader);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestEmpty);
+    CPPUNIT_TEST(TestBytes);
+    CPPUNIT_TEST(TestLines);
+    CPPUNIT_TEST(TestLongLines);
+    CPPUNIT_TEST(TestInvalid);
+    CPPUNIT_TEST(TestNonBlocking);
+    CPPUNIT_TEST(TestFile);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestEmpty(void);
+    void TestBytes(void);
+    void TestLines(void);
+    void TestLongLines(void);
+    void TestInvalid(void);
+    void TestNonBlocking(void);
+    void TestFile(void);
+
+    void setUp(void);
+    void tearDown(void);
+
+private:
+    void Write(const char * inData);
+    void TestLine(CFUStringLineReaderRef inReader, CFStringRef inExpected);
+
+    int mDescriptors[2];
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUStringLineReader);
+
+void
+TestCFUStringLineReader :: setUp(void)
+{
+    int lStatus;
+
+    lStatus = pipe(mDescriptors);
+    CPPUNIT_ASSERT(lStatus == 0);
+}
+
+void
+TestCFUStringLineReader :: tearDown(void)
+{
+    if (mDescriptors[0] != -1)
+        close(mDescriptors[0]);
+
+    if (mDescriptors[1] != -1)
+        close(mDescriptors[1]);
+}
+
+void
+TestCFUStringLineReader :: Write(const char * inData)
+{
+    const size_t lLength = strlen(inData);
+    ssize_t      lWritten;
+
+    lWritten = write(mDescriptors[1], inData, lLength);
+    CPPUNIT_ASSERT(lWritten == static_cast<ssize_t>(lLength));
+
+    // Close the write end such that the reader sees end-of-file.
+
+    close(mDescriptors[1]);
+    mDescriptors[1] = -1;
+}
+
+void
+TestCFUStringLineReader :: TestLine(CFUStringLineReaderRef inReader,
+                                    CFStringRef            inExpected)
+{
+    CFStringRef lLine = NULL;
+    bool        lStatus;
+
+    lStatus = CFUStringLineReaderCopyLine(inReader, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLine != NULL);
+
+    CPPUNIT_ASSERT(CFStringCompare(lLine, inExpected, 0) == kCFCompareEqualTo);
+
+    CFRelease(lLine);
+}
+
+void
+TestCFUStringLineReader :: TestNull(void)
+{
+    CFUStringLineReaderRef lReader;
+    const UInt8 *          lBytes;
+    size_t                 lLength;
+    CFStringRef            lLine;
+    bool                   lStatus;
+
+    lReader = CFUStringLineReaderCreateWithFD(-1, 0);
+    CPPUNIT_ASSERT(lReader == NULL);
+
+    lReader = CFUStringLineReaderCreateWithFile(NULL, 0);
+    CPPUNIT_ASSERT(lReader == NULL);
+
+    lReader = CFUStringLineReaderCreateWithFile("/nonexistent/file", 0);
+    CPPUNIT_ASSERT(lReader == NULL);
+
+    lStatus = CFUStringLineReaderReadBytes(NULL, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    lStatus = CFUStringLineReaderCopyLine(NULL, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    CPPUNIT_ASSERT(CFUStringLineReaderGetError(NULL) == EINVAL);
+
+    CFUStringLineReaderDestroy(NULL);
+}
+
+void
+TestCFUStringLineReader :: TestEmpty(void)
+{
+    CFUStringLineReaderRef lReader;
+    const UInt8 *          lBytes;
+    size_t                 lLength;
+    bool                   lStatus;
+
+    Write("");
+
+    lReader = CFUStringLineReaderCreateWithFD(mDescriptors[0], 0);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(CFUStringLineReaderGetError(lReader) == 0);
+
+    CFUStringLineReaderDestroy(lReader);
+}
+
+void
+TestCFUStringLineReader :: TestBytes(void)
+{
+    CFUStringLineReaderRef lReader;
+    const UInt8 *          lBytes;
+    size_t                 lLength;
+    bool                   lStatus;
+
+    Write("First\nSecond\r\n\nLast");
+
+    lReader = CFUStringLineReaderCreateWithFD(mDescriptors[0], 0);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLength == 5);
+    CPPUNIT_ASSERT(memcmp(lBytes, "First", lLength) == 0);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLength == 6);
+    CPPUNIT_ASSERT(memcmp(lBytes, "Second", lLength) == 0);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLength == 0);
+
+    // A final line need not be terminated.
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLength == 4);
+    CPPUNIT_ASSERT(memcmp(lBytes, "Last", lLength) == 0);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(CFUStringLineReaderGetError(lReader) == 0);
+
+    CFUStringLineReaderDestroy(lReader);
+}
+
+void
+TestCFUStringLineReader :: TestLines(void)
+{
+    CFUStringLineReaderRef lReader;
+    CFStringRef            lExpected;
+    CFStringRef            lLine = NULL;
+    bool                   lStatus;
+
+    lExpected = CFStringCreateWithCString(kCFAllocatorDefault,
+                                          "Gr\xc3\xb6\xc3\x9f" "e",
+                                          kCFStringEncodingUTF8);
+    CPPUNIT_ASSERT(lExpected != NULL);
+
+    // Only a carriage return immediately preceding a line feed is
+    // part of the terminator.
+
+    Write("Gr\xc3\xb6\xc3\x9f" "e\r\n\r\nCarriage\rReturn\n\r\r\n");
+
+    lReader = CFUStringLineReaderCreateWithFD(mDescriptors[0], 0);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    TestLine(lReader, lExpected);
+    TestLine(lReader, CFSTR(""));
+    TestLine(lReader, CFSTR("Carriage\rReturn"));
+    TestLine(lReader, CFSTR("\r"));
+
+    lStatus = CFUStringLineReaderCopyLine(lReader, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(lLine == NULL);
+    CPPUNIT_ASSERT(CFUStringLineReaderGetError(lReader) == 0);
+
+    CFUStringLineReaderDestroy(lReader);
+
+    CFRelease(lExpected);
+}
+
+void
+TestCFUStringLineReader :: TestLongLines(void)
+{
+    CFUStringLineReaderRef lReader;
+    const UInt8 *          lBytes;
+    size_t                 lLength;
+    bool                   lStatus;
+
+    // Lines longer than the buffer, and terminators straddling
+    // buffer refills, are returned intact.
+
+    Write("A line longer than the buffer\r\nAnother\r\nx\n");
+
+    lReader = CFUStringLineReaderCreateWithFD(mDescriptors[0], 4);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLength == 29);
+    CPPUNIT_ASSERT(memcmp(lBytes, "A line longer than the buffer", lLength) == 0);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLength == 7);
+    CPPUNIT_ASSERT(memcmp(lBytes, "Another", lLength) == 0);
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT(lLength == 1);
+    CPPUNIT_ASSERT(lBytes[0] == 'x');
+
+    lStatus = CFUStringLineReaderReadBytes(lReader, &lBytes, &lLength);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    CFUStringLineReaderDestroy(lReader);
+}
+
+void
+TestCFUStringLineReader :: TestInvalid(void)
+{
+    CFUStringLineReaderRef lReader;
+    CFStringRef            lLine = NULL;
+    bool                   lStatus;
+
+    Write("Invalid \xff\nValid\n");
+
+    lReader = CFUStringLineReaderCreateWithFD(mDescriptors[0], 0);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    // An invalid line is an error, but reading may continue.
+
+    lStatus = CFUStringLineReaderCopyLine(lReader, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(CFUStringLineReaderGetError(lReader) == EILSEQ);
+
+    TestLine(lReader, CFSTR("Valid"));
+
+    lStatus = CFUStringLineReaderCopyLine(lReader, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lStatus == false);
+    CPPUNIT_ASSERT(CFUStringLineReaderGetError(lReader) == 0);
+
+    CFUStringLineReaderDestroy(lReader);
+}
+
+void
+TestCFUStringLineReader :: TestNonBlocking(void)
+{
+    CFUStringLineReaderRef lReader;
+    CFStringRef            lLine = NULL;
+    ssize_t                lWritten;
+    int                    lStatus;
+    bool                   lRead;
+
+    lStatus = fcntl(mDescriptors[0], F_SETFL, fcntl(mDescriptors[0], F_GETFL) | O_NONBLOCK);
+    CPPUNIT_ASSERT(lStatus == 0);
+
+    lReader = CFUStringLineReaderCreateWithFD(mDescriptors[0], 0);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    // With no complete line available yet, reading fails with EAGAIN
+    // but neither ends reading nor loses the partial line.
+
+    lWritten = write(mDescriptors[1], "Par", 3);
+    CPPUNIT_ASSERT(lWritten == 3);
+
+    lRead = CFUStringLineReaderCopyLine(lReader, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lRead == false);
+    CPPUNIT_ASSERT((CFUStringLineReaderGetError(lReader) == EAGAIN) ||
+                   (CFUStringLineReaderGetError(lReader) == EWOULDBLOCK));
+
+    lRead = CFUStringLineReaderCopyLine(lReader, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lRead == false);
+
+    lWritten = write(mDescriptors[1], "tial\n", 5);
+    CPPUNIT_ASSERT(lWritten == 5);
+
+    TestLine(lReader, CFSTR("Partial"));
+
+    CFUStringLineReaderDestroy(lReader);
+}
+
+void
+TestCFUStringLineReader :: TestFile(void)
+{
+    char                   lPath[] = "/tmp/TestCFUStringLineReader.XXXXXX";
+    int                    lDescriptor;
+    CFUStringLineReaderRef lReader;
+    CFStringRef            lLine = NULL;
+    ssize_t                lWritten;
+    bool                   lStatus;
+
+    lDescriptor = mkstemp(lPath);
+    CPPUNIT_ASSERT(lDescriptor >= 0);
+
+    lWritten = write(lDescriptor, "First\nSecond\n", 13);
+    CPPUNIT_ASSERT(lWritten == 13);
+
+    close(lDescriptor);
+
+    lReader = CFUStringLineReaderCreateWithFile(lPath, 0);
+    CPPUNIT_ASSERT(lReader != NULL);
+
+    TestLine(lReader, CFSTR("First"));
+    TestLine(lReader, CFSTR("Second"));
+
+    lStatus = CFUStringLineReaderCopyLine(lReader, kCFStringEncodingUTF8, &lLine);
+    CPPUNIT_ASSERT(lStatus == false);
+
+    CFUStringLineReaderDestroy(lReader);
+
+    unlink(lPath);
+}
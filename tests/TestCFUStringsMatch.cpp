@@ -1,5 +1,5 @@
 /*
- *    Copyright (c) 2021 Nuovation System Designs, LLC
+ *    Copyright (c) 2021-2026 Nuovation System Designs, LLC
  *    All rights reserved.
  *
  *    Licensed under the Apache License, Version 2.0 (the "License");
@@ -33,14 +33,26 @@ class TestCFUStringsMatch :
     CPPUNIT_TEST(TestNull);
     CPPUNIT_TEST(TestMatching);
     CPPUNIT_TEST(TestNotMatching);
+    CPPUNIT_TEST(TestIdentical);
+    CPPUNIT_TEST(TestLength);
+    CPPUNIT_TEST(TestRepresentations);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST(TestLiteral);
     CPPUNIT_TEST_SUITE_END();
 
 public:
     void TestNull(void);
     void TestMatching(void);
     void TestNotMatching(void);
+    void TestIdentical(void);
+    void TestLength(void);
+    void TestRepresentations(void);
+    void TestNonASCII(void);
+    void TestLiteral(void);
 
 private:
+    static CFStringRef CreateString(const UniChar * aCharacters, CFIndex aLength);
+
     void Test(CFStringRef aFirstString, CFStringRef aSecondString, bool aMatches);
 };
 
@@ -80,6 +92,136 @@ TestCFUStringsMatch :: TestNotMatching(void)
     Test(lFirstString, lSecondString, !lMatches);
 }
 
+void
+TestCFUStringsMatch :: TestIdentical(void)
+{
+    const bool  lMatches = true;
+    CFStringRef lString  = CFSTR("This matches!");
+
+    Test(lString, lString, lMatches);
+}
+
+void
+TestCFUStringsMatch :: TestLength(void)
+{
+    const bool  lMatches      = true;
+    CFStringRef lFirstString  = CFSTR("This matches!");
+    CFStringRef lSecondString = CFSTR("This matches");
+    CFStringRef lThirdString  = CFSTR("");
+
+    Test(lFirstString,  lSecondString, !lMatches);
+    Test(lSecondString, lFirstString,  !lMatches);
+    Test(lFirstString,  lThirdString,  !lMatches);
+    Test(lThirdString,  CFSTR(""),     lMatches);
+}
+
+void
+TestCFUStringsMatch :: TestRepresentations(void)
+{
+    static const UniChar kMatches[]    = { 'T', 'h', 'i', 's', ' ', 'm', 'a', 't', 'c', 'h', 'e', 's', '!' };
+    static const UniChar kMismatches[] = { 'T', 'h', 'i', 's', ' ', 'm', 'a', 't', 'c', 'h', 'e', 's', '?' };
+    const bool           lMatches      = true;
+    CFStringRef          lFirstString  = CFSTR("This matches!");
+    CFMutableStringRef   lSecondString;
+    CFStringRef          lThirdString;
+    CFStringRef          lFourthString;
+
+    // Strings with the same content, however they are stored, match.
+
+    lSecondString = CFStringCreateMutableCopy(kCFAllocatorDefault, 0, lFirstString);
+    CPPUNIT_ASSERT(lSecondString != NULL);
+
+    lThirdString = CreateString(kMatches, sizeof (kMatches) / sizeof (kMatches[0]));
+    CPPUNIT_ASSERT(lThirdString != NULL);
+
+    Test(lFirstString,  lSecondString, lMatches);
+    Test(lFirstString,  lThirdString,  lMatches);
+    Test(lThirdString,  lFirstString,  lMatches);
+    Test(lSecondString, lThirdString,  lMatches);
+
+    // Strings of the same length that differ only in their last
+    // character do not.
+
+    lFourthString = CreateString(kMismatches, sizeof (kMismatches) / sizeof (kMismatches[0]));
+    CPPUNIT_ASSERT(lFourthString != NULL);
+
+    Test(lFirstString,  lFourthString, !lMatches);
+    Test(lFourthString, lThirdString,  !lMatches);
+
+    CFStringAppend(lSecondString, CFSTR("?"));
+    CFStringDelete(lSecondString, CFRangeMake(12, 1));
+
+    Test(lFourthString, lSecondString, lMatches);
+    Test(lFirstString,  lSecondString, !lMatches);
+
+    CFRelease(lSecondString);
+    CFRelease(lThirdString);
+    CFRelease(lFourthString);
+}
+
+void
+TestCFUStringsMatch :: TestNonASCII(void)
+{
+    static const UniChar kFirst[]      = { 'G', 'r', 0x00F6, 0x00DF, 'e', ' ', 0x20AC };
+    static const UniChar kSecond[]     = { 'G', 'r', 0x00F6, 0x00DF, 'e', ' ', 0x20AC };
+    static const UniChar kThird[]      = { 'G', 'r', 0x00F6, 0x00DF, 'e', ' ', '$' };
+    const bool           lMatches      = true;
+    CFStringRef          lFirstString;
+    CFStringRef          lSecondString;
+    CFStringRef          lThirdString;
+
+    lFirstString = CreateString(kFirst, sizeof (kFirst) / sizeof (kFirst[0]));
+    CPPUNIT_ASSERT(lFirstString != NULL);
+
+    lSecondString = CreateString(kSecond, sizeof (kSecond) / sizeof (kSecond[0]));
+    CPPUNIT_ASSERT(lSecondString != NULL);
+
+    lThirdString = CreateString(kThird, sizeof (kThird) / sizeof (kThird[0]));
+    CPPUNIT_ASSERT(lThirdString != NULL);
+
+    Test(lFirstString, lSecondString, lMatches);
+    Test(lFirstString, lThirdString,  !lMatches);
+    Test(lThirdString, lFirstString,  !lMatches);
+
+    CFRelease(lFirstString);
+    CFRelease(lSecondString);
+    CFRelease(lThirdString);
+}
+
+void
+TestCFUStringsMatch :: TestLiteral(void)
+{
+    static const UniChar kPrecomposed[] = { 'G', 'r', 0x00F6, 0x00DF, 'e' };
+    static const UniChar kDecomposed[]  = { 'G', 'r', 'o', 0x0308, 0x00DF, 'e' };
+    const bool           lMatches       = true;
+    CFStringRef          lFirstString;
+    CFStringRef          lSecondString;
+
+    // The comparison is literal: canonically-equivalent strings in
+    // differing normalization forms do not match.
+
+    lFirstString = CreateString(kPrecomposed, sizeof (kPrecomposed) / sizeof (kPrecomposed[0]));
+    CPPUNIT_ASSERT(lFirstString != NULL);
+
+    lSecondString = CreateString(kDecomposed, sizeof (kDecomposed) / sizeof (kDecomposed[0]));
+    CPPUNIT_ASSERT(lSecondString != NULL);
+
+    Test(lFirstString, lSecondString, !lMatches);
+
+    // Nor do strings differing only in case.
+
+    Test(CFSTR("This matches!"), CFSTR("THIS MATCHES!"), !lMatches);
+
+    CFRelease(lFirstString);
+    CFRelease(lSecondString);
+}
+
+CFStringRef
+TestCFUStringsMatch :: CreateString(const UniChar * aCharacters, CFIndex aLength)
+{
+    return (CFStringCreateWithCharacters(kCFAllocatorDefault, aCharacters, aLength));
+}
+
 void
 TestCFUStringsMatch :: Test(CFStringRef aFirstString,
                             CFStringRef aSecondString,
@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      This file implements a unit test for CFUStringsMatchIgnoringCase.
+ */
+
+#include <CFUtilities/CFUtilities.hpp>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+class TestCFUStringsMatchIgnoringCase :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestCFUStringsMatchIgnoringCase);
+    CPPUNIT_TEST(TestNull);
+    CPPUNIT_TEST(TestMatching);
+    CPPUNIT_TEST(TestNotMatching);
+    CPPUNIT_TEST(TestRepresentations);
+    CPPUNIT_TEST(TestNonASCII);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestNull(void);
+    void TestMatching(void);
+    void TestNotMatching(void);
+    void TestRepresentations(void);
+    void TestNonASCII(void);
+
+private:
+    void Test(CFStringRef aFirstString, CFStringRef aSecondString, bool aMatches);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCFUStringsMatchIgnoringCase);
+
+void
+TestCFUStringsMatchIgnoringCase :: TestNull(void)
+{
+    const bool  lMatches = false;
+    CFStringRef lString  = CFSTR("Content-Type");
+
+    Test(NULL,    lString, lMatches);
+    Test(lString, NULL,    lMatches);
+    Test(NULL,    NULL,    lMatches);
+}
+
+void
+TestCFUStringsMatchIgnoringCase :: TestMatching(void)
+{
+    const bool  lMatches = true;
+    CFStringRef lString  = CFSTR("Content-Type");
+
+    Test(lString,   lString,               lMatches);
+    Test(lString,   CFSTR("Content-Type"), lMatches);
+    Test(lString,   CFSTR("content-type"), lMatches);
+    Test(lString,   CFSTR("CONTENT-TYPE"), lMatches);
+    Test(CFSTR(""), CFSTR(""),             lMatches);
+}
+
+void
+TestCFUStringsMatchIgnoringCase :: TestNotMatching(void)
+{
+    const bool  lMatches = true;
+    CFStringRef lString  = CFSTR("Content-Type");
+
+    Test(lString, CFSTR("Content-Length"), !lMatches);
+    Test(lString, CFSTR("Content-Typf"),   !lMatches);
+    Test(lString, CFSTR("Content-Type "),  !lMatches);
+    Test(lString, CFSTR(""),               !lMatches);
+
+    // Characters adjacent to the ASCII letters, which differ from
+    // them by the same bit as case does, do not match.
+
+    Test(CFSTR("@[`{"), CFSTR("`{@["), !lMatches);
+}
+
+void
+TestCFUStringsMatchIgnoringCase :: TestRepresentations(void)
+{
+    static const UniChar kCharacters[] = { 'c', 'O', 'N', 't', 'E', 'n', 'T', '-', 't', 'Y', 'p', 'E' };
+    const bool           lMatches      = true;
+    CFStringRef          lFirstString  = CFSTR("Content-Type");
+    CFMutableStringRef   lSecondString;
+    CFStringRef          lThirdString;
+
+    lSecondString = CFStringCreateMutableCopy(kCFAllocatorDefault, 0, CFSTR("CONTENT-TYPE"));
+    CPPUNIT_ASSERT(lSecondString != NULL);
+
+    lThirdString = CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                                kCharacters,
+                                                sizeof (kCharacters) / sizeof (kCharacters[0]));
+    CPPUNIT_ASSERT(lThirdString != NULL);
+
+    Test(lFirstString,  lSecondString, lMatches);
+    Test(lFirstString,  lThirdString,  lMatches);
+    Test(lThirdString,  lFirstString,  lMatches);
+    Test(lSecondString, lThirdString,  lMatches);
+
+    Test(lThirdString,  CFSTR("Content-Typ"), !lMatches);
+
+    CFRelease(lSecondString);
+    CFRelease(lThirdString);
+}
+
+void
+TestCFUStringsMatchIgnoringCase :: TestNonASCII(void)
+{
+    static const UniChar kLower[] = { 'g', 'r', 0x00F6, 0x00DF, 'e' };
+    static const UniChar kUpper[] = { 'G', 'R', 0x00D6, 0x00DF, 'E' };
+    static const UniChar kOther[] = { 'G', 'R', 'O', 0x00DF, 'E' };
+    const bool           lMatches = true;
+    CFStringRef          lLowerString;
+    CFStringRef          lUpperString;
+    CFStringRef          lOtherString;
+
+    // Non-ASCII characters are folded, too.
+
+    lLowerString = CFStringCreateWithCharacters(kCFAllocatorDefault, kLower, sizeof (kLower) / sizeof (kLower[0]));
+    CPPUNIT_ASSERT(lLowerString != NULL);
+
+    lUpperString = CFStringCreateWithCharacters(kCFAllocatorDefault, kUpper, sizeof (kUpper) / sizeof (kUpper[0]));
+    CPPUNIT_ASSERT(lUpperString != NULL);
+
+    lOtherString = CFStringCreateWithCharacters(kCFAllocatorDefault, kOther, sizeof (kOther) / sizeof (kOther[0]));
+    CPPUNIT_ASSERT(lOtherString != NULL);
+
+    Test(lLowerString, lUpperString, lMatches);
+    Test(lUpperString, lLowerString, lMatches);
+    Test(lLowerString, lOtherString, !lMatches);
+
+    CFRelease(lLowerString);
+    CFRelease(lUpperString);
+    CFRelease(lOtherString);
+}
+
+void
+TestCFUStringsMatchIgnoringCase :: Test(CFStringRef aFirstString,
+                                        CFStringRef aSecondString,
+                                        bool        aMatches)
+{
+    bool lStatus;
+
+    lStatus = CFUStringsMatchIgnoringCase(aFirstString, aSecondString);
+    CPPUNIT_ASSERT(lStatus == aMatches);
+}